@@ -13,6 +13,7 @@
 #include "ACDCGenConfig.h"
 #include "ACDCTraits.h"
 #include "ACDCGenCell.h"
+#include "ACDCGenCellTable.h"
 #include "ThePEG/Utilities/Exception.h"
 
 namespace ACDCGenerator {
@@ -94,6 +95,16 @@ public:
    */
   inline bool addFunction(DimType dim, FncPtrType f, double maxrat = -1.0);
 
+  /**
+   * Add a number of functions, \a fncs, with dimensions given by \a
+   * dims, in the order given. This is equivalent to calling
+   * addFunction() for each of them. The \a maxrat argument is the
+   * same as for addFunction().
+   * @return true if at least one of the functions was non-zero.
+   */
+  inline bool addFunctions(const DimVector & dims, const FncVector & fncs,
+			   double maxrat = -1.0);
+
   /**
    * Remove all added functions and reset the generator;
    */
@@ -252,6 +263,12 @@ public:
    */
   inline bool cheapRandom() const;
 
+  /**
+   * Returns true if the active cells are chosen from a flat table
+   * rather than by walking down the tree of cells.
+   */
+  inline bool flatCells() const;
+
   /**
    * The number of functions used.
    */
@@ -288,6 +305,16 @@ public:
    */
   inline void cheapRandom(bool b);
 
+  /**
+   * Set to true if the active cell in which to generate a point
+   * should be chosen in constant time from a flat alias table of all
+   * active cells, rather than by walking down the tree of cells. The
+   * table for a function is rebuilt after its tree has been changed
+   * in a compensation, so this is mainly useful for large trees which
+   * are rarely changed.
+   */
+  inline void flatCells(bool b);
+
   /**
    * Set a new random number generator.
    */
@@ -337,6 +364,26 @@ public:
   template <typename PIStream>
   void input(PIStream &);
 
+  /**
+   * Write the adapted cell trees and overestimated integrals to a
+   * persistent stream, but neither the function pointers nor the
+   * statistics and compensation state of the run. This is used to
+   * cache the adapted cells in a separate file.
+   */
+  template <typename POStream>
+  void outputGrid(POStream &) const;
+
+  /**
+   * Read cells written by outputGrid() from a persistent stream. The
+   * functions, \a fncs, must be given in the same order as when the
+   * cells were written. The statistics are reset and the generator
+   * is not compensating.
+   * @return false if the number of functions did not match, in which
+   * case the generator is cleared.
+   */
+  template <typename PIStream>
+  bool inputGrid(PIStream &, const FncVector & fncs);
+
 private:
 
   /**
@@ -411,6 +458,25 @@ private:
    */
   inline void  compensate(const DVector & lo, const DVector & up);
 
+  /**
+   * The points with non-zero function values found in the
+   * presampling, ordered in function value.
+   */
+  typedef multimap<double,DVector> PointMap;
+
+  /**
+   * Generate nTry() points with non-zero function values for the
+   * function \a fnc with dimension \a dim, which will be given the
+   * index following the functions already added, and put them in \a
+   * pmap. If ACDCFncTraits defines a values() function (see
+   * ACDCFncBlock) the points are evaluated in blocks, otherwise one
+   * by one.
+   * @return false if the function gave maxTry() consecutive zero
+   * values.
+   */
+  inline bool presample(DimType dim, FncPtrType fnc, PointMap & pmap);
+
+
 private:
 
   /**
@@ -471,6 +537,11 @@ private:
    */
   bool useCheapRandom;
 
+  /**
+   * True if the active cells are chosen from theTables.
+   */
+  bool useFlatCells;
+
   /**
    * A vector of functions.
    */
@@ -486,6 +557,12 @@ private:
    */
   CellVector thePrimaryCells;
 
+  /**
+   * Flat tables of the active cells for the functions in
+   * theFunctions, built on demand if useFlatCells is true.
+   */
+  vector<ACDCGenCellTable> theTables;
+
   /**
    * The accumulated sum of overestimated integrals of the functions
    * in theFunctions.
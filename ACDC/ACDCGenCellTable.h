@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// ACDCGenCellTable.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ACDCGenCellTable_H
+#define ACDCGenCellTable_H
+
+#include "ACDCGenCell.h"
+#include <algorithm>
+
+namespace ACDCGenerator {
+
+/**
+ * ACDCGenCellTable is a flat representation of the active (leaf)
+ * cells of a tree of ACDCGenCell objects. The limits of the leaf
+ * cells are stored in one contiguous array, and a cell is chosen
+ * according to its overestimated integral using Walker's alias
+ * method. Choosing a cell is therefore done in constant time with one
+ * random number, rather than by walking down the tree with one random
+ * number per level.
+ *
+ * The table is a snapshot of the tree and must be rebuilt whenever
+ * the tree is changed. ACDCGen keeps one table per primary cell and
+ * invalidates it when the corresponding tree is compensated.
+ */
+class ACDCGenCellTable {
+
+public:
+
+  /** The integer type used for indexing the leaf cells. */
+  typedef vector<ACDCGenCell*>::size_type Index;
+
+public:
+
+  /**
+   * Default constructor giving an invalid table.
+   */
+  inline ACDCGenCellTable();
+
+  /**
+   * (Re)build the table from the tree of cells starting with \a root
+   * in \a D dimensions.
+   */
+  inline void build(ACDCGenCell * root, DimType D);
+
+  /**
+   * Choose a leaf cell according to its overestimated integral using
+   * the flat random number \a r. The lower-left and upper-right
+   * corners of the chosen cell are put in \a lo and \a up, which must
+   * have the size given in build().
+   * @return a pointer to the chosen cell.
+   */
+  inline ACDCGenCell * generate(double r, DVector & lo, DVector & up) const;
+
+  /**
+   * Return true if the table has been built and not invalidated since.
+   */
+  inline bool valid() const;
+
+  /**
+   * Mark the table as invalid.
+   */
+  inline void invalidate();
+
+  /**
+   * Return true if there are no cells with non-zero overestimated
+   * integral in the table.
+   */
+  inline bool empty() const;
+
+  /**
+   * The number of cells in the table.
+   */
+  inline Index size() const;
+
+private:
+
+  /**
+   * Add the leaf cells of the tree starting with \a cell with corners
+   * \a lo and \a up to the table.
+   */
+  inline void addCells(ACDCGenCell * cell, DVector & lo, DVector & up);
+
+private:
+
+  /**
+   * The number of dimensions.
+   */
+  DimType theDim;
+
+  /**
+   * True if the table is up to date.
+   */
+  bool isValid;
+
+  /**
+   * The leaf cells with non-zero overestimated integral.
+   */
+  vector<ACDCGenCell*> theCells;
+
+  /**
+   * The overestimated integrals of the cells in theCells.
+   */
+  DVector theWeights;
+
+  /**
+   * The lower-left and upper-right corners of the cells in theCells,
+   * stored as <code>2*theDim</code> consecutive numbers per cell.
+   */
+  DVector theLimits;
+
+  /**
+   * The probability of keeping a cell rather than taking its alias.
+   */
+  DVector theProb;
+
+  /**
+   * The alias of each cell.
+   */
+  vector<Index> theAlias;
+
+};
+
+}
+
+#include "ACDCGenCellTable.icc"
+
+#endif
@@ -37,6 +37,84 @@ struct ACDCFncTraits: public ACDCTraitsType {
 
 };
 
+/**
+ * ACDCFncBlock is used by ACDCGen to evaluate blocks of points in the
+ * presampling. A specialization of ACDCFncTraits may define a
+ * function with the signature <code>static void values(const FncPtr
+ * & f, const vector<DVector> & x, DVector & res)</code>, putting the
+ * value for <code>x[i]</code> in <code>res[i]</code>, to evaluate the
+ * points of a block in a more efficient, eg. vectorized or parallel,
+ * way. Since the points of a block are drawn before they are
+ * evaluated, such a function must not use the random number
+ * generator of ACDCGen. If \a Traits does not define values(), each
+ * point is evaluated with value() directly after it has been drawn,
+ * and the presampling is not changed at all.
+ */
+template <typename Traits>
+struct ACDCFncBlock: public ACDCTraitsType {
+
+  /**
+   * True if \a Traits defines values() for the function type \a
+   * FncPtr.
+   */
+  template <typename FncPtr>
+  static constexpr bool batched() {
+    return has(0, static_cast<const FncPtr *>(0));
+  }
+
+  /**
+   * Evaluate the function \a f for the points \a x, putting the
+   * results in \a res.
+   */
+  template <typename FncPtr>
+  static inline void values(const FncPtr & f, const vector<DVector> & x,
+			    DVector & res) {
+    call(0, f, x, res);
+  }
+
+private:
+
+  /**
+   * Used by batched() if \a Traits defines values().
+   */
+  template <typename FncPtr, typename T = Traits>
+  static constexpr auto has(int, const FncPtr * f)
+    -> decltype(T::values(*f, vector<DVector>(),
+			  *static_cast<DVector *>(0)), bool()) {
+    return true;
+  }
+
+  /**
+   * Used by batched() if \a Traits only defines value().
+   */
+  template <typename FncPtr>
+  static constexpr bool has(long, const FncPtr *) {
+    return false;
+  }
+
+  /**
+   * Used if \a Traits defines values().
+   */
+  template <typename FncPtr, typename T = Traits>
+  static inline auto call(int, const FncPtr & f, const vector<DVector> & x,
+			  DVector & res)
+    -> decltype(T::values(f, x, res)) {
+    T::values(f, x, res);
+  }
+
+  /**
+   * Used if \a Traits only defines value().
+   */
+  template <typename FncPtr>
+  static inline void call(long, const FncPtr & f, const vector<DVector> & x,
+			  DVector & res) {
+    res.resize(x.size());
+    for ( typename vector<DVector>::size_type i = 0; i < x.size(); ++i )
+      res[i] = Traits::value(f, x[i]);
+  }
+
+};
+
 /**
  * ACDCRandomTraits defines the interface to random number generator
  * objects to be used by ACDCGen. If this default implementation is
@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// acdcBenchCellTable.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Compares the tree walk in ACDCGenCell with the flat table in
+// ACDCGenCellTable, which ACDCGen::generate() uses to choose a cell if
+// ACDCGen::flatCells() is set. A random tree in 10 dimensions with
+// 10^5 leaf cells is built, and then cells are chosen both ways and a
+// flat point is generated in each chosen cell. This is the work done
+// in each attempt of generate() apart from the function evaluation;
+// the adaptive sampling itself does not reach trees of this size in
+// a reasonable time. The average maximum value, <g>, of the chosen
+// cells should agree between the two methods.
+// Usage: acdc_bench_cell_table [ncells [npoints]]
+//
+
+#include "ThePEG/ACDC/ACDCGen.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+using namespace ACDCGenerator;
+
+namespace {
+
+struct Rnd {
+  Rnd() : eng(4711), flt(0.0, 1.0) {}
+  double flat() {
+    double r = flt(eng);
+    while ( r <= 0.0 ) r = flt(eng);
+    return r;
+  }
+  std::mt19937_64 eng;
+  std::uniform_real_distribution<double> flt;
+};
+
+const DimType D = 10;
+
+struct Leaf {
+  ACDCGenCell * cell;
+  DVector lo;
+  DVector up;
+};
+
+/*
+ * Build a tree by repeatedly splitting a random leaf cell along a
+ * random dimension and giving the new cells random values.
+ */
+ACDCGenCell * buildTree(long ncells, Rnd & rnd) {
+  ACDCGenCell * root = new ACDCGenCell(1.0, 1.0);
+  vector<Leaf> leaves(1);
+  leaves[0].cell = root;
+  leaves[0].lo = DVector(D, 0.0);
+  leaves[0].up = DVector(D, 1.0);
+  while ( long(leaves.size()) < ncells ) {
+    long i = long(rnd.flat()*leaves.size());
+    Leaf leaf = leaves[i];
+    DimType d = DimType(rnd.flat()*D);
+    double div = leaf.lo[d] + (0.25 + 0.5*rnd.flat())*(leaf.up[d] - leaf.lo[d]);
+    leaf.cell->splitme(leaf.lo[d], div, leaf.up[d], d);
+    leaf.cell->upper()->g(0.1 + 10.0*rnd.flat());
+    leaf.cell->lower()->g(0.1 + 10.0*rnd.flat());
+    Leaf upper = leaf;
+    upper.cell = leaf.cell->upper();
+    upper.lo[d] = div;
+    leaves[i] = upper;
+    leaf.cell = leaf.cell->lower();
+    leaf.up[d] = div;
+    leaves.push_back(leaf);
+  }
+  root->doMaxInt();
+  return root;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+double seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  long ncells = argc > 1 ? std::atol(argv[1]) : 100000;
+  long npoints = argc > 2 ? std::atol(argv[2]) : 10000000;
+
+  Rnd rnd;
+  ACDCGenCell * root = buildTree(ncells, rnd);
+  std::cout << D << "-dimensional tree with " << root->nBins()
+	    << " cells, depth " << root->depth() << std::endl;
+
+  DVector lo(D);
+  DVector up(D);
+  DVector x(D);
+  double sum = 0.0;
+  double sumx = 0.0;
+  Clock::time_point start = Clock::now();
+  for ( long i = 0; i < npoints; ++i ) {
+    lo.assign(D, 0.0);
+    up.assign(D, 1.0);
+    sum += root->generate(lo, up, &rnd)->g();
+    for ( DimType d = 0; d < D; ++d ) x[d] = lo[d] + (up[d] - lo[d])*rnd.flat();
+    sumx += x[0];
+  }
+  double t = seconds(start);
+  std::cout << "tree walk:   " << npoints/t << " points/s, <g> = "
+	    << sum/npoints << std::endl;
+
+  ACDCGenCellTable table;
+  start = Clock::now();
+  table.build(root, D);
+  std::cout << "table build: " << 1000.0*seconds(start) << " ms" << std::endl;
+  sum = 0.0;
+  start = Clock::now();
+  for ( long i = 0; i < npoints; ++i ) {
+    sum += table.generate(rnd.flat(), lo, up)->g();
+    for ( DimType d = 0; d < D; ++d ) x[d] = lo[d] + (up[d] - lo[d])*rnd.flat();
+    sumx += x[0];
+  }
+  t = seconds(start);
+  std::cout << "flat table:  " << npoints/t << " points/s, <g> = "
+	    << sum/npoints << std::endl;
+  delete root;
+
+  std::cerr << "(checksum " << sumx << ")" << std::endl;
+  return 0;
+}
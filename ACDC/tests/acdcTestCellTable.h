@@ -0,0 +1,282 @@
+// -*- C++ -*-
+//
+// acdcTestCellTable.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_ACDC_Test_CellTable_H
+#define ThePEG_ACDC_Test_CellTable_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/ACDC/ACDCGen.h"
+#include <cmath>
+#include <map>
+#include <random>
+
+using namespace ACDCGenerator;
+
+namespace {
+
+struct AcdcTestRnd {
+  AcdcTestRnd() : eng(4711), flt(0.0, 1.0) {}
+  double flat() {
+    double r = flt(eng);
+    while ( r <= 0.0 ) r = flt(eng);
+    return r;
+  }
+  std::mt19937_64 eng;
+  std::uniform_real_distribution<double> flt;
+};
+
+/*
+ * A leaf cell of a tree together with its corners.
+ */
+struct AcdcLeaf {
+  ACDCGenCell * cell;
+  DVector lo;
+  DVector up;
+};
+
+/*
+ * A tree of cells in D dimensions and a list of its leaf cells.
+ */
+struct AcdcTree {
+
+  AcdcTree(DimType d, double g) : D(d), root(new ACDCGenCell(g, 1.0)),
+				  leaves(1) {
+    leaves[0].cell = root;
+    leaves[0].lo = DVector(D, 0.0);
+    leaves[0].up = DVector(D, 1.0);
+    root->doMaxInt();
+  }
+
+  ~AcdcTree() { delete root; }
+
+  /*
+   * Split the leaf cell \a i along a random dimension and give the
+   * two new cells the values \a gup and \a glo.
+   */
+  void split(long i, double gup, double glo, AcdcTestRnd & rnd) {
+    AcdcLeaf leaf = leaves[i];
+    DimType d = DimType(rnd.flat()*D);
+    double div = leaf.lo[d] + (0.25 + 0.5*rnd.flat())*(leaf.up[d] - leaf.lo[d]);
+    leaf.cell->splitme(leaf.lo[d], div, leaf.up[d], d);
+    leaf.cell->upper()->g(gup);
+    leaf.cell->lower()->g(glo);
+    AcdcLeaf upper = leaf;
+    upper.cell = leaf.cell->upper();
+    upper.lo[d] = div;
+    leaves[i] = upper;
+    leaf.cell = leaf.cell->lower();
+    leaf.up[d] = div;
+    leaves.push_back(leaf);
+    root->doMaxInt();
+  }
+
+  /*
+   * Split random leaf cells until there are \a n leaves. Some of the
+   * new cells are given a zero value.
+   */
+  void grow(long n, AcdcTestRnd & rnd) {
+    while ( long(leaves.size()) < n ) {
+      double gup = rnd.flat() < 0.1? 0.0: 0.1 + 10.0*rnd.flat();
+      double glo = rnd.flat() < 0.1? 0.0: 0.1 + 10.0*rnd.flat();
+      split(long(rnd.flat()*leaves.size()), gup, glo, rnd);
+    }
+  }
+
+  /*
+   * Mimic a compensation: split a random leaf cell and increase the
+   * value of one of the new cells.
+   */
+  void compensate(AcdcTestRnd & rnd) {
+    long i = long(rnd.flat()*leaves.size());
+    double g = leaves[i].cell->g();
+    if ( g <= 0.0 ) g = 1.0;
+    split(i, g*(2.0 + 8.0*rnd.flat()), g, rnd);
+  }
+
+  DimType D;
+  ACDCGenCell * root;
+  vector<AcdcLeaf> leaves;
+
+};
+
+/*
+ * Check that the cells chosen by \a table follow the overestimated
+ * integrals of the leaf cells in \a tree, and that the corners given
+ * are the ones of the chosen cell. The random number is scanned in K
+ * equidistant steps for each of the N entries in the table, so the
+ * fraction of steps giving a cell may differ from the exact
+ * probability by at most 1/NK for each entry where it is found, and
+ * a cell with a probability below 1/NK may not be found at all.
+ */
+void acdcCheckTable(const ACDCGenCellTable & table, const AcdcTree & tree) {
+  std::map<ACDCGenCell *, const AcdcLeaf *> leafmap;
+  double sum = 0.0;
+  ACDCGenCellTable::Index nactive = 0;
+  for ( const AcdcLeaf & leaf : tree.leaves ) {
+    leafmap[leaf.cell] = &leaf;
+    sum += leaf.cell->maxInt();
+    if ( leaf.cell->maxInt() > 0.0 ) ++nactive;
+  }
+  BOOST_CHECK_CLOSE(sum, tree.root->maxInt(), 1.0e-8);
+  BOOST_REQUIRE(table.valid());
+  BOOST_REQUIRE_EQUAL(table.size(), nactive);
+  BOOST_REQUIRE_EQUAL(table.empty(), nactive == 0);
+  if ( table.empty() ) return;
+
+  const long K = 1000;
+  const long N = table.size();
+  const double M = double(N*K);
+  std::map<ACDCGenCell *, long> count;
+  std::map<ACDCGenCell *, long> entries;
+  std::map<ACDCGenCell *, long> lastEntry;
+  DVector lo(tree.D);
+  DVector up(tree.D);
+  for ( long j = 0; j < N; ++j ) for ( long k = 0; k < K; ++k ) {
+    ACDCGenCell * cell = table.generate((j*K + k + 0.5)/M, lo, up);
+    std::map<ACDCGenCell *, const AcdcLeaf *>::iterator leaf =
+      leafmap.find(cell);
+    BOOST_REQUIRE(leaf != leafmap.end());
+    if ( !count[cell]++ ) {
+      BOOST_CHECK(lo == leaf->second->lo);
+      BOOST_CHECK(up == leaf->second->up);
+    }
+    if ( !entries.count(cell) || lastEntry[cell] != j ) {
+      ++entries[cell];
+      lastEntry[cell] = j;
+    }
+  }
+
+  for ( const AcdcLeaf & leaf : tree.leaves ) {
+    double p = leaf.cell->maxInt()/sum;
+    double f = count[leaf.cell]/M;
+    BOOST_CHECK_LE(std::abs(f - p), (entries[leaf.cell] + 1)/M);
+    if ( p <= 0.0 ) BOOST_CHECK_EQUAL(count[leaf.cell], 0);
+  }
+}
+
+/*
+ * A narrow peak on a flat background in two dimensions.
+ */
+struct AcdcTestFn {
+  double operator()(const DVector & x) const {
+    return 0.1 + 100.0*std::exp(-sqr((x[0] - 0.3)/0.01) - sqr((x[1] - 0.7)/0.01));
+  }
+  static double sqr(double x) { return x*x; }
+
+  /*
+   * The integral of a Gaussian with width w at x0 from a to b.
+   */
+  static double gauss(double x0, double w, double a, double b) {
+    return 0.5*w*std::sqrt(M_PI)*(std::erf((b - x0)/w) - std::erf((a - x0)/w));
+  }
+
+  /*
+   * The integral over x[0] from a to b and over x[1] from 0 to 1.
+   */
+  static double integral(double a, double b) {
+    return 0.1*(b - a) + 100.0*gauss(0.3, 0.01, a, b)*gauss(0.7, 0.01, 0.0, 1.0);
+  }
+};
+
+/*
+ * Generate \a n points of AcdcTestFn with ACDCGen and return the
+ * chi-square of the distribution in x[0] in \a nbins bins.
+ */
+double acdcGenChi2(bool flat, long n, int nbins) {
+  AcdcTestRnd rnd;
+  AcdcTestFn fn;
+  ACDCGen<AcdcTestRnd,const AcdcTestFn *> gen(&rnd);
+  gen.flatCells(flat);
+  gen.nTry(10);
+  BOOST_REQUIRE(gen.addFunction(2, &fn));
+  int nbins0 = gen.nBins();
+  vector<long> hist(nbins, 0);
+  for ( long i = 0; i < n; ++i ) {
+    BOOST_REQUIRE(gen.generate());
+    ++hist[min(int(gen.lastPoint()[0]*nbins), nbins - 1)];
+  }
+
+  // The cells must have been split during the generation, after the
+  // first table was built.
+  BOOST_CHECK_GT(gen.nBins(), nbins0);
+
+  double chi2 = 0.0;
+  double tot = AcdcTestFn::integral(0.0, 1.0);
+  for ( int i = 0; i < nbins; ++i ) {
+    double e = n*AcdcTestFn::integral(double(i)/nbins, double(i + 1)/nbins)/tot;
+    chi2 += AcdcTestFn::sqr(hist[i] - e)/e;
+  }
+  return chi2;
+}
+
+}
+
+/*
+ * Start of boost unit tests for ACDCGenCellTable.h
+ *
+ */
+BOOST_AUTO_TEST_SUITE(acdcCellTable)
+
+BOOST_AUTO_TEST_CASE(cellTableFresh)
+{
+  ACDCGenCellTable table;
+  BOOST_CHECK(!table.valid());
+  AcdcTree tree(3, 2.0);
+  table.build(tree.root, tree.D);
+  acdcCheckTable(table, tree);
+
+  AcdcTree zero(3, 0.0);
+  table.build(zero.root, zero.D);
+  acdcCheckTable(table, zero);
+  BOOST_CHECK(table.empty());
+}
+
+BOOST_AUTO_TEST_CASE(cellTableSplits)
+{
+  // The same table is rebuilt as the tree grows.
+  AcdcTestRnd rnd;
+  AcdcTree tree(4, 1.0);
+  ACDCGenCellTable table;
+  for ( long n : { 2, 10, 100, 2000 } ) {
+    tree.grow(n, rnd);
+    table.build(tree.root, tree.D);
+    acdcCheckTable(table, tree);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(cellTableCompensation)
+{
+  AcdcTestRnd rnd;
+  AcdcTree tree(3, 1.0);
+  tree.grow(500, rnd);
+  ACDCGenCellTable table;
+  table.build(tree.root, tree.D);
+  acdcCheckTable(table, tree);
+  for ( int i = 0; i < 20; ++i ) {
+    for ( int j = 0; j <= i%4; ++j ) tree.compensate(rnd);
+    table.invalidate();
+    BOOST_CHECK(!table.valid());
+    table.build(tree.root, tree.D);
+    acdcCheckTable(table, tree);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(cellTableGenerator)
+{
+  // The generated distribution is the same whether the cells are
+  // chosen from the table or by walking down the tree, also when the
+  // tree changes while generating. The 99.9% limit of the chi-square
+  // with 19 degrees of freedom is 43.8.
+  BOOST_CHECK_LT(acdcGenChi2(true, 200000, 20), 43.8);
+  BOOST_CHECK_LT(acdcGenChi2(false, 200000, 20), 43.8);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
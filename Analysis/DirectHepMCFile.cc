@@ -0,0 +1,401 @@
+// -*- C++ -*-
+//
+// DirectHepMCFile.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+//
+// This is the implementation of the non-inlined, non-templated member
+// functions of the DirectHepMCFile class.
+//
+
+#include "DirectHepMCFile.h"
+#include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Interface/Parameter.h"
+#include "ThePEG/Interface/Switch.h"
+#include "ThePEG/EventRecord/Event.h"
+#include "ThePEG/Repository/EventGenerator.h"
+#include "ThePEG/Utilities/DescribeClass.h"
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
+#include <cstdio>
+
+using namespace ThePEG;
+
+void DirectHepMC::Event::clear() {
+  for ( int i = 0, N = vertices.size(); i < N; ++i ) {
+    Vertex * v = vertices[i];
+    for ( int j = 0, M = v->in.size(); j < M; ++j )
+      if ( !v->in[j]->prod ) delete v->in[j];
+    for ( int j = 0, M = v->out.size(); j < M; ++j )
+      delete v->out[j];
+    delete v;
+  }
+  vertices.clear();
+  number = 0;
+  weights.clear();
+  weightNames.clear();
+  mev = cm = false;
+  scale = alphaS = alphaEM = -1.0;
+  hasSignal = false;
+  beams[0] = beams[1] = 0;
+  hasPdf = false;
+  xSec = xSecErr = 0.0;
+}
+
+void DirectHepMC::Traits::
+resetEvent(EventT * e, long evno, double weight,
+	   const map<string,double> & optionalWeights) {
+  e->number = evno;
+  e->weights.clear();
+  e->weightNames.clear();
+  e->weights.push_back(weight);
+  e->weightNames.push_back("Default");
+  for ( map<string,double>::const_iterator w = optionalWeights.begin();
+	w != optionalWeights.end(); ++w ) {
+    e->weights.push_back(w->second);
+    e->weightNames.push_back(w->first);
+  }
+}
+
+DirectHepMC::Particle * DirectHepMC::Traits::
+newParticle(const Lorentz5Momentum & p, long id, int status, Energy unit) {
+  Particle * gp = new Particle();
+  gp->p[0] = p.x()/unit;
+  gp->p[1] = p.y()/unit;
+  gp->p[2] = p.z()/unit;
+  gp->p[3] = p.e()/unit;
+  gp->p[4] = p.mass()/unit;
+  gp->id = id;
+  gp->status = status;
+  gp->theta = gp->phi = 0.0;
+  gp->flow[0] = gp->flow[1] = 0;
+  gp->barcode = 0;
+  gp->prod = gp->end = 0;
+  return gp;
+}
+
+DirectHepMCFile::DirectHepMCFile()
+  : theEventNumber(1), theUnitChoice(0), thePrecision(16),
+    theBackgroundWriting(false), theWriterStop(false) {}
+
+// Cannot copy the file or the writer thread.
+// Let doinitrun() take care of their initialization.
+DirectHepMCFile::DirectHepMCFile(const DirectHepMCFile & x)
+  : AnalysisHandler(x), theEventNumber(x.theEventNumber),
+    theFilename(x.theFilename), theUnitChoice(x.theUnitChoice),
+    thePrecision(x.thePrecision),
+    theBackgroundWriting(x.theBackgroundWriting), theWriterStop(false) {}
+
+DirectHepMCFile::~DirectHepMCFile() {
+  stopWriter();
+}
+
+IBPtr DirectHepMCFile::clone() const {
+  return new_ptr(*this);
+}
+
+IBPtr DirectHepMCFile::fullclone() const {
+  return new_ptr(*this);
+}
+
+void DirectHepMCFile::doinitrun() {
+  AnalysisHandler::doinitrun();
+
+  // set default filename unless user-specified name exists
+  if ( theFilename.empty() )
+    theFilename = generator()->filename() + ".hepmc";
+
+  theFile.open(theFilename, "w");
+  if ( !theFile )
+    throw FileError()
+      << "The DirectHepMCFile '" << name() << "' could not open the "
+      << "output file called '" << theFilename << "'."
+      << Exception::runerror;
+
+  theBuffer = "\nHepMC::Version 2.06.09\n"
+    "HepMC::IO_GenEvent-START_EVENT_LISTING\n";
+  theWriterStop = false;
+  if ( theBackgroundWriting )
+    theWriter = std::thread(&DirectHepMCFile::writeEvents, this);
+  flush();
+}
+
+void DirectHepMCFile::dofinish() {
+  if ( theFile ) {
+    theBuffer = "HepMC::IO_GenEvent-END_EVENT_LISTING\n\n";
+    flush();
+    stopWriter();
+    theFile.close();
+  }
+  theEvent.clear();
+  AnalysisHandler::dofinish();
+  cout << "\nDirectHepMCFile: generated HepMC output.\n";
+}
+
+void DirectHepMCFile::analyze(tEventPtr event, long, int, int) {
+  if ( event->number() > theEventNumber ) return;
+
+  Energy eUnit;
+  Length lUnit;
+  switch ( theUnitChoice ) {
+  default: eUnit = GeV; lUnit = millimeter; break;
+  case 1:  eUnit = MeV; lUnit = millimeter; break;
+  case 2:  eUnit = GeV; lUnit = centimeter; break;
+  case 3:  eUnit = MeV; lUnit = centimeter; break;
+  }
+
+  theConverter.fill(*event, theEvent, false, eUnit, lUnit);
+  format();
+  flush();
+}
+
+void DirectHepMCFile::put(long i) {
+  char buff[24];
+  char * end = buff + sizeof(buff);
+  char * c = end;
+  unsigned long u = i < 0? 0UL - (unsigned long)i: (unsigned long)i;
+  do {
+    *--c = '0' + u%10;
+    u /= 10;
+  } while ( u );
+  if ( i < 0 ) *--c = '-';
+  *--c = ' ';
+  theBuffer.append(c, end - c);
+}
+
+void DirectHepMCFile::put(double d) {
+  if ( d == 0.0 ) {
+    theBuffer += " 0";
+    return;
+  }
+  char buff[40];
+  int n = snprintf(buff, sizeof(buff), " %.*e", int(thePrecision), d);
+  theBuffer.append(buff, n);
+}
+
+void DirectHepMCFile::format() {
+  const DirectHepMC::Event & e = theEvent;
+  theBuffer.clear();
+
+  // Assign barcodes in the same order as HepMC::GenEvent does when
+  // the vertices are added: first the outgoing particles of a vertex
+  // and then the incoming particles without a production vertex.
+  long barcode = 10000;
+  for ( int i = 0, N = e.vertices.size(); i < N; ++i ) {
+    DirectHepMC::Vertex & v = *e.vertices[i];
+    v.barcode = -1L - i;
+    for ( int j = 0, M = v.out.size(); j < M; ++j )
+      if ( !v.out[j]->barcode ) v.out[j]->barcode = ++barcode;
+    for ( int j = 0, M = v.in.size(); j < M; ++j )
+      if ( !v.in[j]->prod && !v.in[j]->barcode )
+	v.in[j]->barcode = ++barcode;
+  }
+
+  theBuffer += 'E';
+  put(e.number);
+  put(-1L);
+  put(e.scale);
+  put(e.alphaS);
+  put(e.alphaEM);
+  put(0L);
+  put(e.hasSignal? -1L: 0L);
+  put(long(e.vertices.size()));
+  put(e.beams[0]? e.beams[0]->barcode: 0L);
+  put(e.beams[1]? e.beams[1]->barcode: 0L);
+  put(0L);
+  put(long(e.weights.size()));
+  for ( int i = 0, N = e.weights.size(); i < N; ++i ) put(e.weights[i]);
+  theBuffer += '\n';
+
+  theBuffer += 'N';
+  put(long(e.weightNames.size()));
+  for ( int i = 0, N = e.weightNames.size(); i < N; ++i ) {
+    theBuffer += " \"";
+    theBuffer += e.weightNames[i];
+    theBuffer += '"';
+  }
+  theBuffer += '\n';
+
+  theBuffer += e.mev? "U MEV": "U GEV";
+  theBuffer += e.cm? " CM\n": " MM\n";
+
+  theBuffer += 'C';
+  put(e.xSec);
+  put(e.xSecErr);
+  theBuffer += '\n';
+
+  if ( e.hasPdf ) {
+    theBuffer += 'F';
+    put(long(e.pdfId[0]));
+    put(long(e.pdfId[1]));
+    put(e.pdfX[0]);
+    put(e.pdfX[1]);
+    put(e.pdfScale);
+    put(e.pdfXf[0]);
+    put(e.pdfXf[1]);
+    put(0L);
+    put(0L);
+    theBuffer += '\n';
+  }
+
+  for ( int i = 0, N = e.vertices.size(); i < N; ++i ) {
+    const DirectHepMC::Vertex & v = *e.vertices[i];
+    long norphans = 0;
+    for ( int j = 0, M = v.in.size(); j < M; ++j )
+      if ( !v.in[j]->prod ) ++norphans;
+    theBuffer += 'V';
+    put(v.barcode);
+    put(0L);
+    for ( int k = 0; k < 4; ++k ) put(v.x[k]);
+    put(norphans);
+    put(long(v.out.size()));
+    put(0L);
+    theBuffer += '\n';
+    for ( int io = 0; io < 2; ++io ) {
+      const vector<DirectHepMC::Particle *> & ps = io? v.out: v.in;
+      for ( int j = 0, M = ps.size(); j < M; ++j ) {
+	const DirectHepMC::Particle & p = *ps[j];
+	if ( !io && p.prod ) continue;
+	theBuffer += 'P';
+	put(p.barcode);
+	put(p.id);
+	for ( int k = 0; k < 5; ++k ) put(p.p[k]);
+	put(long(p.status));
+	put(p.theta);
+	put(p.phi);
+	put(p.end? p.end->barcode: 0L);
+	put(long(( p.flow[0]? 1: 0 ) + ( p.flow[1]? 1: 0 )));
+	for ( int k = 0; k < 2; ++k )
+	  if ( p.flow[k] ) {
+	    put(long(k + 1));
+	    put(long(p.flow[k]));
+	  }
+	theBuffer += '\n';
+      }
+    }
+  }
+}
+
+void DirectHepMCFile::flush() {
+  if ( !theWriter.joinable() ) {
+    theFile.write(theBuffer.data(), theBuffer.size());
+    return;
+  }
+  std::unique_lock<std::mutex> lock(theWriterMutex);
+  theWriterCondition.wait(lock, [this] { return thePending.empty(); });
+  thePending.swap(theBuffer);
+  lock.unlock();
+  theWriterCondition.notify_all();
+}
+
+void DirectHepMCFile::writeEvents() {
+  string text;
+  while ( true ) {
+    {
+      std::unique_lock<std::mutex> lock(theWriterMutex);
+      theWriterCondition.wait(lock, [this] {
+	  return theWriterStop || !thePending.empty();
+	});
+      if ( thePending.empty() ) return;
+      text.swap(thePending);
+    }
+    theWriterCondition.notify_all();
+    theFile.write(text.data(), text.size());
+    text.clear();
+  }
+}
+
+void DirectHepMCFile::stopWriter() {
+  if ( !theWriter.joinable() ) return;
+  {
+    std::lock_guard<std::mutex> lock(theWriterMutex);
+    theWriterStop = true;
+  }
+  theWriterCondition.notify_all();
+  theWriter.join();
+}
+
+void DirectHepMCFile::persistentOutput(PersistentOStream & os) const {
+  os << theEventNumber << theFilename << theUnitChoice << thePrecision
+     << theBackgroundWriting;
+}
+
+void DirectHepMCFile::persistentInput(PersistentIStream & is, int) {
+  is >> theEventNumber >> theFilename >> theUnitChoice >> thePrecision
+     >> theBackgroundWriting;
+}
+
+// The following static variable is needed for the type
+// description system in ThePEG.
+DescribeClass<DirectHepMCFile,AnalysisHandler>
+describeThePEGDirectHepMCFile("ThePEG::DirectHepMCFile", "HepMCAnalysis.so");
+
+void DirectHepMCFile::Init() {
+
+  static ClassDocumentation<DirectHepMCFile> documentation
+    ("This analysis handler will output the event record in the HepMC "
+     "IO_GenEvent format without creating HepMC::GenEvent objects.");
+
+  static Parameter<DirectHepMCFile,long> interfacePrintEvent
+    ("PrintEvent",
+     "The number of events that should be printed.",
+     &DirectHepMCFile::theEventNumber, 1, 0, 0,
+     false, false, Interface::lowerlim);
+
+  static Parameter<DirectHepMCFile,string> interfaceFilename
+    ("Filename",
+     "Name of the output file. If the name ends in \".gz\" the output "
+     "is compressed.",
+     &DirectHepMCFile::theFilename, "");
+
+  static Parameter<DirectHepMCFile,unsigned int> interfacePrecision
+    ("Precision",
+     "Choice of output precision (as number of digits).",
+     &DirectHepMCFile::thePrecision, 16, 6, 16,
+     false, false, Interface::limited);
+
+  static Switch<DirectHepMCFile,int> interfaceUnits
+    ("Units",
+     "Unit choice for energy and length",
+     &DirectHepMCFile::theUnitChoice, 0, false, false);
+  static SwitchOption interfaceUnitsGeV_mm
+    (interfaceUnits,
+     "GeV_mm",
+     "Use GeV and mm as units.",
+     0);
+  static SwitchOption interfaceUnitsMeV_mm
+    (interfaceUnits,
+     "MeV_mm",
+     "Use MeV and mm as units.",
+     1);
+  static SwitchOption interfaceUnitsGeV_cm
+    (interfaceUnits,
+     "GeV_cm",
+     "Use GeV and cm as units.",
+     2);
+  static SwitchOption interfaceUnitsMeV_cm
+    (interfaceUnits,
+     "MeV_cm",
+     "Use MeV and cm as units.",
+     3);
+
+  static Switch<DirectHepMCFile,bool> interfaceBackgroundWriting
+    ("BackgroundWriting",
+     "Write (and compress) the events in a separate thread, while the "
+     "next event is being generated.",
+     &DirectHepMCFile::theBackgroundWriting, false, false, false);
+  static SwitchOption interfaceBackgroundWritingYes
+    (interfaceBackgroundWriting,
+     "Yes",
+     "Write events in a separate thread.",
+     true);
+  static SwitchOption interfaceBackgroundWritingNo
+    (interfaceBackgroundWriting,
+     "No",
+     "Write events in the main thread.",
+     false);
+
+}
@@ -0,0 +1,500 @@
+// -*- C++ -*-
+//
+// DirectHepMCFile.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef THEPEG_DirectHepMCFile_H
+#define THEPEG_DirectHepMCFile_H
+//
+// This is the declaration of the DirectHepMCFile class.
+//
+#include "ThePEG/Handlers/AnalysisHandler.h"
+#include "ThePEG/Vectors/HepMCConverter.h"
+#include "ThePEG/Utilities/CFile.h"
+#include "ThePEG/Utilities/MemoryPool.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace ThePEG {
+
+/**
+ * The DirectHepMC namespace contains a minimal event record with the
+ * structure of a HepMC::GenEvent, which is filled by the
+ * HepMCConverter and written out by the DirectHepMCFile class.
+ */
+namespace DirectHepMC {
+
+struct Vertex;
+
+/**
+ * A particle in the DirectHepMC::Event record.
+ */
+struct Particle {
+
+  ThePEG_DECLARE_POOL_ALLOCATION(Particle)
+
+  /** The momentum components (x, y, z, e) and the generated mass. */
+  double p[5];
+  /** The PDG number. */
+  long id;
+  /** The HepMC status code. */
+  int status;
+  /** The polarization angles. */
+  double theta, phi;
+  /** The colour (0) and anti-colour (1) flow indices. */
+  int flow[2];
+  /** The barcode assigned when the event is written. */
+  long barcode;
+  /** The production vertex. */
+  Vertex * prod;
+  /** The decay vertex. */
+  Vertex * end;
+
+};
+
+/**
+ * A vertex in the DirectHepMC::Event record.
+ */
+struct Vertex {
+
+  ThePEG_DECLARE_POOL_ALLOCATION(Vertex)
+
+  /** The incoming particles. */
+  vector<Particle *> in;
+  /** The outgoing particles. */
+  vector<Particle *> out;
+  /** The position (x, y, z, t). */
+  double x[4];
+  /** The barcode assigned when the event is written. */
+  long barcode;
+
+};
+
+/**
+ * A minimal event record with the information written to a HepMC
+ * IO_GenEvent file. The Event owns all vertices added to it and all
+ * particles attached to them.
+ */
+struct Event {
+
+  /** Default constructor. */
+  Event() { clear(); }
+
+  /** Destructor deleting all vertices and particles. */
+  ~Event() { clear(); }
+
+  /** Delete all vertices and particles and reset the event info. */
+  void clear();
+
+  /** The event number. */
+  long number;
+  /** The weights. */
+  vector<double> weights;
+  /** The names of the weights. */
+  vector<string> weightNames;
+  /** True if the units are MeV rather than GeV. */
+  bool mev;
+  /** True if the units are cm rather than mm. */
+  bool cm;
+  /** The scale, \f$\alpha_S\f$ and \f$\alpha_{EM}\f$. */
+  double scale, alphaS, alphaEM;
+  /** The vertices, the first one being the signal process vertex if
+      hasSignal is true. */
+  vector<Vertex *> vertices;
+  /** True if a signal process vertex was set. */
+  bool hasSignal;
+  /** The incoming beam particles. */
+  Particle * beams[2];
+  /** True if PDF info was set. */
+  bool hasPdf;
+  /** The PDF info (parton ids, x-values, scale and xf-values). */
+  int pdfId[2];
+  /** @cond NEVERTOBEDOCUMENTED */
+  double pdfX[2], pdfScale, pdfXf[2];
+  /** @endcond */
+  /** The cross section and its error in picobarn. */
+  double xSec, xSecErr;
+
+private:
+
+  /** The Event cannot be copied. */
+  Event(const Event &);
+  /** The Event cannot be assigned. */
+  Event & operator=(const Event &);
+
+};
+
+/**
+ * The traits class used by the HepMCConverter to fill a
+ * DirectHepMC::Event.
+ */
+struct Traits {
+
+  /** Typedef of the particle class. */
+  typedef Particle ParticleT;
+  /** Typedef of the event class. */
+  typedef Event EventT;
+  /** Typedef of the vertex class. */
+  typedef Vertex VertexT;
+  /** Typedef of the polarization class (not used). */
+  typedef void PolarizationT;
+  /** Typedef of the PdfInfo class (not used). */
+  typedef void PdfInfoT;
+
+  /** Remove all particles and vertices. */
+  static void clearEvent(EventT & e) { e.clear(); }
+
+  /** Set the number and weights of the event. */
+  static void resetEvent(EventT * e, long evno, double weight,
+			 const map<string,double> & optionalWeights);
+
+  /** The default energy unit. */
+  static Energy defaultEnergyUnit() { return GeV; }
+
+  /** The default length unit. */
+  static Length defaultLengthUnit() { return millimeter; }
+
+  /** Set the units. */
+  static void setUnits(EventT & e, Energy momu, Length lenu) {
+    e.mev = ( momu == MeV );
+    e.cm = ( lenu == centimeter );
+  }
+
+  /** Set the scale and couplings. */
+  static void setScaleAndAlphas(EventT & e, Energy2 scale,
+				double aS, double aEM, Energy unit) {
+    e.scale = sqrt(scale)/unit;
+    e.alphaS = aS;
+    e.alphaEM = aEM;
+  }
+
+  /** Set the signal process vertex, which is always added first. */
+  static void setSignalProcessVertex(EventT & e, VertexT * v) {
+    if ( !v ) return;
+    e.vertices.insert(e.vertices.begin(), v);
+    e.hasSignal = true;
+  }
+
+  /** Add a vertex. */
+  static void addVertex(EventT & e, VertexT * v) {
+    e.vertices.push_back(v);
+  }
+
+  /** Create a new particle. */
+  static ParticleT * newParticle(const Lorentz5Momentum & p,
+				 long id, int status, Energy unit);
+
+  /** Set the polarization angles. */
+  static void setPolarization(ParticleT & p, double the, double phi) {
+    p.theta = the;
+    p.phi = phi;
+  }
+
+  /** Set the colour line with index \a indx (1 or 2). */
+  static void setColourLine(ParticleT & p, int indx, int coline) {
+    p.flow[indx - 1] = coline;
+  }
+
+  /** Create a new vertex. */
+  static VertexT * newVertex() {
+    VertexT * v = new VertexT();
+    v->barcode = 0;
+    return v;
+  }
+
+  /** Add an incoming particle to a vertex. */
+  static void addIncoming(VertexT & v, ParticleT * p) {
+    v.in.push_back(p);
+    p->end = &v;
+  }
+
+  /** Add an outgoing particle to a vertex. */
+  static void addOutgoing(VertexT & v, ParticleT * p) {
+    v.out.push_back(p);
+    p->prod = &v;
+  }
+
+  /** Set the position of a vertex. */
+  static void setPosition(VertexT & v, const LorentzPoint & p, Length unit) {
+    v.x[0] = p.x()/unit;
+    v.x[1] = p.y()/unit;
+    v.x[2] = p.z()/unit;
+    v.x[3] = p.t()/unit;
+  }
+
+  /** Set the beam particles. */
+  static void setBeamParticles(EventT & e, ParticleT * p1, ParticleT * p2) {
+    e.beams[0] = p1;
+    e.beams[1] = p2;
+    if ( p1 ) p1->status = 4;
+    if ( p2 ) p2->status = 4;
+  }
+
+  /** Set the PDF info. */
+  static void setPdfInfo(EventT & e, int id1, int id2, double x1, double x2,
+			 double scale, double xf1, double xf2) {
+    e.hasPdf = true;
+    e.pdfId[0] = id1;
+    e.pdfId[1] = id2;
+    e.pdfX[0] = x1;
+    e.pdfX[1] = x2;
+    e.pdfScale = scale;
+    e.pdfXf[0] = xf1;
+    e.pdfXf[1] = xf2;
+  }
+
+  /** Set the cross section info. */
+  static void setCrossSection(EventT & e, double xs, double xserr) {
+    e.xSec = xs;
+    e.xSecErr = xserr;
+  }
+
+};
+
+}
+
+/** \ingroup Analysis
+ * The DirectHepMCFile class writes ThePEG events to a file in the
+ * HepMC IO_GenEvent ASCII format, without creating HepMC::GenEvent
+ * objects. The events are converted by the HepMCConverter into a
+ * minimal DirectHepMC::Event record, taking its particles and
+ * vertices from a memory pool, which is formatted into a text buffer
+ * reused for all events. The result is the same as writing with the
+ * HepMCFile handler in the GenEvent format.
+ *
+ * If the file name ends in ".gz" the output is compressed. Writing
+ * and compression can be done in a separate thread, in which case the
+ * next event is formatted while the previous one is written.
+ *
+ * @see \ref DirectHepMCFileInterfaces "The interfaces"
+ * defined for DirectHepMCFile.
+ */
+class DirectHepMCFile: public AnalysisHandler {
+
+public:
+
+  /** @name Standard constructors and destructors. */
+  //@{
+  /**
+   * The default constructor.
+   */
+  DirectHepMCFile();
+
+  /**
+   * The copy constructor.
+   */
+  DirectHepMCFile(const DirectHepMCFile &);
+
+  /**
+   * The destructor.
+   */
+  virtual ~DirectHepMCFile();
+  //@}
+
+public:
+
+  /** @name Virtual functions required by the AnalysisHandler class. */
+  //@{
+  /**
+   * Convert the given Event and write it to the file.
+   * @param event pointer to the Event to be analyzed.
+   * @param ieve the event number.
+   * @param loop the number of times this event has been presented.
+   * If negative the event is now fully generated.
+   * @param state a number different from zero if the event has been
+   * manipulated in some way since it was last presented.
+   */
+  virtual void analyze(tEventPtr event, long ieve, int loop, int state);
+  //@}
+
+public:
+
+  /** @name Functions used by the persistent I/O system. */
+  //@{
+  /**
+   * Function used to write out object persistently.
+   * @param os the persistent output stream written to.
+   */
+  void persistentOutput(PersistentOStream & os) const;
+
+  /**
+   * Function used to read in object persistently.
+   * @param is the persistent input stream read from.
+   * @param version the version number of the object when written.
+   */
+  void persistentInput(PersistentIStream & is, int version);
+  //@}
+
+  /**
+   * The standard Init function used to initialize the interfaces.
+   * Called exactly once for each class by the class description system
+   * before the main function starts or
+   * when this class is dynamically loaded.
+   */
+  static void Init();
+
+protected:
+
+  /**
+   * Format the converted event into theBuffer.
+   */
+  void format();
+
+  /**
+   * Write the contents of theBuffer to the file, either directly or
+   * by handing it over to the writer thread.
+   */
+  void flush();
+
+  /**
+   * The function run by the writer thread.
+   */
+  void writeEvents();
+
+  /**
+   * Stop and join the writer thread, writing out any pending event.
+   */
+  void stopWriter();
+
+  /**
+   * Append an integer to theBuffer, preceded by a space.
+   */
+  void put(long i);
+
+  /**
+   * Append a floating point number to theBuffer, preceded by a space,
+   * in the same format as HepMC::IO_GenEvent.
+   */
+  void put(double d);
+
+protected:
+
+  /** @name Clone Methods. */
+  //@{
+  /**
+   * Make a simple clone of this object.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr clone() const;
+
+  /** Make a clone of this object, possibly modifying the cloned object
+   * to make it sane.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr fullclone() const;
+  //@}
+
+protected:
+
+  /** @name Standard Interfaced functions. */
+  //@{
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins.
+   */
+  virtual void doinitrun();
+
+  /**
+   * Finalize this object. Called in the run phase just after a
+   * run has ended. Used eg. to write out statistics.
+   */
+  virtual void dofinish();
+  //@}
+
+private:
+
+  /**
+   * The assignment operator is private and must never be called.
+   * In fact, it should not even be implemented.
+   */
+  DirectHepMCFile & operator=(const DirectHepMCFile &);
+
+private:
+
+  /**
+   * Last event that should be written out.
+   */
+  long theEventNumber;
+
+  /**
+   * The name of the output file.
+   */
+  string theFilename;
+
+  /**
+   * Selector for the choice of units.
+   */
+  int theUnitChoice;
+
+  /**
+   * The number of digits after the decimal point for floating point
+   * numbers.
+   */
+  unsigned int thePrecision;
+
+  /**
+   * If true, write and compress events in a separate thread.
+   */
+  bool theBackgroundWriting;
+
+  /**
+   * The output file.
+   */
+  CFile theFile;
+
+  /**
+   * The converter used for all events.
+   */
+  HepMCConverter<DirectHepMC::Event, DirectHepMC::Traits> theConverter;
+
+  /**
+   * The event record reused for all events.
+   */
+  DirectHepMC::Event theEvent;
+
+  /**
+   * The text of the event being formatted.
+   */
+  string theBuffer;
+
+  /**
+   * The text of the event waiting to be written by the writer thread.
+   */
+  string thePending;
+
+  /**
+   * The writer thread.
+   */
+  std::thread theWriter;
+
+  /**
+   * Protects thePending.
+   */
+  std::mutex theWriterMutex;
+
+  /**
+   * Signals changes in thePending.
+   */
+  std::condition_variable theWriterCondition;
+
+  /**
+   * Set to tell the writer thread to stop.
+   */
+  bool theWriterStop;
+
+public:
+
+  /** @cond EXCEPTIONCLASSES */
+  /** Exception class used if the output file could not be opened. */
+  class FileError: public Exception {};
+  /** @endcond */
+
+};
+
+}
+
+#endif /* THEPEG_DirectHepMCFile_H */
@@ -0,0 +1,202 @@
+// -*- C++ -*-
+//
+// EventProfiler.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+//
+// This is the implementation of the non-inlined, non-templated member
+// functions of the EventProfiler class.
+//
+
+#include "EventProfiler.h"
+#include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Repository/EventGenerator.h"
+#include "ThePEG/Handlers/EventHandler.h"
+#include "ThePEG/EventRecord/Event.h"
+#include "ThePEG/EventRecord/ColourLine.h"
+#include "ThePEG/EventRecord/SpinInfo.h"
+#include "ThePEG/Utilities/CacheStatistics.h"
+#include <cmath>
+
+using namespace ThePEG;
+
+EventProfiler::~EventProfiler() {}
+
+void EventProfiler::LogHistogram::fill(double x) {
+  ++n;
+  sum += x;
+  max = std::max(max, x);
+  int i = 0;
+  if ( x >= 1.0 ) {
+    std::frexp(x, &i);
+    i = std::min(i, int(bins.size()) - 1);
+  }
+  ++bins[i];
+}
+
+void EventProfiler::LogHistogram::print(ostream & os, double unit) const {
+  if ( n <= 0 ) return;
+  os << "    bins:";
+  for ( int i = 0, N = bins.size(); i < N; ++i ) {
+    if ( !bins[i] ) continue;
+    double lo = i > 0? std::ldexp(1.0, i - 1)*unit: 0.0;
+    os << " [" << lo << "," << std::ldexp(1.0, i)*unit << "[:" << bins[i];
+  }
+  os << endl;
+}
+
+template <typename T>
+void EventProfiler::addObjectStat(string name) {
+  ObjectStat s;
+  s.name = name;
+  s.size = sizeof(T);
+  s.created = &ObjectCounter<T>::created;
+  s.alive = &ObjectCounter<T>::alive;
+  s.last = ObjectCounter<T>::created();
+  s.maxAlive = 0;
+  objects.push_back(s);
+}
+
+void EventProfiler::analyze(tEventPtr event, long, int loop, int state) {
+  if ( loop > 0 || state != 0 || !event ) return;
+  ++nEvents;
+
+  double bytes = 0.0;
+  for ( int i = 0, N = objects.size(); i < N; ++i ) {
+    ObjectStat & s = objects[i];
+    unsigned long created = s.created();
+    s.perEvent.fill(created - s.last);
+    bytes += double(created - s.last)*s.size;
+    s.last = created;
+    s.maxAlive = std::max(s.maxAlive, s.alive());
+  }
+  bytesPerEvent.fill(bytes);
+
+  tEHPtr eh = generator()->eventHandler();
+  const EventHandler::StepTimeVector & times = eh->stepTimes();
+  for ( int i = 0, N = times.size(); i < N; ++i ) {
+    StepStat & s = steps[times[i].first];
+    s.eventTime += times[i].second;
+    ++s.eventCalls;
+  }
+  eh->clearStepTimes();
+  for ( map<tcStepHdlPtr,StepStat>::iterator it = steps.begin();
+	it != steps.end(); ++it ) {
+    StepStat & s = it->second;
+    if ( !s.eventCalls ) continue;
+    s.perEvent.fill(s.eventTime*1.0e6);
+    s.calls += s.eventCalls;
+    s.eventTime = 0.0;
+    s.eventCalls = 0;
+  }
+
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::chrono::duration<double,std::micro> dt = now - lastTime;
+  timePerEvent.fill(dt.count());
+  lastTime = now;
+}
+
+IBPtr EventProfiler::clone() const {
+  return new_ptr(*this);
+}
+
+IBPtr EventProfiler::fullclone() const {
+  return new_ptr(*this);
+}
+
+void EventProfiler::doinitrun() {
+  AnalysisHandler::doinitrun();
+  nEvents = 0;
+  objects.clear();
+  addObjectStat<Particle>("Particle");
+  addObjectStat<Particle::ParticleRep>("ParticleRep");
+  addObjectStat<Step>("Step");
+  addObjectStat<Collision>("Collision");
+  addObjectStat<SpinInfo>("SpinInfo");
+  addObjectStat<ColourLine>("ColourLine");
+  bytesPerEvent = LogHistogram();
+  steps.clear();
+  timePerEvent = LogHistogram();
+  generator()->eventHandler()->timeSteps(true);
+  lastTime = std::chrono::steady_clock::now();
+}
+
+void EventProfiler::dofinish() {
+  AnalysisHandler::dofinish();
+  generator()->eventHandler()->timeSteps(false);
+  if ( nEvents <= 0 ) return;
+
+  ostream & os = generator()->out();
+  os << endl << "EventProfiler " << name() << ": resources used in "
+     << nEvents << " events" << endl << endl;
+
+  os << "  Objects created per event (mean, max) and maximum number alive "
+     << "after an event:" << endl;
+  for ( int i = 0, N = objects.size(); i < N; ++i ) {
+    const ObjectStat & s = objects[i];
+    os << "  " << setw(12) << std::left << s.name << std::right
+       << setw(12) << s.perEvent.sum/s.perEvent.n
+       << setw(12) << s.perEvent.max << setw(12) << s.maxAlive
+       << "  (" << s.size << " bytes each)" << endl;
+    s.perEvent.print(os, 1.0);
+  }
+  os << "  Bytes created per event: " << bytesPerEvent.sum/bytesPerEvent.n
+     << " (mean), " << bytesPerEvent.max << " (max)" << endl;
+  bytesPerEvent.print(os, 1.0);
+
+  os << endl << "  Wall-clock time per event: "
+     << timePerEvent.sum/timePerEvent.n/1000.0 << " ms (mean), "
+     << timePerEvent.max/1000.0 << " ms (max)" << endl;
+  timePerEvent.print(os, 0.001);
+
+  vector< pair<double,tcStepHdlPtr> > order;
+  double total = 0.0;
+  for ( map<tcStepHdlPtr,StepStat>::const_iterator it = steps.begin();
+	it != steps.end(); ++it ) {
+    order.push_back(make_pair(it->second.perEvent.sum, it->first));
+    total += it->second.perEvent.sum;
+  }
+  std::sort(order.rbegin(), order.rend());
+  os << endl << "  Wall-clock time in StepHandlers per event (ms), "
+     << "calls per event and fraction of the total:" << endl;
+  for ( int i = 0, N = order.size(); i < N; ++i ) {
+    const StepStat & s = steps[order[i].second];
+    os << "  " << order[i].second->name() << endl
+       << "    mean: " << s.perEvent.sum/nEvents/1000.0
+       << " max: " << s.perEvent.max/1000.0
+       << " calls: " << double(s.calls)/nEvents
+       << " fraction: " << (total > 0.0? s.perEvent.sum/total: 0.0) << endl;
+    s.perEvent.print(os, 0.001);
+  }
+
+  bool header = true;
+  const ObjectSet & objs = tcEGPtr(generator())->objects();
+  for ( ObjectSet::const_iterator it = objs.begin(); it != objs.end(); ++it ) {
+    const CacheStatistics * c =
+      dynamic_cast<const CacheStatistics *>(&**it);
+    if ( !c || !c->cacheMisses() ) continue;
+    if ( header )
+      os << endl << "  Cached calculations (reused, calculated):" << endl;
+    header = false;
+    os << "  " << (**it).name() << ": " << c->cacheHits()
+       << ", " << c->cacheMisses() << endl;
+  }
+  os << endl;
+}
+
+NoPIOClassDescription<EventProfiler> EventProfiler::initEventProfiler;
+// Definition of the static class description member.
+
+void EventProfiler::Init() {
+
+  static ClassDocumentation<EventProfiler> documentation
+    ("The EventProfiler class does not perform an actual analysis. Instead "
+     "it records the number of event record objects created and the "
+     "wall-clock time spent in each StepHandler for each event, and writes "
+     "a summary with histograms of these quantities to the standard output "
+     "file at the end of the run.");
+
+}
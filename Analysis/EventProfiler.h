@@ -0,0 +1,266 @@
+// -*- C++ -*-
+//
+// EventProfiler.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef THEPEG_EventProfiler_H
+#define THEPEG_EventProfiler_H
+//
+// This is the declaration of the EventProfiler class.
+//
+
+#include "ThePEG/Handlers/AnalysisHandler.h"
+#include <chrono>
+
+namespace ThePEG {
+
+/**
+ * The EventProfiler class does not perform an actual analysis.
+ * Instead it monitors the resources used to generate each event. For
+ * every event it records the number of Particle, ParticleRep, Step,
+ * Collision, SpinInfo and ColourLine objects created (as counted by
+ * ObjectCounter), together with the corresponding number of bytes,
+ * and the wall-clock time spent in each StepHandler (as timed by the
+ * EventHandler). The distributions of these quantities are filled in
+ * histograms with logarithmic bins, and a summary is written to the
+ * standard output file when the run is finished. The summary also
+ * lists the number of times each object implementing the
+ * CacheStatistics interface, such as the helicity vertices, reused or
+ * calculated a cached result.
+ *
+ * Objects and times spent on events which were discarded are included
+ * in the next accepted event. Memory is counted as the number of
+ * objects times the size of the base class, which is a lower limit
+ * for objects of derived classes, and does not include memory
+ * allocated by the objects themselves.
+ *
+ * @see \ref EventProfilerInterfaces "The interfaces"
+ * defined for EventProfiler.
+ */
+class EventProfiler: public AnalysisHandler {
+
+public:
+
+  /** @name Standard constructors and destructors. */
+  //@{
+  /**
+   * The default constructor.
+   */
+  EventProfiler() : nEvents(0) {}
+
+  /**
+   * The destructor.
+   */
+  virtual ~EventProfiler();
+  //@}
+
+public:
+
+  /** @name Virtual functions required by the AnalysisHandler class. */
+  //@{
+  /**
+   * Analyze a given Event. Only fully generated events are
+   * considered. The object counts and step times accumulated since
+   * the previous event are recorded.
+   * @param event pointer to the Event to be analyzed.
+   * @param ieve the event number.
+   * @param loop the number of times this event has been presented.
+   * If negative the event is now fully generated.
+   * @param state a number different from zero if the event has been
+   * manipulated in some way since it was last presented.
+   */
+  virtual void analyze(tEventPtr event, long ieve, int loop, int state);
+  //@}
+
+public:
+
+  /**
+   * The standard Init function used to initialize the interfaces.
+   * Called exactly once for each class by the class description system
+   * before the main function starts or
+   * when this class is dynamically loaded.
+   */
+  static void Init();
+
+protected:
+
+  /** @name Clone Methods. */
+  //@{
+  /**
+   * Make a simple clone of this object.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr clone() const;
+
+  /** Make a clone of this object, possibly modifying the cloned object
+   * to make it sane.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr fullclone() const;
+  //@}
+
+protected:
+
+  /** @name Standard Interfaced functions. */
+  //@{
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins.
+   */
+  virtual void doinitrun();
+
+  /**
+   * Finalize this object. Called in the run phase just after a
+   * run has ended. Used eg. to write out statistics.
+   */
+  virtual void dofinish();
+  //@}
+
+private:
+
+  /**
+   * A histogram with logarithmic bins, where bin 0 contains values
+   * below 1 and bin i > 0 contains values in [2^(i-1), 2^i[.
+   */
+  struct LogHistogram {
+    /** Constructor. */
+    LogHistogram() : n(0), sum(0.0), max(0.0), bins(64, 0) {}
+    /** Add a value. */
+    void fill(double x);
+    /** Write out the mean, maximum and the non-empty bins. */
+    void print(ostream & os, double unit) const;
+    /** The number of entries. */
+    long n;
+    /** The sum of the values. */
+    double sum;
+    /** The largest value. */
+    double max;
+    /** The bins. */
+    vector<long> bins;
+  };
+
+  /**
+   * The counters and statistics for one class of event record objects.
+   */
+  struct ObjectStat {
+    /** The name of the class. */
+    string name;
+    /** The size of an object. */
+    std::size_t size;
+    /** Function returning the number of objects created so far. */
+    unsigned long (*created)();
+    /** Function returning the number of objects currently alive. */
+    unsigned long (*alive)();
+    /** The number of objects created at the previous event. */
+    unsigned long last;
+    /** The largest number of objects alive at the end of an event. */
+    unsigned long maxAlive;
+    /** The number of objects created per event. */
+    LogHistogram perEvent;
+  };
+
+  /**
+   * The statistics for one StepHandler.
+   */
+  struct StepStat {
+    /** Constructor. */
+    StepStat() : calls(0), eventTime(0.0), eventCalls(0) {}
+    /** The total number of calls. */
+    long calls;
+    /** The time spent in the current event. */
+    double eventTime;
+    /** The number of calls in the current event. */
+    long eventCalls;
+    /** The time in microseconds spent per event. */
+    LogHistogram perEvent;
+  };
+
+  /**
+   * Add the statistics for event record objects of type \a T.
+   */
+  template <typename T>
+  void addObjectStat(string name);
+
+  /**
+   * The number of events analyzed.
+   */
+  long nEvents;
+
+  /**
+   * The statistics for each type of event record object.
+   */
+  vector<ObjectStat> objects;
+
+  /**
+   * The number of bytes of event record objects created per event.
+   */
+  LogHistogram bytesPerEvent;
+
+  /**
+   * The statistics for each StepHandler.
+   */
+  map<tcStepHdlPtr,StepStat> steps;
+
+  /**
+   * The wall-clock time in microseconds between subsequent events.
+   */
+  LogHistogram timePerEvent;
+
+  /**
+   * The time when the previous event was analyzed.
+   */
+  std::chrono::steady_clock::time_point lastTime;
+
+private:
+
+  /**
+   * The static object used to initialize the description of this class.
+   * Indicates that this is a concrete class without persistent data.
+   */
+  static NoPIOClassDescription<EventProfiler> initEventProfiler;
+
+  /**
+   * The assignment operator is private and must never be called.
+   * In fact, it should not even be implemented.
+   */
+  EventProfiler & operator=(const EventProfiler &);
+
+};
+
+}
+
+#include "ThePEG/Utilities/ClassTraits.h"
+
+namespace ThePEG {
+
+/** @cond TRAITSPECIALIZATIONS */
+
+/** This template specialization informs ThePEG about the
+ *  base classes of EventProfiler. */
+template <>
+struct BaseClassTrait<EventProfiler,1> {
+  /** Typedef of the first base class of EventProfiler. */
+  typedef AnalysisHandler NthBase;
+};
+
+/** This template specialization informs ThePEG about the name of
+ *  the EventProfiler class and the shared object where it is defined. */
+template <>
+struct ClassTraits<EventProfiler>
+  : public ClassTraitsBase<EventProfiler> {
+  /** Return a platform-independent class name */
+  static string className() { return "ThePEG::EventProfiler"; }
+  /** Return the name of the shared library be loaded to get
+   *  access to the EventProfiler class and every other class it uses
+   *  (except the base class). */
+  static string library() { return "EventProfiler.so"; }
+};
+
+/** @endcond */
+
+}
+
+#endif /* THEPEG_EventProfiler_H */
@@ -20,7 +20,6 @@
 #include "ThePEG/Repository/EventGenerator.h"
 #include "ThePEG/Persistency/PersistentOStream.h"
 #include "ThePEG/Persistency/PersistentIStream.h"
-#include "ThePEG/Config/HepMCHelper.h"
 #include "HepMC/IO_GenEvent.h"
 #include "HepMC/IO_AsciiParticles.h"
 
@@ -79,6 +78,7 @@ void HepMCFile::dofinish() {
   }
   else
     _hepmcdump.close();
+  _hepmcevent.clear();
   AnalysisHandler::dofinish();
   cout << "\nHepMCFile: generated HepMC output.\n";
 }
@@ -95,14 +95,11 @@ void HepMCFile::analyze(tEventPtr event, long, int, int) {
   case 3:  eUnit = MeV; lUnit = centimeter; break;
   }
 
-  HepMC::GenEvent * hepmc 
-    = HepMCConverter<HepMC::GenEvent>::convert(*event, false,
-					       eUnit, lUnit);
+  _converter.fill(*event, _hepmcevent, false, eUnit, lUnit);
   if (_hepmcio)
-    _hepmcio->write_event(hepmc);
+    _hepmcio->write_event(&_hepmcevent);
   else
-    hepmc->print(_hepmcdump);
-  delete hepmc;
+    _hepmcevent.print(_hepmcdump);
 }
 
 void HepMCFile::persistentOutput(PersistentOStream & os) const {
@@ -16,6 +16,7 @@
 #include "ThePEG/Handlers/AnalysisHandler.h"
 #include "ThePEG/Repository/CurrentGenerator.h"
 #include "ThePEG/Repository/EventGenerator.h"
+#include "ThePEG/Config/HepMCHelper.h"
 #include "HepMC/IO_BaseClass.h"
 
 namespace ThePEG {
@@ -177,6 +178,16 @@ private:
    * Choice of output precision in GenEvent format
    */
   unsigned int _geneventPrecision;
+
+  /**
+   * The converter used for all events.
+   */
+  HepMCConverter<HepMC::GenEvent> _converter;
+
+  /**
+   * The GenEvent reused for all events.
+   */
+  HepMC::GenEvent _hepmcevent;
 };
 
 }
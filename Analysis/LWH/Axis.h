@@ -35,13 +35,14 @@ public:
    * Standard constructor.
    */
   Axis(int n, double lo, double up)
-    : lower(lo), upper(up), nbins(n) {}
+    : lower(lo), upper(up), nbins(n), invwidth(double(n)/(up - lo)) {}
 
   /**
    * Copy constructor.
    */
   Axis(const Axis & a)
-    : IAxis(a), lower(a.lower), upper(a.upper), nbins(a.nbins) {}
+    : IAxis(a), lower(a.lower), upper(a.upper), nbins(a.nbins),
+      invwidth(a.invwidth) {}
 
   /// Destructor.
   virtual ~Axis() { }
@@ -124,7 +125,8 @@ public:
   int coordToIndex(double coord) const {
     if ( coord >= upper ) return OVERFLOW_BIN;
     else if ( coord < lower ) return UNDERFLOW_BIN;
-    else return int((coord - lower)/binWidth(0));
+    // Rounding may give nbins for coordinates just below the upper edge.
+    else return std::min(int((coord - lower)*invwidth), nbins - 1);
   }
 
   /**
@@ -146,6 +148,9 @@ private:
   /** The number of bins. */
   int nbins;
 
+  /** The inverse bin width. */
+  double invwidth;
+
 };
 
 }
@@ -62,7 +62,7 @@ public:
       fax(0), vax(0), sum(h.sum), sumw(h.sumw), sumw2(h.sumw2),
       sumxw(h.sumxw), sumx2w(h.sumx2w) {
     const VariAxis * hvax = dynamic_cast<const VariAxis *>(h.ax);
-    if ( vax ) ax = vax = new VariAxis(*hvax);
+    if ( hvax ) ax = vax = new VariAxis(*hvax);
     else ax = fax = new Axis(dynamic_cast<const Axis &>(*h.ax));
 }
 
@@ -236,7 +236,8 @@ public:
    * @return false If the weight is <0 or >1 (?).
    */
   bool fill(double x, double weight = 1.) {
-    int i = ax->coordToIndex(x) + 2;
+    int i = ( fax? fax->Axis::coordToIndex(x):
+	      vax->VariAxis::coordToIndex(x) ) + 2;
     ++sum[i];
     sumw[i] += weight;
     sumxw[i] += x*weight;
@@ -245,6 +246,33 @@ public:
     return weight >= 0 && weight <= 1;
   }
 
+  /**
+   * Fill the IHistogram1D with \a n values and the corresponding
+   * weights. The type of axis is only checked once for all values.
+   * @param x      The \a n values to be filled in.
+   * @param w      The \a n corresponding weights. If null, all
+   *               weights are 1.
+   * @param n      The number of values.
+   * @return false If any weight is <0 or >1 (?).
+   */
+  bool fill(const double * x, const double * w, std::size_t n) {
+    return fax? fillAll(*fax, x, w, n): fillAll(*vax, x, w, n);
+  }
+
+  /**
+   * Fill the IHistogram1D with the values \a x and the corresponding
+   * weights \a w, which must either be empty (all weights are 1) or
+   * have the same size as \a x.
+   * @return false If any weight is <0 or >1 (?).
+   */
+  bool fill(const std::vector<double> & x, const std::vector<double> & w) {
+    if ( !w.empty() && w.size() != x.size() )
+      throw std::runtime_error("LWH::Histogram1D::fill: "
+			       "values and weights have different sizes");
+    if ( x.empty() ) return true;
+    return fill(&x[0], w.empty()? 0: &w[0], x.size());
+  }
+
   /**
    * The weighted mean of a bin. 
    * @param index The bin number (0...N-1) or OVERFLOW or UNDERFLOW.
@@ -486,6 +514,27 @@ public:
 
 private:
 
+  /**
+   * Fill \a n values \a x with weights \a w (or 1 if null) using
+   * the axis \a a without virtual function calls.
+   */
+  template <typename AxisT>
+  bool fillAll(const AxisT & a, const double * x, const double * w,
+	       std::size_t n) {
+    bool ok = true;
+    for ( std::size_t k = 0; k < n; ++k ) {
+      double weight = w? w[k]: 1.0;
+      int i = a.AxisT::coordToIndex(x[k]) + 2;
+      ++sum[i];
+      sumw[i] += weight;
+      sumxw[i] += x[k]*weight;
+      sumx2w[i] += x[k]*x[k]*weight;
+      sumw2[i] += weight*weight;
+      ok = ok && weight >= 0 && weight <= 1;
+    }
+    return ok;
+  }
+
   /** The title */
   std::string theTitle;
 
@@ -37,13 +37,7 @@ namespace LWH {
     Histogram2D(int nx, double lox, double upx,
 		int ny, double loy, double upy)
       : xfax(new Axis(nx, lox, upx)), xvax(0), yfax(new Axis(ny, loy, upy)),
-	sum(nx + 2, std::vector<int>(ny + 2)),
-	sumw(nx + 2, std::vector<double>(ny + 2)),
-	sumw2(nx + 2, std::vector<double>(ny + 2)),
-	sumxw(nx + 2, std::vector<double>(ny + 2)),
-	sumx2w(nx + 2, std::vector<double>(ny + 2)),
-	sumyw(nx + 2, std::vector<double>(ny + 2)),
-	sumy2w(nx + 2, std::vector<double>(ny + 2)) {
+	yvax(0), nyb(ny + 2), bins((nx + 2)*(ny + 2)) {
       xax = xfax;
       yax = yfax;
     }
@@ -54,14 +48,8 @@ namespace LWH {
     Histogram2D(const std::vector<double> & xedges,
 		const std::vector<double> & yedges)
       : xfax(0), xvax(new VariAxis(xedges)),
-	yfax(0), yvax(new VariAxis(xedges)),
-        sum(xedges.size() + 1, std::vector<int>(yedges.size() + 1)),
-	sumw(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-	sumw2(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-        sumxw(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-	sumx2w(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-        sumyw(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-	sumy2w(xedges.size() + 1, std::vector<double>(yedges.size() + 1)) {
+	yfax(0), yvax(new VariAxis(yedges)), nyb(yedges.size() + 1),
+	bins((xedges.size() + 1)*(yedges.size() + 1)) {
       xax = xvax;
       yax = yvax;
     }
@@ -71,10 +59,7 @@ namespace LWH {
      */
     Histogram2D(const Histogram2D & h)
       : IBaseHistogram(h), IHistogram(h), IHistogram2D(h), ManagedObject(h),
-        xfax(0), xvax(0),  yfax(0), yvax(0),
-	sum(h.sum), sumw(h.sumw), sumw2(h.sumw2),
-        sumxw(h.sumxw), sumx2w(h.sumx2w) ,
-        sumyw(h.sumyw), sumy2w(h.sumy2w){
+        xfax(0), xvax(0),  yfax(0), yvax(0), nyb(h.nyb), bins(h.bins) {
       const VariAxis * hxvax = dynamic_cast<const VariAxis *>(h.xax);
       if ( hxvax ) xax = xvax = new VariAxis(*hxvax);
       else xax = xfax = new Axis(dynamic_cast<const Axis &>(*h.xax));
@@ -144,15 +129,7 @@ namespace LWH {
      * @return false If something goes wrong.
      */
     bool reset() {
-      const int nx = xax->bins() + 2;
-      const int ny = yax->bins() + 2;
-      sum = std::vector< std::vector<int> >(nx, std::vector<int>(ny));
-      sumw = std::vector< std::vector<double> >(nx, std::vector<double>(ny));
-      sumw2 = sumw;
-      sumxw = sumw;
-      sumx2w = sumw;
-      sumyw = sumw;
-      sumy2w = sumw;
+      bins.assign(bins.size(), Bin());
       return true;
     }
 
@@ -164,7 +141,7 @@ namespace LWH {
     int entries() const {
       int si = 0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) si += sum[ix][iy];
+	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) si += bin(ix, iy).sum;
       return si;
     }
 
@@ -184,11 +161,11 @@ namespace LWH {
      * @return The number of entries outside the range of the IHistogram.
      */
     int extraEntries() const {
-      int esum = sum[0][0] + sum[1][0] + sum[0][1] + sum[1][1];
+      int esum = bin(0, 0).sum + bin(1, 0).sum + bin(0, 1).sum + bin(1, 1).sum;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	esum += sum[ix][0] + sum[ix][1];
+	esum += bin(ix, 0).sum + bin(ix, 1).sum;
       for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	esum += sum[0][iy] + sum[1][iy];
+	esum += bin(0, iy).sum + bin(1, iy).sum;
       return esum;
     }
 
@@ -202,8 +179,8 @@ namespace LWH {
       double sw2 = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-	  sw += sumw[ix][iy];
-	  sw2 += sumw2[ix][iy];
+	  sw += bin(ix, iy).sumw;
+	  sw2 += bin(ix, iy).sumw2;
 	}
       return sw2/(sw*sw);
     }
@@ -217,7 +194,7 @@ namespace LWH {
     double sumBinHeights() const {
       double sw = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) sw += sumw[ix][iy];
+	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) sw += bin(ix, iy).sumw;
       return sw;
     }
 
@@ -235,11 +212,11 @@ namespace LWH {
      * @return The sum of the heights of the out-of-range bins.
      */
     double sumExtraBinHeights() const {
-      int esum = sumw[0][0] + sumw[1][0] + sumw[0][1] + sumw[1][1];
+      int esum = bin(0, 0).sumw + bin(1, 0).sumw + bin(0, 1).sumw + bin(1, 1).sumw;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	esum += sumw[ix][0] + sumw[ix][1];
+	esum += bin(ix, 0).sumw + bin(ix, 1).sumw;
       for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	esum += sumw[0][iy] + sumw[1][iy];
+	esum += bin(0, iy).sumw + bin(1, iy).sumw;
       return esum;
     }
 
@@ -249,10 +226,10 @@ namespace LWH {
      * @return The minimum height among the in-range bins.
      */
     double minBinHeight() const {
-      double minw = sumw[2][2];
+      double minw = bin(2, 2).sumw;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	  minw = std::min(minw, sumw[ix][iy]);
+	  minw = std::min(minw, bin(ix, iy).sumw);
       return minw;
     }
 
@@ -262,10 +239,10 @@ namespace LWH {
      * @return The maximum height among the in-range bins.
      */
     double maxBinHeight() const{
-      double maxw = sumw[2][2];
+      double maxw = bin(2, 2).sumw;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	  maxw = std::max(maxw, sumw[ix][iy]);
+	  maxw = std::max(maxw, bin(ix, iy).sumw);
       return maxw;
     }
 
@@ -277,15 +254,18 @@ namespace LWH {
      * @return false If the weight is <0 or >1 (?).
      */
     bool fill(double x, double y, double weight = 1.) {
-      int ix = xax->coordToIndex(x) + 2;
-      int iy = yax->coordToIndex(y) + 2;
-      ++sum[ix][iy];
-      sumw[ix][iy] += weight;
-      sumxw[ix][iy] += x*weight;
-      sumx2w[ix][iy] += x*x*weight;
-      sumyw[ix][iy] += y*weight;
-      sumy2w[ix][iy] += y*y*weight;
-      sumw2[ix][iy] += weight*weight;
+      int ix = ( xfax? xfax->Axis::coordToIndex(x):
+		 xvax->VariAxis::coordToIndex(x) ) + 2;
+      int iy = ( yfax? yfax->Axis::coordToIndex(y):
+		 yvax->VariAxis::coordToIndex(y) ) + 2;
+      Bin & b = bin(ix, iy);
+      ++b.sum;
+      b.sumw += weight;
+      b.sumxw += x*weight;
+      b.sumx2w += x*x*weight;
+      b.sumyw += y*weight;
+      b.sumy2w += y*y*weight;
+      b.sumw2 += weight*weight;
       return weight >= 0 && weight <= 1;
     }
 
@@ -298,7 +278,7 @@ namespace LWH {
     double binMeanX(int xindex, int yindex) const {
       int ix = xindex + 2;
       int iy = yindex + 2;
-      return sumw[ix][iy] != 0.0? sumxw[ix][iy]/sumw[ix][iy]:
+      return bin(ix, iy).sumw != 0.0? bin(ix, iy).sumxw/bin(ix, iy).sumw:
         ( xvax? xvax->binMidPoint(xindex): xfax->binMidPoint(xindex) );
     };
 
@@ -311,7 +291,7 @@ namespace LWH {
     double binMeanY(int xindex, int yindex) const {
       int ix = xindex + 2;
       int iy = yindex + 2;
-      return sumw[ix][iy] != 0.0? sumyw[ix][iy]/sumw[ix][iy]:
+      return bin(ix, iy).sumw != 0.0? bin(ix, iy).sumyw/bin(ix, iy).sumw:
         ( yvax? yvax->binMidPoint(yindex): xfax->binMidPoint(yindex) );
     };
 
@@ -324,9 +304,9 @@ namespace LWH {
     double binRmsX(int xindex, int yindex) const {
       int ix = xindex + 2;
       int iy = yindex + 2;
-      return sumw[ix][iy] == 0.0 || sum[ix][iy] < 2? xax->binWidth(xindex):
-        std::sqrt(std::max(sumw[ix][iy]*sumx2w[ix][iy] -
-			   sumxw[ix][iy]*sumxw[ix][iy], 0.0))/sumw[ix][iy];
+      return bin(ix, iy).sumw == 0.0 || bin(ix, iy).sum < 2? xax->binWidth(xindex):
+        std::sqrt(std::max(bin(ix, iy).sumw*bin(ix, iy).sumx2w -
+			   bin(ix, iy).sumxw*bin(ix, iy).sumxw, 0.0))/bin(ix, iy).sumw;
     };
 
     /**
@@ -338,9 +318,9 @@ namespace LWH {
     double binRmsY(int xindex, int yindex) const {
       int ix = xindex + 2;
       int iy = yindex + 2;
-      return sumw[ix][iy] == 0.0 || sum[ix][iy] < 2? yax->binWidth(yindex):
-        std::sqrt(std::max(sumw[ix][iy]*sumy2w[ix][iy] -
-			   sumyw[ix][iy]*sumyw[ix][iy], 0.0))/sumw[ix][iy];
+      return bin(ix, iy).sumw == 0.0 || bin(ix, iy).sum < 2? yax->binWidth(yindex):
+        std::sqrt(std::max(bin(ix, iy).sumw*bin(ix, iy).sumy2w -
+			   bin(ix, iy).sumyw*bin(ix, iy).sumyw, 0.0))/bin(ix, iy).sumw;
     };
 
     /**
@@ -350,7 +330,7 @@ namespace LWH {
      * @return      The number of entries in the corresponding bin.
      */
     int binEntries(int xindex, int yindex) const {
-      return sum[xindex + 2][yindex + 2];
+      return bin(xindex + 2, yindex + 2).sum;
     }
 
     /**
@@ -363,7 +343,7 @@ namespace LWH {
     virtual int binEntriesX(int index) const {
       int ret = 0;
       for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	ret += sum[index + 2][iy];
+	ret += bin(index + 2, iy).sum;
       return ret;
     }
 
@@ -377,7 +357,7 @@ namespace LWH {
     virtual int binEntriesY(int index) const {
       int ret = 0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	ret += sum[ix][index + 2];
+	ret += bin(ix, index + 2).sum;
       return ret;
     }
 
@@ -390,7 +370,7 @@ namespace LWH {
     double binHeight(int xindex, int yindex) const {
       /// @todo While this is compatible with the reference AIDA
       /// implementation, it is not the bin height!
-      return sumw[xindex + 2][yindex + 2];
+      return bin(xindex + 2, yindex + 2).sumw;
     }
 
     /**
@@ -403,7 +383,7 @@ namespace LWH {
     virtual double binHeightX(int index) const {
       double ret = 0;
       for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	ret += sumw[index + 2][iy];
+	ret += bin(index + 2, iy).sumw;
       return ret;
     }
 
@@ -417,7 +397,7 @@ namespace LWH {
     virtual double binHeightY(int index) const {
       double ret = 0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	ret += sumw[ix][index + 2];
+	ret += bin(ix, index + 2).sumw;
       return ret;
     }
 
@@ -428,7 +408,7 @@ namespace LWH {
      *
      */
     double binError(int xindex, int yindex) const {
-      return std::sqrt(sumw2[xindex + 2][yindex + 2]);
+      return std::sqrt(bin(xindex + 2, yindex + 2).sumw2);
     }
 
     /**
@@ -441,8 +421,8 @@ namespace LWH {
       double sx = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-        s += sumw[ix][iy];
-        sx += sumxw[ix][iy];
+        s += bin(ix, iy).sumw;
+        sx += bin(ix, iy).sumxw;
       }
       return s != 0.0? sx/s: 0.0;
     }
@@ -457,8 +437,8 @@ namespace LWH {
       double sy = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-        s += sumw[ix][iy];
-        sy += sumyw[ix][iy];
+        s += bin(ix, iy).sumw;
+        sy += bin(ix, iy).sumyw;
       }
       return s != 0.0? sy/s: 0.0;
     }
@@ -474,9 +454,9 @@ namespace LWH {
       double sx2 = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-        s += sumw[ix][iy];
-        sx += sumxw[ix][iy];
-        sx2 += sumx2w[ix][iy];
+        s += bin(ix, iy).sumw;
+        sx += bin(ix, iy).sumxw;
+        sx2 += bin(ix, iy).sumx2w;
       }
       return s != 0.0? std::sqrt(std::max(s*sx2 - sx*sx, 0.0))/s:
         xax->upperEdge() - xax->lowerEdge();
@@ -493,9 +473,9 @@ namespace LWH {
       double sy2 = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-        s += sumw[ix][iy];
-        sy += sumyw[ix][iy];
-        sy2 += sumy2w[ix][iy];
+        s += bin(ix, iy).sumw;
+        sy += bin(ix, iy).sumyw;
+        sy2 += bin(ix, iy).sumy2w;
       }
       return s != 0.0? std::sqrt(std::max(s*sy2 - sy*sy, 0.0))/s:
         yax->upperEdge() - yax->lowerEdge();
@@ -503,32 +483,32 @@ namespace LWH {
 
     /** The weights. */
     double getSumW(int xindex, int yindex) const {
-        return sumw[xindex + 2][yindex + 2];
+        return bin(xindex + 2, yindex + 2).sumw;
     }
 
     /** The squared weights. */
     double getSumW2(int xindex, int yindex) const {
-        return sumw2[xindex + 2][yindex + 2];
+        return bin(xindex + 2, yindex + 2).sumw2;
     }
 
     /** The weighted x-values. */
     double getSumXW(int xindex, int yindex) const {
-        return sumxw[xindex + 2][yindex + 2];
+        return bin(xindex + 2, yindex + 2).sumxw;
     }
 
     /** The weighted x-square-values. */
     double getSumX2W(int xindex, int yindex) const {
-        return sumx2w[xindex + 2][yindex + 2];
+        return bin(xindex + 2, yindex + 2).sumx2w;
     }
     
     /** The weighted x-values. */
     double getSumYW(int xindex, int yindex) const {
-        return sumyw[xindex + 2][yindex + 2];
+        return bin(xindex + 2, yindex + 2).sumyw;
     }
 
     /** The weighted x-square-values. */
     double getSumY2W(int xindex, int yindex) const {
-        return sumy2w[xindex + 2][yindex + 2];
+        return bin(xindex + 2, yindex + 2).sumy2w;
     }
     
     /**
@@ -581,16 +561,17 @@ namespace LWH {
       if ( yax->upperEdge() != h.yax->upperEdge() ||
 	   yax->lowerEdge() != h.yax->lowerEdge() ||
 	   yax->bins() != h.yax->bins() ) return false;
-      for ( int ix = 0; ix < xax->bins() + 2; ++ix )
-	for ( int iy = 0; iy < yax->bins() + 2; ++iy ) {
-	  sum[ix][iy] += h.sum[ix][iy];
-	  sumw[ix][iy] += h.sumw[ix][iy];
-	  sumxw[ix][iy] += h.sumxw[ix][iy];
-	  sumx2w[ix][iy] += h.sumx2w[ix][iy];
-	  sumyw[ix][iy] += h.sumyw[ix][iy];
-	  sumy2w[ix][iy] += h.sumy2w[ix][iy];
-	  sumw2[ix][iy] += h.sumw2[ix][iy];
-	}
+      for ( int i = 0, N = bins.size(); i < N; ++i ) {
+	const Bin & hb = h.bins[i];
+	Bin & b = bins[i];
+	b.sum += hb.sum;
+	b.sumw += hb.sumw;
+	b.sumxw += hb.sumxw;
+	b.sumx2w += hb.sumx2w;
+	b.sumyw += hb.sumyw;
+	b.sumy2w += hb.sumy2w;
+	b.sumw2 += hb.sumw2;
+      }
       return true;
     }
 
@@ -608,14 +589,14 @@ namespace LWH {
      * @param s the scaling factor to use.
      */
     bool scale(double s) {
-      for ( int ix = 0; ix < xax->bins() + 2; ++ix )
-	for ( int iy = 0; iy < yax->bins() + 2; ++iy ) {
-	  sumw[ix][iy] *= s;
-	  sumxw[ix][iy] *= s;
-	  sumx2w[ix][iy] *= s;
-	  sumyw[ix][iy] *= s;
-	  sumy2w[ix][iy] *= s;
-	  sumw2[ix][iy] *= s*s;
+      for ( int i = 0, N = bins.size(); i < N; ++i ) {
+	Bin & b = bins[i];
+	b.sumw *= s;
+	b.sumxw *= s;
+	b.sumx2w *= s;
+	b.sumyw *= s;
+	b.sumy2w *= s;
+	b.sumw2 *= s*s;
       }
       return true;
     }
@@ -636,12 +617,12 @@ namespace LWH {
 	  if ( ix >= 2 && iy >= 2 )
 	    fac /= (xax->binUpperEdge(ix - 2) - xax->binLowerEdge(ix - 2))*
 	      (yax->binUpperEdge(iy - 2) - yax->binLowerEdge(iy - 2));
-        sumw[ix][iy] *= fac;
-        sumxw[ix][iy] *= fac;
-        sumx2w[ix][iy] *= fac;
-        sumyw[ix][iy] *= fac;
-        sumy2w[ix][iy] *= fac;
-        sumw2[ix][iy] *= fac*fac;
+        bin(ix, iy).sumw *= fac;
+        bin(ix, iy).sumxw *= fac;
+        bin(ix, iy).sumx2w *= fac;
+        bin(ix, iy).sumyw *= fac;
+        bin(ix, iy).sumy2w *= fac;
+        bin(ix, iy).sumw2 *= fac*fac;
       }
     }
 
@@ -655,7 +636,7 @@ namespace LWH {
 
     // is this right? Leave out bin width factor?
 
-    //     intg += sumw[ix][iy]*(ax->binUpperEdge(i - 2) - ax->binLowerEdge(i - 2));
+    //     intg += bin(ix, iy).sumw*(ax->binUpperEdge(i - 2) - ax->binLowerEdge(i - 2));
     //   return intg;
     // }
 
@@ -707,7 +688,7 @@ namespace LWH {
          << "\"/>\n    </statistics>\n    <data2d>\n";
       for ( int ix = 0; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 0; iy < yax->bins() + 2; ++iy )
-	  if ( sum[ix][iy] ) {
+	  if ( bin(ix, iy).sum ) {
 	    os << "      <bin2d binNumX=\"";
 	    if ( ix == 0 ) os << "UNDERFLOW";
 	    else if ( ix == 1 ) os << "OVERFLOW";
@@ -716,10 +697,10 @@ namespace LWH {
 	    if ( iy == 0 ) os << "UNDERFLOW";
 	    else if ( iy == 1 ) os << "OVERFLOW";
 	    else os << iy - 2;
-	    os << "\" entries=\"" << sum[ix][iy]
-	       << "\" height=\"" << sumw[ix][iy]
-	       << "\"\n        error=\"" << std::sqrt(sumw2[ix][iy])
-	       << "\" error2=\"" << sumw2[ix][iy]
+	    os << "\" entries=\"" << bin(ix, iy).sum
+	       << "\" height=\"" << bin(ix, iy).sumw
+	       << "\"\n        error=\"" << std::sqrt(bin(ix, iy).sumw2)
+	       << "\" error2=\"" << bin(ix, iy).sumw2
 	       << "\"\n        weightedMeanX=\"" << binMeanX(ix - 2, iy - 2)
 	       << "\" weightedRmsX=\"" << binRmsX(ix - 2, iy - 2)
 	       << "\"\n        weightedMeanY=\"" << binMeanY(ix - 2, iy - 2)
@@ -744,8 +725,8 @@ namespace LWH {
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy )
 	  os << 0.5*(xax->binLowerEdge(ix - 2)+xax->binUpperEdge(ix - 2)) << " "
 	     << 0.5*(yax->binLowerEdge(iy - 2)+yax->binUpperEdge(iy - 2))
-	     << " " << sumw[ix][iy] << " " << sqrt(sumw2[ix][iy])
-	     << " " << sum[ix][iy] << std::endl;
+	     << " " << bin(ix, iy).sumw << " " << sqrt(bin(ix, iy).sumw2)
+	     << " " << bin(ix, iy).sum << std::endl;
 	os << std::endl;
       }
       os << std::endl;
@@ -783,16 +764,16 @@ namespace LWH {
 
       double entries = 0;
       for ( int i = 0; i < nbins + 2; ++i ) {
-        if ( sum[ix][iy] ) {
+        if ( bin(ix, iy).sum ) {
           //i==0: underflow->RootBin(0), i==1: overflow->RootBin(NBins+1)
-          entries = entries + sum[ix][iy];
+          entries = entries + bin(ix, iy).sum;
           int j=i;
           if (i==0) j=0; //underflow
           else if (i==1) j=nbins+1; //overflow
           if (i>=2) j=i-1; //normal bin entries
-          hist1d->SetBinContent(j, sumw[ix][iy]);
-          hist1d->SetBinError(j, sqrt(sumw2[ix][iy]));
-          //hist1d->Fill(binMean(i), sumw[ix][iy]);
+          hist1d->SetBinContent(j, bin(ix, iy).sumw);
+          hist1d->SetBinError(j, sqrt(bin(ix, iy).sumw2));
+          //hist1d->Fill(binMean(i), bin(ix, iy).sumw);
         }
       }
 
@@ -837,26 +818,52 @@ namespace LWH {
     /** Pointer (possibly null) to a axis with fixed bin width. */
     VariAxis * yvax;
 
-    /** The counts. */
-    std::vector< std::vector<int> > sum;
-
-    /** The weights. */
-    std::vector< std::vector<double> > sumw;
-
-    /** The squared weights. */
-    std::vector< std::vector<double> > sumw2;
+    /**
+     * The accumulated contents of one bin.
+     */
+    struct Bin {
+      /** Default constructor. */
+      Bin()
+	: sum(0), sumw(0.0), sumw2(0.0), sumxw(0.0), sumx2w(0.0),
+	  sumyw(0.0), sumy2w(0.0) {}
+      /** The counts. */
+      int sum;
+      /** The weights. */
+      double sumw;
+      /** The squared weights. */
+      double sumw2;
+      /** The weighted x-values. */
+      double sumxw;
+      /** The weighted x-square-values. */
+      double sumx2w;
+      /** The weighted y-values. */
+      double sumyw;
+      /** The weighted y-square-values. */
+      double sumy2w;
+    };
 
-    /** The weighted x-values. */
-    std::vector< std::vector<double> > sumxw;
+    /**
+     * Access the bin with internal indices \a ix and \a iy, where
+     * 0 and 1 are the underflow and overflow bins.
+     */
+    Bin & bin(int ix, int iy) {
+      return bins[ix*nyb + iy];
+    }
 
-    /** The weighted x-square-values. */
-    std::vector< std::vector<double> > sumx2w;
+    /**
+     * Access the bin with internal indices \a ix and \a iy, where
+     * 0 and 1 are the underflow and overflow bins.
+     */
+    const Bin & bin(int ix, int iy) const {
+      return bins[ix*nyb + iy];
+    }
 
-    /** The weighted y-values. */
-    std::vector< std::vector<double> > sumyw;
+    /** The number of y-bins including underflow and overflow. */
+    int nyb;
 
-    /** The weighted y-square-values. */
-    std::vector< std::vector<double> > sumy2w;
+    /** The contents of all bins in one contiguous buffer, with the
+     *  y-index running fastest. */
+    std::vector<Bin> bins;
 
     /** dummy pointer to non-existen annotation. */
     IAnnotation * anno;
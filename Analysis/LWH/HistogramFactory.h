@@ -696,13 +696,13 @@ public:
     h->setTitle(path.substr(path.rfind('/') + 1));
     for ( int ix = 0; ix < h->xax->bins() + 2; ++ix )
       for ( int iy = 0; iy < h->yax->bins() + 2; ++iy ) {
-	h->sum[ix][iy] += h2.sum[ix][iy];
-	h->sumw[ix][iy] -= h2.sumw[ix][iy];
-	h->sumw2[ix][iy] += h2.sumw2[ix][iy];
-	h->sumxw[ix][iy] -= h2.sumxw[ix][iy];
-	h->sumx2w[ix][iy] -= h2.sumx2w[ix][iy];
-	h->sumyw[ix][iy] -= h2.sumyw[ix][iy];
-	h->sumy2w[ix][iy] -= h2.sumy2w[ix][iy];
+	h->bin(ix, iy).sum += h2.bin(ix, iy).sum;
+	h->bin(ix, iy).sumw -= h2.bin(ix, iy).sumw;
+	h->bin(ix, iy).sumw2 += h2.bin(ix, iy).sumw2;
+	h->bin(ix, iy).sumxw -= h2.bin(ix, iy).sumxw;
+	h->bin(ix, iy).sumx2w -= h2.bin(ix, iy).sumx2w;
+	h->bin(ix, iy).sumyw -= h2.bin(ix, iy).sumyw;
+	h->bin(ix, iy).sumy2w -= h2.bin(ix, iy).sumy2w;
     }
     if ( !tree->insert(path, h) ) {
       //std::cout << "&&&&&&&" << std::endl;
@@ -740,10 +740,10 @@ public:
     h->setTitle(path.substr(path.rfind('/') + 1));
     for ( int ix = 0; ix < h->xax->bins() + 2; ++ix )
       for ( int iy = 0; iy < h->yax->bins() + 2; ++iy ) {
-      h->sum[ix][iy] *= h2.sum[ix][iy];
-      h->sumw[ix][iy] *= h2.sumw[ix][iy];
-      h->sumw2[ix][iy] += h1.sumw[ix][iy]*h1.sumw[ix][iy]*h2.sumw2[ix][iy] +
-        h2.sumw[ix][iy]*h2.sumw[ix][iy]*h1.sumw2[ix][iy];
+      h->bin(ix, iy).sum *= h2.bin(ix, iy).sum;
+      h->bin(ix, iy).sumw *= h2.bin(ix, iy).sumw;
+      h->bin(ix, iy).sumw2 += h1.bin(ix, iy).sumw*h1.bin(ix, iy).sumw*h2.bin(ix, iy).sumw2 +
+        h2.bin(ix, iy).sumw*h2.bin(ix, iy).sumw*h1.bin(ix, iy).sumw2;
     }
     if ( !tree->insert(path, h) ) {
       delete h;
@@ -762,15 +762,15 @@ public:
     h->setTitle(path.substr(path.rfind('/') + 1));
     for ( int ix = 0; ix < h->xax->bins() + 2; ++ix )
       for ( int iy = 0; iy < h->yax->bins() + 2; ++iy ) {
-      if ( h2.sum[ix][iy] == 0 || h2.sumw[ix][iy] == 0.0 ) {
-	h->sum[ix][iy] = 0;
-	h->sumw[ix][iy] = h->sumw2[ix][iy] = 0.0;
+      if ( h2.bin(ix, iy).sum == 0 || h2.bin(ix, iy).sumw == 0.0 ) {
+	h->bin(ix, iy).sum = 0;
+	h->bin(ix, iy).sumw = h->bin(ix, iy).sumw2 = 0.0;
 	continue;
       }
-      h->sumw[ix][iy] /= h2.sumw[ix][iy];
-      h->sumw2[ix][iy] = h1.sumw2[ix][iy]/(h2.sumw[ix][iy]*h2.sumw[ix][iy]) +
-	h1.sumw[ix][iy]*h1.sumw[ix][iy]*h2.sumw2[ix][iy]/
-	(h2.sumw[ix][iy]*h2.sumw[ix][iy]*h2.sumw[ix][iy]*h2.sumw[ix][iy]);
+      h->bin(ix, iy).sumw /= h2.bin(ix, iy).sumw;
+      h->bin(ix, iy).sumw2 = h1.bin(ix, iy).sumw2/(h2.bin(ix, iy).sumw*h2.bin(ix, iy).sumw) +
+	h1.bin(ix, iy).sumw*h1.bin(ix, iy).sumw*h2.bin(ix, iy).sumw2/
+	(h2.bin(ix, iy).sumw*h2.bin(ix, iy).sumw*h2.bin(ix, iy).sumw*h2.bin(ix, iy).sumw);
     }
     if ( !tree->insert(path, h) ) {
       delete h;
@@ -916,11 +916,11 @@ public:
     }
     for ( int ix = 0; ix < h2.xax->bins() + 2; ++ix )
       for ( int iy = il + 2; iy <= iu + 2; ++iy ) {
-	h1->sum[ix] += h2.sum[ix][iy];
-	h1->sumw[ix] += h2.sumw[ix][iy];
-	h1->sumw2[ix] += h2.sumw2[ix][iy];
-	h1->sumxw[ix] += h2.sumxw[ix][iy];
-	h1->sumx2w[ix] += h2.sumx2w[ix][iy];
+	h1->sum[ix] += h2.bin(ix, iy).sum;
+	h1->sumw[ix] += h2.bin(ix, iy).sumw;
+	h1->sumw2[ix] += h2.bin(ix, iy).sumw2;
+	h1->sumxw[ix] += h2.bin(ix, iy).sumxw;
+	h1->sumx2w[ix] += h2.bin(ix, iy).sumx2w;
       }
     if ( !tree->insert(path, h1) ) {
       delete h1;
@@ -953,11 +953,11 @@ public:
     }
     for ( int iy = 0; iy < h2.yax->bins() + 2; ++iy )
       for ( int ix = il + 2; ix <= iu + 2; ++ix ) {
-	h1->sum[iy] += h2.sum[ix][iy];
-	h1->sumw[iy] += h2.sumw[ix][iy];
-	h1->sumw2[iy] += h2.sumw2[ix][iy];
-	h1->sumxw[iy] += h2.sumyw[ix][iy];
-	h1->sumx2w[iy] += h2.sumy2w[ix][iy];
+	h1->sum[iy] += h2.bin(ix, iy).sum;
+	h1->sumw[iy] += h2.bin(ix, iy).sumw;
+	h1->sumw2[iy] += h2.bin(ix, iy).sumw2;
+	h1->sumxw[iy] += h2.bin(ix, iy).sumyw;
+	h1->sumx2w[iy] += h2.bin(ix, iy).sumy2w;
       }
     if ( !tree->insert(path, h1) ) {
       delete h1;
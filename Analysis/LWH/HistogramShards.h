@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//
+// HistogramShards.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef LWH_HistogramShards_H
+#define LWH_HistogramShards_H
+//
+// This is the declaration of the HistogramShards class.
+//
+
+#include <vector>
+
+namespace LWH {
+
+/**
+ * HistogramShards keeps a number of empty copies (shards) of a
+ * Histogram1D or Histogram2D, one for each thread filling it. Each
+ * thread fills its own shard, identified by an index between zero
+ * and size(), which requires neither locks nor atomic operations. When
+ * the filling is done, merge() adds the contents of all shards to the
+ * original histogram using its add() function.
+ *
+ * The shards must not be filled while merge() is running.
+ */
+template <typename H>
+class HistogramShards {
+
+public:
+
+  /**
+   * Create \a n empty shards with the same binning as \a h, which
+   * will be merged into \a h.
+   */
+  HistogramShards(H & h, unsigned int n)
+    : master(h) {
+    shards.reserve(n);
+    for ( unsigned int i = 0; i < n; ++i ) {
+      shards.push_back(new H(h));
+      shards.back()->reset();
+    }
+  }
+
+  /**
+   * Destructor. Any contents which have not been merged are lost.
+   */
+  ~HistogramShards() {
+    for ( unsigned int i = 0; i < shards.size(); ++i ) delete shards[i];
+  }
+
+  /**
+   * The number of shards.
+   */
+  unsigned int size() const {
+    return shards.size();
+  }
+
+  /**
+   * Return the shard to be filled by the thread with index \a i.
+   */
+  H & operator[](unsigned int i) {
+    return *shards[i];
+  }
+
+  /**
+   * Add the contents of all shards to the original histogram and
+   * reset the shards.
+   */
+  void merge() {
+    for ( unsigned int i = 0; i < shards.size(); ++i ) {
+      master.add(*shards[i]);
+      shards[i]->reset();
+    }
+  }
+
+  /**
+   * The original histogram.
+   */
+  H & histogram() {
+    return master;
+  }
+
+private:
+
+  /**
+   * The shards cannot be copied.
+   */
+  HistogramShards(const HistogramShards &);
+
+  /**
+   * The shards cannot be assigned.
+   */
+  HistogramShards & operator=(const HistogramShards &);
+
+  /**
+   * The original histogram.
+   */
+  H & master;
+
+  /**
+   * The shards.
+   */
+  std::vector<H *> shards;
+
+};
+
+}
+
+#endif /* LWH_HistogramShards_H */
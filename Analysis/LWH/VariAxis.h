@@ -16,7 +16,7 @@
 #include <limits>
 #include <cmath>
 #include <algorithm>
-#include <map>
+#include <vector>
 #include "AIAxis.h"
 
 namespace LWH {
@@ -35,10 +35,10 @@ public:
   /**
    * Standard constructor.
    */
-  VariAxis(const std::vector<double> & edges) {
-    for ( int i = 0, N = edges.size(); i < N; ++i ) binco[edges[i]] = 0;
-    std::map<double,int>::iterator it = binco.begin();
-    for ( int i = 0, N = edges.size(); i < N; ++i ) (it++)->second = i;
+  VariAxis(const std::vector<double> & edges)
+    : binco(edges) {
+    std::sort(binco.begin(), binco.end());
+    binco.erase(std::unique(binco.begin(), binco.end()), binco.end());
   }
 
   /**
@@ -64,7 +64,7 @@ public:
    *
    */
   double lowerEdge() const {
-    if ( binco.size() ) return binco.begin()->first;
+    if ( binco.size() ) return binco.front();
     return 0;
   }
 
@@ -75,8 +75,7 @@ public:
    */
   double upperEdge() const {
     if ( !binco.size() ) return 0;
-    std::map<double,int>::const_iterator last = binco.end();
-    return (--last)->first;
+    return binco.back();
   }
 
   /** 
@@ -97,13 +96,11 @@ public:
   std::pair<double,double> binEdges(int index) const {
     std::pair<double,double> edges(0.0, 0.0);
     if ( !binco.size() ) return edges;
-    std::map<double,int>::const_iterator lo = binco.end();
-    std::map<double,int>::const_iterator up = binco.begin();
-    if ( index >= 0 ) while ( index-- >= 0 && up != binco.end() ) lo = up++;
-    edges.first = ( lo == binco.end() )? -std::numeric_limits<double>::max():
-                                         lo->first;
-    edges.second = ( up == binco.end() )? std::numeric_limits<double>::max():
-                                         up->first;
+    int N = binco.size();
+    edges.first = index < 0? -std::numeric_limits<double>::max():
+      binco[std::min(index, N - 1)];
+    edges.second = index < 0? binco[0]: index + 1 < N? binco[index + 1]:
+      std::numeric_limits<double>::max();
     return edges;
   }
 
@@ -153,10 +150,18 @@ public:
    *
    */
   int coordToIndex(double coord) const {
-    std::map<double,int>::const_iterator up = binco.upper_bound(coord);
-    if ( up == binco.begin() ) return UNDERFLOW_BIN;
-    else if ( up == binco.end() ) return OVERFLOW_BIN;
-    else return up->second - 1;
+    int N = binco.size();
+    if ( !N ) return UNDERFLOW_BIN;
+    // Branchless binary search for the first edge above coord. The
+    // comparisons are written as in std::upper_bound so that NaN ends
+    // up in the overflow bin.
+    const double * base = &binco[0];
+    for ( int n = N; n > 1; n -= n/2 )
+      base = !( coord < base[n/2] )? base + n/2: base;
+    int up = ( base - &binco[0] ) + !( coord < *base );
+    if ( up == 0 ) return UNDERFLOW_BIN;
+    else if ( up == N ) return OVERFLOW_BIN;
+    else return up - 1;
   }
 
   /**
@@ -171,10 +176,9 @@ public:
 private:
 
   /**
-   * A map relating the lower edge of a bin to the corresponding bin
-   * number.
+   * The sorted bin edges.
    */
-  std::map<double,int> binco;
+  std::vector<double> binco;
 
 };
 
@@ -75,7 +75,7 @@ void Collision::rebind(const EventTranslationMap & trans) {
 }
 
 void Collision::transform(const LorentzRotation & r) {
-  for_each(allParticles, Transformer(r));
+  Particle::transform(allParticles.begin(), allParticles.end(), r);
 }
 
 void Collision::addStep(tStepPtr s) {
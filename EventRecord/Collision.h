@@ -31,7 +31,8 @@ namespace ThePEG {
  * @see SubProcess
  * @see Particle
  */
-class Collision: public EventRecordBase {
+class Collision: public EventRecordBase,
+		 public ObjectCounter<Collision> {
 
 public:
 
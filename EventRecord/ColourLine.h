@@ -33,7 +33,8 @@ namespace ThePEG {
  * @see Particle
  * @see ColourBase
  */
-class ColourLine: public EventRecordBase {
+class ColourLine: public EventRecordBase,
+		  public ObjectCounter<ColourLine> {
 
 public:
 
@@ -98,7 +98,7 @@ void Event::addParticle(tPPtr p) {
 }
 
 void Event::transform(const LorentzRotation & r) {
-  for_each(allParticles, Transformer(r));
+  Particle::transform(allParticles.begin(), allParticles.end(), r);
 }
 
 int Event::colourLineIndex(tcColinePtr line) const {
@@ -23,6 +23,9 @@
 
 #include "ThePEG/Config/ThePEG.h"
 #include "ThePEG/Utilities/Rebinder.fh"
+#include "ThePEG/Utilities/MemoryPool.h"
+#include "ThePEG/Utilities/ObjectCounter.h"
+#include "ThePEG/Utilities/FlatSet.h"
 #include "ThePEG/Persistency/PersistentOStream.fh"
 #include "ThePEG/Persistency/PersistentIStream.fh"
 
@@ -72,8 +75,12 @@ typedef Ptr<ParticleDataClass>::transient_const_pointer tcEventPDPtr;
 typedef vector<tPPtr> tParticleVector;
 /** A vector of pointers to Particle. */
 typedef vector<PPtr> ParticleVector;
-/** A set of pointers to Particle. */
-typedef set<PPtr, less<PPtr> > ParticleSet;
+/** A set of pointers to Particle, stored contiguously and ordered
+ *  by the unique identifiers of the particles. Unlike for std::set,
+ *  any insertion or erasure invalidates all iterators into the set,
+ *  so a ParticleSet must not be modified while it is iterated over
+ *  (except through the iterator returned by erase()). */
+typedef FlatSet<PPtr, less<PPtr> > ParticleSet;
 /** A set of transient pointers to Particle. */
 typedef set<tPPtr, less<tPPtr> > tParticleSet;
 /** A set of transient pointers to const Particle. */
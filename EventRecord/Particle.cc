@@ -31,7 +31,8 @@
 using namespace ThePEG;
 
 Particle::ParticleRep::ParticleRep(const ParticleRep & p)
-  : theParents(p.theParents), theChildren(p.theChildren),
+  : ObjectCounter<ParticleRep>(p),
+    theParents(p.theParents), theChildren(p.theChildren),
     thePrevious(p.thePrevious), theNext(p.theNext),
     theBirthStep(p.theBirthStep), theVertex(p.theVertex),
     theLifeLength(p.theLifeLength), theScale(p.theScale),
@@ -46,7 +47,8 @@ Particle::ParticleRep::ParticleRep(const ParticleRep & p)
 }
 
 Particle::Particle(const Particle & p)
-  : Base(p), theData(p.theData), theMomentum(p.theMomentum), theRep(p.theRep) {
+  : Base(p), ObjectCounter<Particle>(p), theData(p.theData),
+    theMomentum(p.theMomentum), theRep(p.theRep) {
   if ( p.theRep ) {
     theRep = new ParticleRep(*p.theRep);
     theRep->theParents.clear();
@@ -164,6 +166,62 @@ void Particle::deepTransform(const LorentzRotation & r) {
   if ( rep().theNext ) rep().theNext->deepTransform(r);
 }
 
+namespace {
+
+/**
+ * Helper class for Particle::transformBlock keeping the elements of a
+ * SpinOneLorentzRotation in local variables.
+ */
+struct MatrixTransformer {
+
+  /** Copy the elements of \a m. */
+  MatrixTransformer(const SpinOneLorentzRotation & m)
+    : xx(m.xx()), xy(m.xy()), xz(m.xz()), xt(m.xt()),
+      yx(m.yx()), yy(m.yy()), yz(m.yz()), yt(m.yt()),
+      zx(m.zx()), zy(m.zy()), zz(m.zz()), zt(m.zt()),
+      tx(m.tx()), ty(m.ty()), tz(m.tz()), tt(m.tt()) {}
+
+  /**
+   * Transform \a v in place, with the operations done in the same
+   * order as in SpinOneLorentzRotation::operator*.
+   */
+  template <typename Value>
+  void operator()(LorentzVector<Value> & v, Value unit) const {
+    const double x = v.x()/unit, y = v.y()/unit;
+    const double z = v.z()/unit, t = v.t()/unit;
+    v.setX((xx*x + xy*y + xz*z + xt*t)*unit);
+    v.setY((yx*x + yy*y + yz*z + yt*t)*unit);
+    v.setZ((zx*x + zy*y + zz*z + zt*t)*unit);
+    v.setT((tx*x + ty*y + tz*z + tt*t)*unit);
+  }
+
+  /** The matrix elements. */
+  const double xx, xy, xz, xt, yx, yy, yz, yt;
+  /** The matrix elements. */
+  const double zx, zy, zz, zt, tx, ty, tz, tt;
+
+};
+
+}
+
+void Particle::transformBlock(Particle * const * block, int n,
+			      const LorentzRotation & r) {
+  // The spin information needs the momenta before the transformation.
+  for ( int i = 0; i < n; ++i )
+    if ( block[i]->hasRep() && block[i]->spinInfo() )
+      block[i]->spinInfo()->transform(block[i]->momentum(), r);
+
+  const MatrixTransformer m(r.one());
+  for ( int i = 0; i < n; ++i ) m(block[i]->theMomentum, MeV);
+
+  for ( int i = 0; i < n; ++i ) {
+    if ( !block[i]->hasRep() ) continue;
+    ParticleRep & rep = *block[i]->theRep;
+    m(rep.theVertex, mm);
+    m(rep.theLifeLength, mm);
+  }
+}
+
 void Particle::rotateX(double a) {
   LorentzRotation r;
   r.rotateX(a);
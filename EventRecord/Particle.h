@@ -80,7 +80,8 @@ namespace ThePEG {
  * @see ColourLine
  * @see ColourBase 
  */
-class Particle: public EventRecordBase {
+class Particle: public EventRecordBase,
+		public ObjectCounter<Particle> {
 
 public:
 
@@ -97,6 +98,13 @@ public:
 
   struct ParticleRep;
 
+public:
+
+  /**
+   * Particle objects are allocated from a MemoryPool.
+   */
+  ThePEG_DECLARE_POOL_ALLOCATION(Particle)
+
 public:
 
   /**
@@ -493,6 +501,20 @@ public:
    */
   void transform(const LorentzRotation & r);
 
+  /**
+   * Do Lorentz transformations on all particles in the range between
+   * \a first and \a last, which are iterators over pointers to
+   * particles. The result is the same as calling transform(const
+   * LorentzRotation &) for each particle, but the particles are
+   * handled in blocks, where the spin information is transformed
+   * first for the particles which have it, and then the momenta,
+   * vertices and life lengths are transformed with the matrix
+   * elements kept in local variables.
+   */
+  template <typename Iterator>
+  static void transform(Iterator first, Iterator last,
+			const LorentzRotation & r);
+
   /**
    * Do Lorentz transformations on this particle. \a bx, \a by and \a
    * bz are the boost vector components.
@@ -950,6 +972,18 @@ private:
    */
   void number(int n) { rep().theNumber = n; }
 
+  /**
+   * The number of particles handled together by transform(Iterator,
+   * Iterator, const LorentzRotation &).
+   */
+  static const int TransformBlockSize = 64;
+
+  /**
+   * Do Lorentz transformations on the \a n particles in \a block.
+   */
+  static void transformBlock(Particle * const * block, int n,
+			     const LorentzRotation & r);
+
   /**
    * Remove the given particle from the list of children.
    */
@@ -1022,7 +1056,12 @@ public:
    * will only be instantiated if needed to save memory and time when
    * temporarily creating particles.
    */
-  struct ParticleRep {
+  struct ParticleRep: public ObjectCounter<ParticleRep> {
+
+    /**
+     * ParticleRep objects are allocated from a MemoryPool.
+     */
+    ThePEG_DECLARE_POOL_ALLOCATION(ParticleRep)
 
     /**
      * Default constructor.
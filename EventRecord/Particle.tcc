@@ -28,6 +28,17 @@ PrintParticles(ostream & os, Iterator first, Iterator last, tcStepPtr step) {
     (**i).print(os, step);
 }
 
+template <typename Iterator>
+void Particle::
+transform(Iterator first, Iterator last, const LorentzRotation & r) {
+  Particle * block[TransformBlockSize];
+  while ( first != last ) {
+    int n = 0;
+    while ( first != last && n < TransformBlockSize ) block[n++] = &**first++;
+    transformBlock(block, n, r);
+  }
+}
+
 template <typename Iterator>
 typename std::iterator_traits<Iterator>::value_type Particle::
 colourNeighbour(Iterator first, Iterator last, bool anti) const {
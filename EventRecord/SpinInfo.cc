@@ -22,7 +22,7 @@ using namespace ThePEG;
 const double SpinInfo::_eps=1.0e-8;
 
 SpinInfo::SpinInfo(const SpinInfo & x)
-  : EventInfoBase(x), _production(x._production), _decay(x._decay),
+  : EventInfoBase(x), ObjectCounter<SpinInfo>(x), _production(x._production), _decay(x._decay),
     _timelike(x._timelike),
     _prodloc(x._prodloc), _decayloc(x._decayloc),
     _decayed(x._decayed), _developed(x._developed),_rhomatrix(x._rhomatrix),
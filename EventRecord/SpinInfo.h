@@ -11,6 +11,7 @@
 // This is the declaration of the SpinInfo class.
 
 #include "ThePEG/EventRecord/EventInfoBase.h"
+#include "ThePEG/Utilities/ObjectCounter.h"
 #include "ThePEG/PDT/PDT.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
 #include "HelicityVertex.h"
@@ -55,7 +56,8 @@ namespace ThePEG {
  * @author Peter Richardson
  *
  */
-class SpinInfo: public EventInfoBase {
+class SpinInfo: public EventInfoBase,
+		public ObjectCounter<SpinInfo> {
 
 public:
 
@@ -26,7 +26,7 @@
 using namespace ThePEG;
 
 Step::Step(const Step & s)
-  : Base(s), 
+  : Base(s), ObjectCounter<Step>(s),
     theParticles(s.theParticles), theIntermediates(s.theIntermediates),
     allParticles(s.allParticles), theCollision(s.theCollision),
     theHandler(s.theHandler) {}
@@ -31,7 +31,7 @@ namespace ThePEG {
  * @see SelectorBase
  * @see SelectorBase
  */
-class Step: public EventRecordBase {
+class Step: public EventRecordBase, public ObjectCounter<Step> {
 
 public:
 
@@ -40,6 +40,13 @@ public:
   /** Most of the Event classes are friends with each other. */
   friend class Event;
 
+public:
+
+  /**
+   * Step objects are allocated from a MemoryPool.
+   */
+  ThePEG_DECLARE_POOL_ALLOCATION(Step)
+
 public:
 
   /**
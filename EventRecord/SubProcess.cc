@@ -109,8 +109,8 @@ void SubProcess::removeEntry(tPPtr p) {
 void SubProcess::transform(const LorentzRotation & r) {
   incoming().first->transform(r);
   incoming().second->transform(r);
-  for_each(intermediates(), Transformer(r));
-  for_each(outgoing(), Transformer(r));
+  Particle::transform(intermediates().begin(), intermediates().end(), r);
+  Particle::transform(outgoing().begin(), outgoing().end(), r);
 }
 
 void SubProcess::printMe(ostream& os) const {
@@ -14,6 +14,7 @@
 #include "ThePEG/Handlers/ACDCSampler.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
 #include "ThePEG/Interface/Parameter.h"
+#include "ThePEG/Interface/Switch.h"
 #include "ThePEG/Repository/EventGenerator.h"
 #include "ThePEG/Persistency/PersistentOStream.h"
 #include "ThePEG/Persistency/PersistentIStream.h"
@@ -38,12 +39,7 @@ void ACDCSampler::initialize() {
   theSampler.margin(theMargin);
   theSampler.nTry(2);
   theSampler.maxTry(eventHandler()->maxLoop());
-  bool nozero = false;
-
-
-  for ( int i = 0, N = eventHandler()->nBins(); i < N; ++i ) {
-    nozero |= theSampler.addFunction(eventHandler()->nDim(i), eventHandler());
-  }
+  bool nozero = addFunctions();
   if( eventHandler()->nBins() ==0 ) Throw<EventInitNoXSec>()
     << "The event handler '" << eventHandler()->name()
     << "' cannot be initialized because there are no selected subprocesses"
@@ -77,6 +73,16 @@ CrossSection ACDCSampler::integratedXSecErr() const {
   return theSampler.integralErr()*nanobarn;
 }
 
+bool ACDCSampler::addFunctions() {
+  SamplerType::DimVector dims;
+  SamplerType::FncVector fncs;
+  for ( int i = 0, N = eventHandler()->nBins(); i < N; ++i ) {
+    dims.push_back(eventHandler()->nDim(i));
+    fncs.push_back(eventHandler());
+  }
+  return theSampler.addFunctions(dims, fncs);
+}
+
 int ACDCSampler::lastBin() const {
   return theSampler.last() - 1;
 }
@@ -128,23 +134,41 @@ void ACDCSampler::doinitrun() {
   theSampler.margin(theMargin);
   theSampler.nTry(theNTry);
   theSampler.maxTry(eventHandler()->maxLoop());
-  bool nozero = false;
-  for ( int i = 0, N = eventHandler()->nBins(); i < N; ++i )
-    if ( theSampler.addFunction(eventHandler()->nDim(i), eventHandler()) )
-      nozero = true;
+  theSampler.flatCells(theFlatCells);
+  if ( readGridCache() ) {
+    theSampler.maxTry(eventHandler()->maxLoop());
+    return;
+  }
+  theSampler.clear();
+  bool nozero = addFunctions();
   if ( !nozero ) throw EventInitNoXSec()
     << "The event handler '" << eventHandler()->name()
     << "' cannot be initialized because the cross-section for the selected "
     << "sub-processes was zero." << Exception::maybeabort;
+  writeGridCache();
+}
+
+void ACDCSampler::describeGrid(ostream & os) const {
+  SamplerBase::describeGrid(os);
+  os << theEps << ' ' << theMargin << ' ' << theNTry << '\n';
+}
+
+void ACDCSampler::writeGrid(PersistentOStream & os) const {
+  theSampler.outputGrid(os);
+}
+
+bool ACDCSampler::readGrid(PersistentIStream & is) {
+  SamplerType::FncVector fncs(eventHandler()->nBins(), eventHandler());
+  return theSampler.inputGrid(is, fncs);
 }
 
 void ACDCSampler::persistentOutput(PersistentOStream & os) const {
-  os << theEps << theMargin << theNTry;
+  os << theEps << theMargin << theNTry << theFlatCells;
   theSampler.output(os);
 }
 
 void ACDCSampler::persistentInput(PersistentIStream & is, int) {
-  is >> theEps >> theMargin >> theNTry;
+  is >> theEps >> theMargin >> theNTry >> theFlatCells;
   theSampler.input(is);
   if ( generator() ) theSampler.setRnd(0);
 }
@@ -178,6 +202,25 @@ void ACDCSampler::Init() {
      "The number of phase space points tried in the initialization.",
      &ACDCSampler::theNTry, 1000, 2, 1000000, true, false, true);
 
+  static Switch<ACDCSampler,bool> interfaceFlatCells
+    ("FlatCells",
+     "Choose the cell in which to generate a phase space point in constant "
+     "time from a flat table of all active cells, rather than by walking "
+     "down the tree of cells. The table is rebuilt whenever the tree "
+     "changes, which makes this option most useful for large trees once "
+     "the compensation has settled.",
+     &ACDCSampler::theFlatCells, false, true, false);
+  static SwitchOption interfaceFlatCellsYes
+    (interfaceFlatCells,
+     "Yes",
+     "Choose cells from a flat table.",
+     true);
+  static SwitchOption interfaceFlatCellsNo
+    (interfaceFlatCells,
+     "No",
+     "Choose cells by walking down the tree.",
+     false);
+
   interfaceNTry.rank(10);
   interfaceEps.rank(9);
 
@@ -43,7 +43,9 @@ public:
   /**
    * The default constructor.
    */
-  ACDCSampler() : theEps(100*Constants::epsilon), theMargin(1.1), theNTry(1000) {}
+  ACDCSampler()
+    : theEps(100*Constants::epsilon), theMargin(1.1), theNTry(1000),
+      theFlatCells(false) {}
 
   /**
    * The copy constructor. We don't copy theSampler.
@@ -51,7 +53,7 @@ public:
   ACDCSampler(const ACDCSampler & x)
     : SamplerBase(x), theSampler(),
       theEps(x.theEps), theMargin(x.theMargin),
-      theNTry(x.theNTry) {}
+      theNTry(x.theNTry), theFlatCells(x.theFlatCells) {}
 
   /**
    * The destructor.
@@ -173,6 +175,42 @@ protected:
   virtual void dofinish();
   //@}
 
+protected:
+
+  /** @name Functions for grid caching overridden from SamplerBase. */
+  //@{
+  /**
+   * ACDCSampler is able to cache its cells.
+   */
+  virtual bool cachesGrid() const { return true; }
+
+  /**
+   * Add the settings of this sampler to the description of the grid.
+   */
+  virtual void describeGrid(ostream & os) const;
+
+  /**
+   * Write the adapted cells of the underlying ACDCGen, as obtained
+   * after the presampling in doinitrun().
+   */
+  virtual void writeGrid(PersistentOStream & os) const;
+
+  /**
+   * Read the cells of the underlying ACDCGen, starting with fresh
+   * statistics.
+   */
+  virtual bool readGrid(PersistentIStream & is);
+  //@}
+
+private:
+
+  /**
+   * Add one function per bin of the event handler to the sampler,
+   * presampling all of them in one go.
+   * @return true if at least one bin had a non-zero cross section.
+   */
+  bool addFunctions();
+
 private:
 
   /**
@@ -195,6 +233,12 @@ private:
    */
   int theNTry;
 
+  /**
+   * If true, the active cells are chosen from a flat table rather
+   * than by walking down the tree of cells.
+   */
+  bool theFlatCells;
+
 protected:
 
   /** @cond EXCEPTIONCLASSES */
@@ -62,12 +62,12 @@ void AnalysisHandler::analyze(tEventPtr event, long, int loop, int state) {
   LorentzRotation r = transform(cevent);
   tPVector particles;
   event->selectFinalState(back_inserter(particles));
-  Utilities::transform(particles, r);
+  Particle::transform(particles.begin(), particles.end(), r);
   analyze(particles, event->weight());
   for ( int i = 0, N = theSlaves.size(); i < N; ++i )
     theSlaves[i]->analyze(particles, event->weight());
   r.invert();
-  Utilities::transform(particles, r);
+  Particle::transform(particles.begin(), particles.end(), r);
 }
 
 LorentzRotation AnalysisHandler::transform(tEventPtr) const {
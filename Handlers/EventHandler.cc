@@ -42,7 +42,7 @@ EventHandler::EventHandler(bool warnincomplete)
   : theMaxLoop(100000), weightedEvents(false), 
     theStatLevel(2), theConsistencyLevel(clCollision),
     theConsistencyEpsilon(sqrt(Constants::epsilon)),
-    warnIncomplete(warnincomplete) {
+    isTimingSteps(false), warnIncomplete(warnincomplete) {
   setupGroups();
 }
 
@@ -58,7 +58,8 @@ EventHandler(const EventHandler & x)
     theSubprocessGroup(x.theSubprocessGroup),
     theCascadeGroup(x.theCascadeGroup), theMultiGroup(x.theMultiGroup),
     theHadronizationGroup(x.theHadronizationGroup),
-    theDecayGroup(x.theDecayGroup), warnIncomplete(x.warnIncomplete),
+    theDecayGroup(x.theDecayGroup), isTimingSteps(false),
+    warnIncomplete(x.warnIncomplete),
     theIncoming(x.theIncoming) {
   setupGroups();
 }
@@ -191,6 +192,8 @@ performStep(tStepHdlPtr handler, tHintPtr hint) {
   tStepPtr oldStep = currentStep();
   currentStepHandler(handler);
   handler->eventHandler(this);
+  std::chrono::steady_clock::time_point start;
+  if ( isTimingSteps ) start = std::chrono::steady_clock::now();
   try {
     generator()->currentStepHandler(handler);
     handler->handle(*this, hint->tagged(*oldStep), *hint);
@@ -198,16 +201,26 @@ performStep(tStepHdlPtr handler, tHintPtr hint) {
   }
   catch (...) {
     generator()->currentStepHandler(tStepHdlPtr());
+    if ( isTimingSteps ) recordStepTime(handler, start);
     if ( oldStep != currentStep() ) popStep();
     throw;
   }
 
+  if ( isTimingSteps ) recordStepTime(handler, start);
+
   while ( currentStep()->nullStep() ) popStep();
 
   if ( ThePEG_DEBUG_ITEM(2) && oldStep != currentStep() )
     generator()->logfile() << *currentStep();
 }
 
+void EventHandler::
+recordStepTime(tcStepHdlPtr handler,
+	       std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+  theStepTimes.push_back(make_pair(handler, dt.count()));
+}
+
 void EventHandler::
 addStep(Group::Level level, Group::Handler group, tStepHdlPtr s, tHintPtr h) {
   if ( !h ) h = Hint::Default();
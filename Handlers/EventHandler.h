@@ -18,6 +18,7 @@
 #include "ThePEG/Handlers/SubProcessHandler.fh"
 #include "ThePEG/Cuts/Cuts.fh"
 #include "EventHandler.fh"
+#include <chrono>
 
 namespace ThePEG {
 
@@ -189,6 +190,23 @@ public:
    * @return 0 if no integrated cross section error could be estimated.
    */
   virtual CrossSection integratedXSecErr() const;
+
+  /**
+   * Write the raw sums of the cross section statistics collected in
+   * this run to the given stream, so that they can be combined with
+   * the ones of other runs using mergeStatistics(). This version of
+   * the function writes nothing.
+   */
+  virtual void outputStatistics(PersistentOStream &) const {}
+
+  /**
+   * Add the raw sums of the cross section statistics written by
+   * outputStatistics() in another run of the same set-up. The first
+   * call replaces the statistics of this object, after which
+   * statistics(), integratedXSec() and integratedXSecErr() refer to
+   * the combined runs. This version of the function does nothing.
+   */
+  virtual void mergeStatistics(PersistentIStream &) {}
   //@}
 
   /** @name Simple access functions. */
@@ -367,6 +385,51 @@ public:
 
   //@}
 
+public:
+
+  /** @name Functions for timing the StepHandlers. */
+  //@{
+  /**
+   * A vector of StepHandlers, each with the wall-clock time in seconds
+   * spent in one call to its handle() function.
+   */
+  typedef vector< pair<tcStepHdlPtr,double> > StepTimeVector;
+
+  /**
+   * Switch on or off the timing of StepHandlers in performStep(). It
+   * is off by default and is typically switched on by an
+   * AnalysisHandler which wants to profile the generation.
+   */
+  void timeSteps(bool on) {
+    isTimingSteps = on;
+    theStepTimes.clear();
+  }
+
+  /**
+   * Return true if the StepHandlers are being timed.
+   */
+  bool timingSteps() const { return isTimingSteps; }
+
+  /**
+   * The times spent in the StepHandlers since clearStepTimes() was
+   * last called, including vetoed steps.
+   */
+  const StepTimeVector & stepTimes() const { return theStepTimes; }
+
+  /**
+   * Forget the recorded times spent in the StepHandlers.
+   */
+  void clearStepTimes() { theStepTimes.clear(); }
+  //@}
+
+private:
+
+  /**
+   * Record the time spent in \a handler since \a start.
+   */
+  void recordStepTime(tcStepHdlPtr handler,
+		      std::chrono::steady_clock::time_point start);
+
 public:
 
   /** @name Functions used by the persistent I/O system. */
@@ -567,6 +630,16 @@ private:
    */
   StepHdlPtr theCurrentStepHandler;
 
+  /**
+   * True if the StepHandlers are being timed.
+   */
+  bool isTimingSteps;
+
+  /**
+   * The recorded times spent in the StepHandlers.
+   */
+  StepTimeVector theStepTimes;
+
 protected:
 
   /**
@@ -13,21 +13,143 @@
 
 #include "SamplerBase.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Interface/Parameter.h"
 #include "ThePEG/Handlers/StandardEventHandler.h"
+#include "ThePEG/Handlers/StandardXComb.h"
+#include "ThePEG/Handlers/LuminosityFunction.h"
+#include "ThePEG/PDT/ParticleData.h"
+#include "ThePEG/Cuts/Cuts.h"
+#include "ThePEG/MatrixElement/MEBase.h"
+#include "ThePEG/PDF/PartonExtractor.h"
+#include "ThePEG/Repository/BaseRepository.h"
+#include "ThePEG/Repository/EventGenerator.h"
+#include "ThePEG/Repository/RandomGenerator.h"
 #include "ThePEG/Persistency/PersistentOStream.h"
 #include "ThePEG/Persistency/PersistentIStream.h"
+#include <cstdio>
+#include <unistd.h>
 
 using namespace ThePEG;
 
+namespace {
+
+/** The version of the grid cache file format. */
+const int gridCacheVersion = 2;
+
+/** Write the values of all parameters, switches and references of
+    \a obj to \a os. */
+void describeObject(ostream & os, tIBPtr obj) {
+  os << obj->fullName() << '\n';
+  InterfaceMap interfaceMap = BaseRepository::getInterfaces(typeid(*obj));
+  for ( InterfaceMap::iterator it = interfaceMap.begin();
+	it != interfaceMap.end(); ++it ) {
+    string type = it->second->type();
+    if ( type == "Cm" || type == "Dd" ) continue;
+    try {
+      os << it->first << ' ' << it->second->exec(*obj, "get", "") << '\n';
+    }
+    catch ( Exception & ) {}
+  }
+}
+
+}
+
 SamplerBase::~SamplerBase() {}
 
+void SamplerBase::describeGrid(ostream & os) const {
+  tcStdEHPtr eh = eventHandler();
+  ObjectSet refs;
+  BaseRepository::addReferences(eventHandler()->lumiFnPtr(), refs);
+  BaseRepository::addReferences(eh->cuts(), refs);
+  os << eh->nBins() << ' ' << eh->lumiDim() << '\n';
+  for ( int i = 0, N = eh->nBins(); i < N; ++i ) {
+    tStdXCombPtr xc = eh->xCombs()[i];
+    os << eh->nDim(i) << ' ' << xc->matrixElement()->fullName();
+    for ( int j = 0, M = xc->mePartonData().size(); j < M; ++j )
+      os << ' ' << xc->mePartonData()[j]->PDGName();
+    os << '\n';
+    BaseRepository::addReferences(xc->matrixElement(), refs);
+    BaseRepository::addReferences(xc->pExtractor(), refs);
+    BaseRepository::addReferences(xc->cuts(), refs);
+  }
+
+  // Order the objects by name and leave out the ones which are
+  // expected to differ between otherwise identical jobs.
+  ObjectMap objects;
+  for ( ObjectSet::iterator it = refs.begin(); it != refs.end(); ++it ) {
+    if ( dynamic_ptr_cast<tEGPtr>(*it) || dynamic_ptr_cast<tRanGenPtr>(*it) ||
+	 dynamic_ptr_cast<tSamplerPtr>(*it) || dynamic_ptr_cast<tEHPtr>(*it) )
+      continue;
+    objects[(**it).fullName()] = *it;
+  }
+  for ( ObjectMap::iterator it = objects.begin(); it != objects.end(); ++it )
+    describeObject(os, it->second);
+}
+
+string SamplerBase::gridHash() const {
+  ostringstream os;
+  describeGrid(os);
+  string desc = os.str();
+  // 64-bit FNV-1a.
+  unsigned long long h = 14695981039346656037ULL;
+  for ( string::size_type i = 0; i < desc.size(); ++i ) {
+    h ^= static_cast<unsigned char>(desc[i]);
+    h *= 1099511628211ULL;
+  }
+  ostringstream hex;
+  hex << std::hex << std::setw(16) << std::setfill('0') << h;
+  return hex.str();
+}
+
+string SamplerBase::gridCacheFile() const {
+  if ( theGridCache.empty() ) return "";
+  return theGridCache + "/" + gridHash() + ".grid";
+}
+
+bool SamplerBase::readGridCache() {
+  if ( theGridCache.empty() || !cachesGrid() ) return false;
+  string file = gridCacheFile();
+  if ( !ifstream(file.c_str()) ) return false;
+  PersistentIStream is(file);
+  int version = 0;
+  string hash;
+  is >> version >> hash;
+  if ( !is || version != gridCacheVersion || hash != gridHash() ) return false;
+  if ( !readGrid(is) || !is ) return false;
+  generator()->log() << "The grid of the sampler '" << name()
+		     << "' was restored from '" << file << "'." << endl;
+  return true;
+}
+
+void SamplerBase::writeGridCache() const {
+  if ( theGridCache.empty() || !cachesGrid() ) return;
+  string file = gridCacheFile();
+  ostringstream tmp;
+  tmp << file << ".tmp" << getpid();
+  bool ok = true;
+  {
+    PersistentOStream os(tmp.str());
+    os << gridCacheVersion << gridHash();
+    writeGrid(os);
+    ok = os.good();
+  }
+  if ( ok ) ok = ( std::rename(tmp.str().c_str(), file.c_str()) == 0 );
+  if ( !ok ) {
+    std::remove(tmp.str().c_str());
+    generator()->logWarning(
+      GridCacheWarning()
+      << "The grid of the sampler '" << name() << "' could not be "
+      << "written to '" << file << "'." << Exception::warning);
+  }
+}
+
 void SamplerBase::persistentOutput(PersistentOStream & os) const {
-  os << theEventHandler << theLastPoint;
+  os << theEventHandler << theLastPoint << theGridCache;
   // Add all member variable which should be written persistently here.
 }
 
 void SamplerBase::persistentInput(PersistentIStream & is, int) {
-  is >> theEventHandler >> theLastPoint;
+  is >> theEventHandler >> theLastPoint >> theGridCache;
   // Add all member variable which should be read persistently here.
 }
 
@@ -42,4 +164,13 @@ void SamplerBase::Init() {
      "space according to the cross sections for the proceses in the"
      "ThePEG::StandardEventHandler.");
 
+  static Parameter<SamplerBase,string> interfaceGridCache
+    ("GridCache",
+     "A directory in which the adapted grid of this sampler is cached. "
+     "The grid is saved in a file named after a hash of the processes, "
+     "cuts and luminosity function it was adapted for, and is restored "
+     "instead of being rebuilt when a run with the same setup is started. "
+     "If empty, no grids are cached. Only some samplers support caching.",
+     &SamplerBase::theGridCache, "", true, false);
+
 }
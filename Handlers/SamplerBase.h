@@ -44,7 +44,7 @@ public:
    */
   SamplerBase()
     : Interfaced(), 
-      theIntegrationList("") {}
+      theIntegrationList(""), theGridCache("") {}
 
   /**
    * Destructor.
@@ -257,6 +257,71 @@ public:
 
   //@}
 
+  /** @name Caching of adapted grids. */
+  //@{
+  /**
+   * Try to restore the adapted grid of this sampler from the grid
+   * cache. Only succeeds if a cache directory has been given, if the
+   * sub-class supports caching and if a file written for the same
+   * setup is found.
+   * @return true if the grid was restored.
+   */
+  bool readGridCache();
+
+  /**
+   * Save the adapted grid of this sampler in the grid cache, if a
+   * cache directory has been given and the sub-class supports
+   * caching. The file is first written under a temporary name and
+   * then moved in place, so that several jobs may share the same
+   * cache directory.
+   */
+  void writeGridCache() const;
+
+  /**
+   * Return a hash of everything the adapted grid depends on, as
+   * described by describeGrid().
+   */
+  string gridHash() const;
+
+  /**
+   * The name of the file used to cache the grid for the current
+   * setup. Empty if no cache directory has been given.
+   */
+  string gridCacheFile() const;
+  //@}
+
+protected:
+
+  /** @name Virtual functions to be overridden by sub-classes supporting grid caching. */
+  //@{
+  /**
+   * Return true if this sampler is able to cache its adapted grid.
+   */
+  virtual bool cachesGrid() const { return false; }
+
+  /**
+   * Write a description of everything the adapted grid depends on
+   * to \a os. The default version writes the dimensions and
+   * partons of each bin of the event handler and the values of all
+   * parameters and switches of the matrix elements, parton extractors,
+   * cuts and luminosity function, and of the objects they refer
+   * to. Sub-classes should call the base class version and add their
+   * own settings.
+   */
+  virtual void describeGrid(ostream & os) const;
+
+  /**
+   * Write the adapted grid to the stream \a os.
+   */
+  virtual void writeGrid(PersistentOStream &) const {}
+
+  /**
+   * Read the adapted grid from the stream \a is.
+   * @return true if successful.
+   */
+  virtual bool readGrid(PersistentIStream &) { return false; }
+  //@}
+
 protected:
 
   /**
@@ -309,6 +374,11 @@ private:
    */
   string theIntegrationList;
 
+  /**
+   * The directory in which adapted grids are cached.
+   */
+  string theGridCache;
+
   /**
    * The run level
    */
@@ -362,6 +432,14 @@ private:
    */
   SamplerBase & operator=(const SamplerBase &);
 
+public:
+
+  /** @cond EXCEPTIONCLASSES */
+  /** Exception class used by SamplerBase if the grid cache could not
+      be written. */
+  struct GridCacheWarning: public Exception {};
+  /** @endcond */
+
 };
 
 }
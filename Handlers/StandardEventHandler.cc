@@ -40,7 +40,8 @@
 using namespace ThePEG;
 
 StandardEventHandler::StandardEventHandler()
-  : EventHandler(false), collisionCuts(true), theLumiDim(0) {
+  : EventHandler(false), collisionCuts(true), theLumiDim(0),
+    theMergedStatistics(false), theMergedAttempts(0.0) {
   setupGroups();
 }
 
@@ -253,18 +254,18 @@ void StandardEventHandler::statistics(ostream & os) const {
   map<cPDPair, XSecStat> partonMap;
   map<MEPtr, XSecStat> meMap;
   map<PExtrPtr, XSecStat> extractMap;
-  XSecStat tot(sampler()->maxXSec());
+  XSecStat tot(statMaxXSec());
 
   for ( int i = 0, N = xCombs().size(); i < N; ++i ) {
     const StandardXComb & x = *xCombs()[i];
     if ( partonMap.find(x.partons()) == partonMap.end() )
-      partonMap[x.partons()] = XSecStat(sampler()->maxXSec());
+      partonMap[x.partons()] = XSecStat(statMaxXSec());
     partonMap[x.partons()] += x.stats();
     if ( meMap.find(x.matrixElement()) == meMap.end() )
-      meMap[x.matrixElement()] = XSecStat(sampler()->maxXSec());
+      meMap[x.matrixElement()] = XSecStat(statMaxXSec());
     meMap[x.matrixElement()] += x.stats();
     if ( extractMap.find(x.pExtractor()) == extractMap.end() )
-      extractMap[x.pExtractor()] = XSecStat(sampler()->maxXSec());
+      extractMap[x.pExtractor()] = XSecStat(statMaxXSec());
     extractMap[x.pExtractor()] += x.stats();
     tot += x.stats();
   }
@@ -284,13 +285,15 @@ void StandardEventHandler::statistics(ostream & os) const {
      << "   events     attempts             (nb)\n";
 
   os << line << "Total (from attempted events): including vetoed events" << setw(23)
-     << ouniterr(sampler()->integratedXSec(), 
-		 sampler()->integratedXSecErr(), nanobarn)
+     << ( theMergedStatistics?
+	  ouniterr(integratedXSec(), integratedXSecErr(), nanobarn):
+	  ouniterr(sampler()->integratedXSec(),
+		   sampler()->integratedXSecErr(), nanobarn) )
      << endl;
   os << line << "Total (from generated events):" 
      << setw(17) << tot.accepted() << setw(13)
      << tot.attempts() << setw(17)
-     << ouniterr(tot.xSec(sampler()->attempts()),tot.xSecErr(sampler()->attempts()) , nanobarn)
+     << ouniterr(tot.xSec(statAttempts()),tot.xSecErr(statAttempts()) , nanobarn)
      << "\n";
   os << "Events carry ";
   if ( weighted() )
@@ -310,7 +313,7 @@ void StandardEventHandler::statistics(ostream & os) const {
     n.resize(37, ' ');
     os << n << setw(11) << i->second.accepted() << setw(13)
        << i->second.attempts() << setw(17)
-       << ouniterr(i->second.xSec(sampler()->attempts()), i->second.xSecErr(sampler()->attempts()), nanobarn)
+       << ouniterr(i->second.xSec(statAttempts()), i->second.xSecErr(statAttempts()), nanobarn)
        << endl;
   }
   os << line;
@@ -324,7 +327,7 @@ void StandardEventHandler::statistics(ostream & os) const {
     n.resize(37, ' ');
     os << n << setw(11) << i->second.accepted() << setw(13)
        << i->second.attempts() << setw(17)
-       << ouniterr(i->second.xSec(sampler()->attempts()), i->second.xSecErr(sampler()->attempts()), nanobarn)
+       << ouniterr(i->second.xSec(statAttempts()), i->second.xSecErr(statAttempts()), nanobarn)
        << endl;
   }
   os << line;
@@ -336,7 +339,7 @@ void StandardEventHandler::statistics(ostream & os) const {
     n.resize(37, ' ');
     os << n << setw(11) << i->second.accepted() << setw(13)
        << i->second.attempts() << setw(17)
-       << ouniterr(i->second.xSec(sampler()->attempts()), i->second.xSecErr(sampler()->attempts()), nanobarn)
+       << ouniterr(i->second.xSec(statAttempts()), i->second.xSecErr(statAttempts()), nanobarn)
        << endl;
   }
   os << line;
@@ -347,7 +350,7 @@ void StandardEventHandler::statistics(ostream & os) const {
 
   for ( int i = 0, N = xCombs().size(); i < N; ++i ) {
     const StandardXComb & x = *xCombs()[i];
-    XSecStat xstat(sampler()->maxXSec());
+    XSecStat xstat(statMaxXSec());
     xstat += x.stats();
     os << "(" << x.pExtractor()->name() << ") "
        << x.partons().first->PDGName() << " "
@@ -356,7 +359,7 @@ void StandardEventHandler::statistics(ostream & os) const {
        << x.lastDiagram()->getTag() << ") " << endl
        << setw(48) << xstat.accepted() << setw(13) << xstat.attempts()
        << setw(17)
-       << ouniterr(xstat.xSec(sampler()->attempts()), xstat.xSecErr(sampler()->attempts()), nanobarn) << endl;
+       << ouniterr(xstat.xSec(statAttempts()), xstat.xSecErr(statAttempts()), nanobarn) << endl;
   }
 
   os << line;
@@ -364,28 +367,77 @@ void StandardEventHandler::statistics(ostream & os) const {
 }
 
 CrossSection StandardEventHandler::histogramScale() const {
-  xSecStats.maxXSec(sampler()->maxXSec());
-  return xSecStats.xSec(sampler()->attempts())/xSecStats.sumWeights();
+  xSecStats.maxXSec(statMaxXSec());
+  return xSecStats.xSec(statAttempts())/xSecStats.sumWeights();
 }
 
 CrossSection StandardEventHandler::integratedXSec() const {
-  xSecStats.maxXSec(sampler()->maxXSec());
-  return xSecStats.xSec(sampler()->attempts());
+  xSecStats.maxXSec(statMaxXSec());
+  return xSecStats.xSec(statAttempts());
 }
 
 CrossSection StandardEventHandler::integratedXSecErr() const {
-  xSecStats.maxXSec(sampler()->maxXSec());
-  return xSecStats.xSecErr(sampler()->attempts());
+  xSecStats.maxXSec(statMaxXSec());
+  return xSecStats.xSecErr(statAttempts());
 }
 
 CrossSection StandardEventHandler::integratedXSecNoReweight() const {
-  xSecStats.maxXSec(sampler()->maxXSec());
-  return xSecStats.xSecNoReweight(sampler()->attempts());
+  xSecStats.maxXSec(statMaxXSec());
+  return xSecStats.xSecNoReweight(statAttempts());
 }
 
 CrossSection StandardEventHandler::integratedXSecErrNoReweight() const {
-  xSecStats.maxXSec(sampler()->maxXSec());
-  return xSecStats.xSecErrNoReweight(sampler()->attempts());
+  xSecStats.maxXSec(statMaxXSec());
+  return xSecStats.xSecErrNoReweight(statAttempts());
+}
+
+CrossSection StandardEventHandler::statMaxXSec() const {
+  return theMergedStatistics? xSecStats.maxXSec(): sampler()->maxXSec();
+}
+
+double StandardEventHandler::statAttempts() const {
+  return theMergedStatistics? theMergedAttempts: sampler()->attempts();
+}
+
+void StandardEventHandler::outputStatistics(PersistentOStream & os) const {
+  os << ounit(sampler()->maxXSec(), picobarn) << sampler()->attempts();
+  xSecStats.outputSums(os);
+  os << long(xCombs().size());
+  for ( int i = 0, N = xCombs().size(); i < N; ++i )
+    xCombs()[i]->stats().outputSums(os);
+}
+
+void StandardEventHandler::mergeStatistics(PersistentIStream & is) {
+  CrossSection xmax;
+  double att = 0.0;
+  XSecStat tot;
+  long nbins = 0;
+  is >> iunit(xmax, picobarn) >> att;
+  tot.inputSums(is);
+  is >> nbins;
+  if ( nbins != long(xCombs().size()) )
+    throw Exception() << "Could not merge the statistics of event handler '"
+		      << name() << "' since the number of sub-processes "
+		      << "differ (" << nbins << " and " << xCombs().size()
+		      << ")." << Exception::runerror;
+  if ( !theMergedStatistics ) {
+    theMergedStatistics = true;
+    theMergedAttempts = 0.0;
+    xSecStats = XSecStat(xmax);
+    for ( int i = 0, N = xCombs().size(); i < N; ++i )
+      xCombs()[i]->reset();
+  }
+  // The weights of each run are given in units of its own
+  // overestimated cross section.
+  double scale =
+    xSecStats.maxXSec() > ZERO? double(xmax/xSecStats.maxXSec()): 1.0;
+  theMergedAttempts += att;
+  xSecStats.merge(tot, scale);
+  for ( int i = 0, N = xCombs().size(); i < N; ++i ) {
+    XSecStat x;
+    x.inputSums(is);
+    xCombs()[i]->merge(x, scale);
+  }
 }
 
 void StandardEventHandler::doinitrun() {
@@ -397,6 +449,7 @@ void StandardEventHandler::doinitrun() {
   for ( int i = 0, N = xCombs().size(); i < N; ++i )
     xCombs()[i]->reset();
   xSecStats.reset();
+  theMergedStatistics = false;
 }
 
 CrossSection StandardEventHandler::dSigDR(const vector<double> & r) {
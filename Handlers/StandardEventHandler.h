@@ -135,6 +135,18 @@ public:
    */
   virtual CrossSection integratedXSecErrNoReweight() const;
 
+  /**
+   * Write the overestimated cross section and the number of attempts
+   * of the sampler together with the raw sums of the total and
+   * per-XComb statistics.
+   */
+  virtual void outputStatistics(PersistentOStream &) const;
+
+  /**
+   * Add the statistics written by outputStatistics() in another run.
+   */
+  virtual void mergeStatistics(PersistentIStream &);
+
   /** @name Functions used for the actual generation */
   //@{
   /**
@@ -439,6 +451,31 @@ private:
    */
   mutable XSecStat xSecStats;
 
+  /**
+   * True if the statistics have been combined from other runs with
+   * mergeStatistics(), in which case the overestimated cross section
+   * is taken from xSecStats and the number of attempts from
+   * theMergedAttempts rather than from the sampler.
+   */
+  bool theMergedStatistics;
+
+  /**
+   * The summed number of attempts of the samplers in the runs
+   * combined with mergeStatistics().
+   */
+  double theMergedAttempts;
+
+  /**
+   * The overestimated cross section in which the weights in the
+   * statistics are given.
+   */
+  CrossSection statMaxXSec() const;
+
+  /**
+   * The number of attempts used to calculate the cross sections.
+   */
+  double statAttempts() const;
+
   /**
    * Standard Initialization object.
    */
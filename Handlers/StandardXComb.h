@@ -317,6 +317,13 @@ public:
    * Reset statistics.
    */
   virtual void reset() { theStats.reset(); }
+
+  /**
+   * Add the statistics \a x of another run, with weights given in
+   * units of an overestimated cross section which is \a scale times
+   * the one used in this run.
+   */
+  void merge(const XSecStat & x, double scale) { theStats.merge(x, scale); }
   //@}
 
   /** @name Access information used by the MEBase object. */
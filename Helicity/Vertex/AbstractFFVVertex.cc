@@ -20,6 +20,20 @@ void AbstractFFVVertex::Init() {
      " fermion-fermion-vector interactions");
 
 }
+
+void AbstractFFVVertex::evaluateAll(Energy2 q2,
+				    const vector<SpinorWaveFunction> & sp1,
+				    const vector<SpinorBarWaveFunction> & sbar2,
+				    const vector<VectorWaveFunction> & vec3,
+				    vector<Complex> & amp) {
+  amp.resize(sp1.size()*sbar2.size()*vec3.size());
+  vector<Complex>::iterator it = amp.begin();
+  for ( unsigned int i = 0; i < sp1.size(); ++i )
+    for ( unsigned int j = 0; j < sbar2.size(); ++j )
+      for ( unsigned int k = 0; k < vec3.size(); ++k )
+	*it++ = evaluate(q2,sp1[i],sbar2[j],vec3[k]);
+}
+
 SpinorWaveFunction 
 AbstractFFVVertex::evaluateSmall(Energy2 q2,int iopt, tcPDPtr out,
 				 const SpinorWaveFunction & sp1,
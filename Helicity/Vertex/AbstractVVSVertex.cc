@@ -22,3 +22,16 @@ void AbstractVVSVertex::Init() {
 
 }
 
+void AbstractVVSVertex::evaluateAll(Energy2 q2,
+				    const vector<VectorWaveFunction> & vec1,
+				    const vector<VectorWaveFunction> & vec2,
+				    const vector<ScalarWaveFunction> & sca3,
+				    vector<Complex> & amp) {
+  amp.resize(vec1.size()*vec2.size()*sca3.size());
+  vector<Complex>::iterator it = amp.begin();
+  for ( unsigned int i = 0; i < vec1.size(); ++i )
+    for ( unsigned int j = 0; j < vec2.size(); ++j )
+      for ( unsigned int k = 0; k < sca3.size(); ++k )
+	*it++ = evaluate(q2,vec1[i],vec2[j],sca3[k]);
+}
+
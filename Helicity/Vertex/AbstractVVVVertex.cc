@@ -22,3 +22,16 @@ void AbstractVVVVertex::Init() {
 
 }
 
+void AbstractVVVVertex::evaluateAll(Energy2 q2,
+				    const vector<VectorWaveFunction> & vec1,
+				    const vector<VectorWaveFunction> & vec2,
+				    const vector<VectorWaveFunction> & vec3,
+				    vector<Complex> & amp) {
+  amp.resize(vec1.size()*vec2.size()*vec3.size());
+  vector<Complex>::iterator it = amp.begin();
+  for ( unsigned int i = 0; i < vec1.size(); ++i )
+    for ( unsigned int j = 0; j < vec2.size(); ++j )
+      for ( unsigned int k = 0; k < vec3.size(); ++k )
+	*it++ = evaluate(q2,vec1[i],vec2[j],vec3[k]);
+}
+
@@ -41,6 +41,26 @@ public:
 			   const VectorWaveFunction & vec2,
 			   const VectorWaveFunction & vec3) = 0;
 
+  /**
+   * Evaluate the vertex for all combinations of the wavefunctions in
+   * \a vec1, \a vec2 and \a vec3, typically the different helicity
+   * states of each particle. All wavefunctions in each vector must be
+   * for the same particle and momentum, as the coupling is only
+   * calculated once, using the first wavefunction of each vector. The
+   * default version calls evaluate() for each combination.
+   * @param q2 The scale \f$q^2\f$ for the coupling at the vertex.
+   * @param vec1 The wavefunctions for the first  vector.
+   * @param vec2 The wavefunctions for the second vector.
+   * @param vec3 The wavefunctions for the third  vector.
+   * @param amp  Is filled with the amplitudes, where the one for
+   * <code>vec1[i]</code>, <code>vec2[j]</code> and <code>vec3[k]</code>
+   * is <code>amp[(i*vec2.size() + j)*vec3.size() + k]</code>.
+   */
+  virtual void evaluateAll(Energy2 q2, const vector<VectorWaveFunction> & vec1,
+			   const vector<VectorWaveFunction> & vec2,
+			   const vector<VectorWaveFunction> & vec3,
+			   vector<Complex> & amp);
+
   /**
    * Evaluate the off-shell vector coming from the vertex.
    * @param q2 The scale \f$q^2\f$ for the coupling at the vertex.
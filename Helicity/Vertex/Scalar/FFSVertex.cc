@@ -35,7 +35,7 @@ Complex FFSVertex::evaluate(Energy2 q2, const SpinorWaveFunction & sp,
 			    const SpinorBarWaveFunction & sbar,
 			    const ScalarWaveFunction & sca) {
   // calculate the couplings
-  setCoupling(q2,sp.particle(),sbar.particle(),sca.particle());
+  updateCoupling(q2,sp.particle(),sbar.particle(),sca.particle());
   Complex vertex(  _left*(sbar.s1()*sp.s1()+sbar.s2()*sp.s2())
 		   +_right*(sbar.s3()*sp.s3()+sbar.s4()*sp.s4())
 		   );
@@ -52,7 +52,7 @@ ScalarWaveFunction FFSVertex::evaluate(Energy2 q2,int iopt, tcPDPtr out,
   // work out the momentum of the off-shell particle
   Lorentz5Momentum pout = sbar.momentum()+sp.momentum();
   // first calculate the couplings
-  setCoupling(q2,sp.particle(),sbar.particle(),out);
+  updateCoupling(q2,sp.particle(),sbar.particle(),out);
   Energy2 p2   = pout.m2();
   Complex fact = -norm()*propagator(iopt,p2,out,mass,width);
   Complex output =  _left*(sbar.s1()*sp.s1()+sbar.s2()*sp.s2())
@@ -71,7 +71,7 @@ SpinorWaveFunction FFSVertex::evaluate(Energy2 q2, int iopt,tcPDPtr out,
   // work out the momentum of the off-shell particle
   Lorentz5Momentum pout = sp.momentum()+sca.momentum();
   // first calculate the couplings
-  setCoupling(q2,sp.particle(),out,sca.particle());
+  updateCoupling(q2,sp.particle(),out,sca.particle());
   Energy2 p2   = pout.m2();
   Complex fact = -norm()*sca.wave()*propagator(iopt,p2,out,mass,width);
   Complex ii(0.,1.);
@@ -103,7 +103,7 @@ SpinorBarWaveFunction FFSVertex::evaluate(Energy2 q2,int iopt,tcPDPtr out,
   // work out the momentum of the off-shell particle
   Lorentz5Momentum pout = sbar.momentum()+sca.momentum();
   // first calculate the couplings
-  setCoupling(q2,out,sbar.particle(),sca.particle());
+  updateCoupling(q2,out,sbar.particle(),sca.particle());
   Energy2 p2   = pout.m2();
   Complex fact = -norm()*sca.wave()*propagator(iopt,p2,out,mass,width);
   Complex ii(0.,1.);
@@ -33,7 +33,7 @@ Complex GeneralVVSVertex::evaluate(Energy2 q2,const VectorWaveFunction & vec1,
   // calculate kinematics
   if(kinematics()) calculateKinematics(pSca,pvec1,pvec2);
   // calculate coupling
-  setCoupling(q2, vec1.particle(), vec2.particle(), sca.particle());
+  updateCoupling(q2, vec1.particle(), vec2.particle(), sca.particle());
   Complex e1e2(vec1.wave().dot(vec2.wave()));
   complex<Energy> e1p1(vec1.wave().dot(pvec1));
   complex<Energy> e1p2(vec1.wave().dot(pvec2));
@@ -63,7 +63,7 @@ ScalarWaveFunction GeneralVVSVertex::evaluate(Energy2 q2,int iopt, tcPDPtr out,
   // calculate kinematics if needed
   if(kinematics()) calculateKinematics(pout,pvec1,pvec2);
   // calculate coupling
-  setCoupling(q2,Pvec1,Pvec2,out);
+  updateCoupling(q2,Pvec1,Pvec2,out);
   // propagator
   Complex prop = propagator(iopt,pout.m2(),out,mass,width);
   // lorentz part
@@ -92,7 +92,7 @@ VectorWaveFunction GeneralVVSVertex::evaluate(Energy2 q2,int iopt,tcPDPtr out,
   // calculate kinematics
   if(kinematics()) calculateKinematics(pSca,pvec1,pvec2);
   // calculate coupling
-  setCoupling(q2, out, vec.particle(), sca.particle());
+  updateCoupling(q2, out, vec.particle(), sca.particle());
   // prefactor
   Energy2 p2    = pvec1.m2();
   if(mass.real() < ZERO) mass   = out->mass();
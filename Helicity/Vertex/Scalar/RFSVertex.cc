@@ -34,7 +34,7 @@ Complex RFSVertex::evaluate(Energy2 q2,const RSSpinorWaveFunction & sp,
 			    const SpinorBarWaveFunction & sbar,
 			    const ScalarWaveFunction & sca) {
   // calculate the couplings
-  setCoupling(q2,sp.particle(),sbar.particle(),sca.particle());
+  updateCoupling(q2,sp.particle(),sbar.particle(),sca.particle());
   LorentzSpinor<double> wdot = sp.wave().dot(sbar.momentum());
   Complex lS = wdot. leftScalar(sbar.wave());
   Complex rS = wdot.rightScalar(sbar.wave());
@@ -46,7 +46,7 @@ Complex RFSVertex::evaluate(Energy2 q2,const SpinorWaveFunction & sp,
 		 const RSSpinorBarWaveFunction & sbar,
 		 const ScalarWaveFunction & sca) {
   // calculate the couplings
-  setCoupling(q2,sbar.particle(),sp.particle(),sca.particle());
+  updateCoupling(q2,sbar.particle(),sp.particle(),sca.particle());
   LorentzSpinorBar<double> wdot = sbar.wave().dot(sp.momentum());
   Complex lS = sp.wave(). leftScalar(wdot);
   Complex rS = sp.wave().rightScalar(wdot);
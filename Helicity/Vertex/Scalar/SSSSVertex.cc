@@ -36,7 +36,7 @@ Complex SSSSVertex::evaluate(Energy2 q2, const ScalarWaveFunction & sca1,
 			     const ScalarWaveFunction & sca3, 
 			     const ScalarWaveFunction & sca4) {
   // calculate the coupling
-  setCoupling(q2,sca1.particle(),sca2.particle(),
+  updateCoupling(q2,sca1.particle(),sca2.particle(),
 	      sca3.particle(),sca4.particle());
   // return the answer
   return Complex(0.,1.)*norm()*sca1.wave()*sca2.wave()*sca3.wave()*sca4.wave();
@@ -50,7 +50,7 @@ ScalarWaveFunction SSSSVertex::evaluate(Energy2 q2, int iopt, tcPDPtr out,
   // outgoing momentum 
   Lorentz5Momentum pout = sca1.momentum()+sca2.momentum()+sca3.momentum();
   // calculate the coupling
-  setCoupling(q2,sca1.particle(),sca2.particle(),sca3.particle(),out);
+  updateCoupling(q2,sca1.particle(),sca2.particle(),sca3.particle(),out);
   // wavefunction
   Energy2 p2   = pout.m2();
   Complex fact = -norm()*sca1.wave()*sca2.wave()*sca3.wave()*
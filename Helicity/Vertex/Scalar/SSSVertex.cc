@@ -35,7 +35,7 @@ Complex SSSVertex::evaluate(Energy2 q2,
 			    const ScalarWaveFunction & sca2,
  			    const ScalarWaveFunction & sca3) {
   // calculate the coupling
-  setCoupling(q2,sca1.particle(),sca2.particle(),sca3.particle());
+  updateCoupling(q2,sca1.particle(),sca2.particle(),sca3.particle());
   // return the answer
   return Complex(0.,1.)*norm()*sca1.wave()*sca2.wave()*sca3.wave();
 }
@@ -49,7 +49,7 @@ ScalarWaveFunction SSSVertex::evaluate(Energy2 q2,int iopt, tcPDPtr out,
   // outgoing momentum 
   Lorentz5Momentum pout = sca1.momentum()+sca2.momentum(); 
   // calculate the coupling
-  setCoupling(q2,sca1.particle(),sca2.particle(),out);
+  updateCoupling(q2,sca1.particle(),sca2.particle(),out);
   // wavefunction
   Energy2 p2=pout.m2();
   Complex fact=-norm()*sca1.wave()*sca2.wave()*propagator(iopt,p2,out,mass,width);
@@ -36,7 +36,7 @@ Complex VSSVertex::evaluate(Energy2 q2, const VectorWaveFunction & vec,
 			    const ScalarWaveFunction & sca1,
 			    const ScalarWaveFunction & sca2) {
   // calculate the coupling
-  setCoupling(q2,vec.particle(),sca1.particle(),sca2.particle());
+  updateCoupling(q2,vec.particle(),sca1.particle(),sca2.particle());
   // calculate the vertex
   return UnitRemoval::InvE * -Complex(0.,1.) * norm() * sca1.wave()*sca2.wave()*
     vec.wave().dot(sca1.momentum()-sca2.momentum());
@@ -51,7 +51,7 @@ VectorWaveFunction VSSVertex::evaluate(Energy2 q2, int iopt, tcPDPtr out,
   // outgoing momentum 
   Lorentz5Momentum pout(sca1.momentum()+sca2.momentum());
   // calculate the coupling
-  setCoupling(q2,out,sca1.particle(),sca2.particle());
+  updateCoupling(q2,out,sca1.particle(),sca2.particle());
   // mass and width
   if(mass.real() < ZERO)  mass   = out->mass();
   complex<Energy2> mass2 = sqr(mass);
@@ -85,7 +85,7 @@ ScalarWaveFunction VSSVertex::evaluate(Energy2 q2, int iopt, tcPDPtr out,
   // momentum of the particle
   Lorentz5Momentum pout = sca.momentum()+vec.momentum(); 
   // calculate the coupling
-  setCoupling(q2,vec.particle(),sca.particle(),out);
+  updateCoupling(q2,vec.particle(),sca.particle(),out);
   // calculate the prefactor
   Energy2 p2   = pout.m2();
   Complex fact = norm()*sca.wave()*propagator(iopt,p2,out,mass,width);
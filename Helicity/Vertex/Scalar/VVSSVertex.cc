@@ -36,7 +36,7 @@ Complex VVSSVertex::evaluate(Energy2 q2,const VectorWaveFunction & vec1,
 			     const ScalarWaveFunction & sca1, 
 			     const ScalarWaveFunction & sca2) {
   // calculate the coupling
-  setCoupling(q2,vec1.particle(),vec2.particle(),
+  updateCoupling(q2,vec1.particle(),vec2.particle(),
 	      sca1.particle(),sca2.particle());
   // evaluate the vertex
   return Complex(0.,1.)*norm()*sca1.wave()*sca2.wave()*
@@ -53,7 +53,7 @@ VectorWaveFunction VVSSVertex::evaluate(Energy2 q2, int iopt, tcPDPtr out,
   // outgoing momentum 
   Lorentz5Momentum pout = vec.momentum()+sca1.momentum()+sca2.momentum();
   // calculate the coupling
-  setCoupling(q2,out,vec.particle(),sca1.particle(),sca2.particle());
+  updateCoupling(q2,out,vec.particle(),sca1.particle(),sca2.particle());
   // prefactor
   Energy2 p2    = pout.m2();
   if(mass.real() < ZERO) mass   = out->mass();
@@ -83,7 +83,7 @@ ScalarWaveFunction VVSSVertex::evaluate(Energy2 q2, int iopt,tcPDPtr out,
   // outgoing momentum 
   Lorentz5Momentum pout = vec1.momentum()+vec2.momentum()+sca.momentum(); 
   // calculate the coupling
-  setCoupling(q2,vec1.particle(),vec2.particle(),out,sca.particle());
+  updateCoupling(q2,vec1.particle(),vec2.particle(),out,sca.particle());
   // prefactor
   Energy2 p2   =  pout.m2();
   Complex fact = -norm()*sca.wave()*propagator(iopt,p2,out,mass,width);
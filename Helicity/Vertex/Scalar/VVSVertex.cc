@@ -37,11 +37,34 @@ Complex VVSVertex::evaluate(Energy2 q2,const VectorWaveFunction & vec1,
 			    const VectorWaveFunction & vec2, 
 			    const ScalarWaveFunction & sca) {
   // calculate the coupling
-  setCoupling(q2,vec1.particle(),vec2.particle(),sca.particle());
+  updateCoupling(q2,vec1.particle(),vec2.particle(),sca.particle());
   // evaluate the vertex
   return Complex(0.,1.)*norm()*sca.wave()*vec1.wave().dot(vec2.wave());
 }
 
+// evaluate the vertex for all combinations of helicities
+void VVSVertex::evaluateAll(Energy2 q2,const vector<VectorWaveFunction> & vec1,
+			    const vector<VectorWaveFunction> & vec2,
+			    const vector<ScalarWaveFunction> & sca,
+			    vector<Complex> & amp) {
+  const unsigned int n1 = vec1.size(), n2 = vec2.size(), n3 = sca.size();
+  amp.resize(n1*n2*n3);
+  if ( amp.empty() ) return;
+  // calculate the coupling
+  updateCoupling(q2,vec1[0].particle(),vec2[0].particle(),sca[0].particle());
+  // the scalar wavefunctions including the coupling
+  vector<Complex> fact(n3);
+  for(unsigned int k=0;k<n3;++k) fact[k] = Complex(0.,1.)*norm()*sca[k].wave();
+  // evaluate the vertex
+  for(unsigned int i=0;i<n1;++i) {
+    for(unsigned int j=0;j<n2;++j) {
+      Complex dot = vec1[i].wave().dot(vec2[j].wave());
+      for(unsigned int k=0;k<n3;++k)
+	amp[(i*n2+j)*n3+k] = fact[k]*dot;
+    }
+  }
+}
+
 // evaluate an off-shell vector
 VectorWaveFunction VVSVertex::evaluate(Energy2 q2, int iopt,tcPDPtr out,
 				       const VectorWaveFunction & vec,
@@ -51,7 +74,7 @@ VectorWaveFunction VVSVertex::evaluate(Energy2 q2, int iopt,tcPDPtr out,
   // outgoing momentum 
   Lorentz5Momentum pout = vec.momentum()+sca.momentum();
   // calculate the coupling
-  setCoupling(q2,out,vec.particle(),sca.particle());
+  updateCoupling(q2,out,vec.particle(),sca.particle());
   // prefactor
   Energy2 p2    = pout.m2();
   if(mass.real() < ZERO) mass   = out->mass();
@@ -80,7 +103,7 @@ ScalarWaveFunction VVSVertex::evaluate(Energy2 q2, int iopt,tcPDPtr out,
   // outgoing momentum 
   Lorentz5Momentum pout = vec1.momentum()+vec2.momentum();
   // calculate the coupling
-  setCoupling(q2,vec1.particle(),vec2.particle(),out);
+  updateCoupling(q2,vec1.particle(),vec2.particle(),out);
   // prefactor
   Energy2 p2   =  pout.m2();
   Complex fact = -norm()*propagator(iopt,p2,out,mass,width);
@@ -37,7 +37,7 @@ Complex FFTVertex::evaluate(Energy2 q2,const SpinorWaveFunction & sp,
 			    const SpinorBarWaveFunction & sbar,
 			    const TensorWaveFunction & ten) {
   // set the couplings
-  setCoupling(q2,sp.particle(),sbar.particle(),ten.particle());
+  updateCoupling(q2,sp.particle(),sbar.particle(),ten.particle());
   // vector current
   LorentzPolarizationVector as = sp.wave().vectorCurrent(sbar.wave());
   // momentum difference
@@ -65,7 +65,7 @@ SpinorWaveFunction FFTVertex::evaluate(Energy2 q2, int iopt, tcPDPtr out,
   // momentum of the outgoing fermion
   Lorentz5Momentum pout = ten.momentum()+sp.momentum();
   // set the couplings
-  setCoupling(q2,sp.particle(),out,ten.particle());
+  updateCoupling(q2,sp.particle(),out,ten.particle());
   Complex ii(0.,1.);
   // trace of the tensor
   Complex trace = ten.tt()-ten.xx()-ten.yy()-ten.zz();
@@ -134,7 +134,7 @@ SpinorBarWaveFunction FFTVertex::evaluate(Energy2 q2, int iopt, tcPDPtr out,
   // momentum of the outgoing fermion
   Lorentz5Momentum pout = ten.momentum()+sbar.momentum();
   // set the couplings
-  setCoupling(q2,out,sbar.particle(),ten.particle());
+  updateCoupling(q2,out,sbar.particle(),ten.particle());
   Complex ii(0.,1.);
   // trace of the tensor
   Complex trace = ten.tt()-ten.xx()-ten.yy()-ten.zz();
@@ -200,7 +200,7 @@ TensorWaveFunction FFTVertex::evaluate(Energy2 q2, int iopt, tcPDPtr out,
 				       complex<Energy> mass,
 				       complex<Energy> width) {
   // calculating the couplings
-  setCoupling(q2,sp.particle(),sbar.particle(),out);
+  updateCoupling(q2,sp.particle(),sbar.particle(),out);
   Complex ii(0.,1.);
   // momentum of the outgoing tensor
   Lorentz5Momentum pout = sp.momentum()+sbar.momentum();
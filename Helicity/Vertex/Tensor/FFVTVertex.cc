@@ -37,7 +37,7 @@ Complex FFVTVertex::evaluate(Energy2 q2, const SpinorWaveFunction & sp,
 			     const VectorWaveFunction & vec,
 			     const TensorWaveFunction & ten) {
   // set the couplings
-  setCoupling(q2,sp.particle(),sbar.particle(),
+  updateCoupling(q2,sp.particle(),sbar.particle(),
 	      vec.particle(),ten.particle());
   Complex ii(0.,1.);
   // vector current
@@ -35,7 +35,7 @@ Complex SSTVertex::evaluate(Energy2 q2, const ScalarWaveFunction & sca1,
     				const ScalarWaveFunction & sca2,
     				const TensorWaveFunction & ten) {
   // obtain the coupling
-  setCoupling(q2,sca1.particle(),sca2.particle(),ten.particle());
+  updateCoupling(q2,sca1.particle(),sca2.particle(),ten.particle());
   Complex ii(0.,1.);
   // evaluate the trace of the tensor
   Complex trace = ten.tt()-ten.xx()-ten.yy()-ten.zz();
@@ -62,7 +62,7 @@ TensorWaveFunction SSTVertex::evaluate(Energy2 q2, int iopt, tcPDPtr out,
 				       const ScalarWaveFunction & sca2,
 				       complex<Energy> mass, complex<Energy> width) {
   // obtain the coupling
-  setCoupling(q2,sca1.particle(),sca2.particle(),out);
+  updateCoupling(q2,sca1.particle(),sca2.particle(),out);
   // array for the tensor
   Complex ten[4][4];
   // calculate the outgoing momentum
@@ -129,7 +129,7 @@ ScalarWaveFunction SSTVertex::evaluate(Energy2 q2,int iopt, tcPDPtr out,
 				       const TensorWaveFunction & ten,
 				       complex<Energy> mass, complex<Energy> width) {
   // obtain the coupling
-  setCoupling(q2,sca.particle(),out,ten.particle());
+  updateCoupling(q2,sca.particle(),out,ten.particle());
   // calculate the outgoing momentum
   Lorentz5Momentum pout = sca.momentum()+ten.momentum();
   // prefactors
@@ -38,7 +38,7 @@ Complex VVTVertex::evaluate(Energy2 q2, const VectorWaveFunction & vec1,
 			    const TensorWaveFunction & ten,
 			    Energy vmass) {
   // set the couplings
-  setCoupling(q2,vec1.particle(),vec2.particle(),ten.particle());
+  updateCoupling(q2,vec1.particle(),vec2.particle(),ten.particle());
   // mass of the vector
   if(vmass<ZERO) vmass = vec1.particle()->mass();
   // mass+k1.k2
@@ -77,7 +77,7 @@ VectorWaveFunction VVTVertex::evaluate(Energy2 q2, int iopt, tcPDPtr out,
 				       complex<Energy> mass,
 				       complex<Energy> width) {
   // evaluate the couplings
-  setCoupling(q2,vec.particle(),out,ten.particle());
+  updateCoupling(q2,vec.particle(),out,ten.particle());
   // outgoing momentum
   Lorentz5Momentum pout = ten.momentum()+vec.momentum();
   // normalisation factor
@@ -178,7 +178,7 @@ TensorWaveFunction VVTVertex::evaluate(Energy2 q2, int iopt,tcPDPtr out,
 				       complex<Energy> tmass,
 				       complex<Energy> width) {
   // coupling
-  setCoupling(q2,vec1.particle(),vec2.particle(),out);
+  updateCoupling(q2,vec1.particle(),vec2.particle(),out);
   // momenta of the outgoing tensor
   // outgoing momentum
   Lorentz5Momentum pout= vec1.momentum()+vec2.momentum();
@@ -36,7 +36,7 @@ Complex VVVTVertex::evaluate(Energy2 q2, const VectorWaveFunction & vec1,
 			     const VectorWaveFunction & vec3,
 			     const TensorWaveFunction & ten) {
   // set the couplings
-  setCoupling(q2,vec1.particle(),vec2.particle(),
+  updateCoupling(q2,vec1.particle(),vec2.particle(),
 	      vec3.particle(),ten.particle());
   Complex ii(0.,1.);
   // dot products of the wavefunctions
@@ -38,7 +38,7 @@ Complex FFVVertex::evaluate(Energy2 q2,
 			    const VectorWaveFunction & vec) {
   // first calculate the couplings
   if(kinematics()) calculateKinematics(sp.momentum(),sbar.momentum(),vec.momentum());
-  setCoupling(q2,sp.particle(),sbar.particle(),vec.particle());
+  updateCoupling(q2,sp.particle(),sbar.particle(),vec.particle());
   Complex ii(0.,1.);
   // useful combinations of the polarization vector components
   Complex e0p3=vec.t()+vec.z();
@@ -59,6 +59,44 @@ Complex FFVVertex::evaluate(Energy2 q2,
   return vertex*norm();
 }
 
+// evaluate the vertex for all combinations of helicities
+void FFVVertex::evaluateAll(Energy2 q2,
+			    const vector<SpinorWaveFunction> & sp,
+			    const vector<SpinorBarWaveFunction> & sbar,
+			    const vector<VectorWaveFunction> & vec,
+			    vector<Complex> & amp) {
+  const unsigned int n1 = sp.size(), n2 = sbar.size(), n3 = vec.size();
+  amp.resize(n1*n2*n3);
+  if ( amp.empty() ) return;
+  // first calculate the couplings
+  if(kinematics()) calculateKinematics(sp[0].momentum(),sbar[0].momentum(),
+				       vec[0].momentum());
+  updateCoupling(q2,sp[0].particle(),sbar[0].particle(),vec[0].particle());
+  Complex ii(0.,1.);
+  Complex fact = norm();
+  for(unsigned int k=0;k<n3;++k) {
+    // useful combinations of the polarization vector components
+    Complex e0p3=vec[k].t()+vec[k].z();
+    Complex e0m3=vec[k].t()-vec[k].z();
+    Complex e1p2=vec[k].x()+ii*vec[k].y();
+    Complex e1m2=vec[k].x()-ii*vec[k].y();
+    for(unsigned int i=0;i<n1;++i) {
+      // products of the spinor and the polarization vector
+      Complex l3 = sp[i].s1()*e0p3+sp[i].s2()*e1m2;
+      Complex l4 = sp[i].s1()*e1p2+sp[i].s2()*e0m3;
+      Complex r1 = sp[i].s3()*e0m3-sp[i].s4()*e1m2;
+      Complex r2 = sp[i].s3()*e1p2-sp[i].s4()*e0p3;
+      for(unsigned int j=0;j<n2;++j) {
+	Complex vertex(0.);
+	if(_left!=0.) vertex += _left*(+sbar[j].s3()*l3+sbar[j].s4()*l4);
+	if(_right!=0.) vertex += _right*(+sbar[j].s1()*r1-sbar[j].s2()*r2);
+	vertex*=ii;
+	amp[(i*n2+j)*n3+k] = vertex*fact;
+      }
+    }
+  }
+}
+
 // evaluate an off-shell spinor
 SpinorWaveFunction FFVVertex::evaluate(Energy2 q2, int iopt,tcPDPtr  out,
 				       const SpinorWaveFunction & sp,
@@ -72,7 +110,7 @@ SpinorWaveFunction FFVVertex::evaluate(Energy2 q2, int iopt,tcPDPtr  out,
   Lorentz5Momentum pout = sp.momentum()+vec.momentum(); 
   // first calculate the couplings
   if(kinematics()) calculateKinematics(sp.momentum(),pout,vec.momentum());
-  setCoupling(q2,Psp,out,Pvec);
+  updateCoupling(q2,Psp,out,Pvec);
   Complex ii(0.,1.);  // now evaluate the contribution
   // polarization components
   Complex e0p3 = vec.t() +  vec.z();
@@ -123,7 +161,7 @@ SpinorBarWaveFunction FFVVertex::evaluate(Energy2 q2,int iopt,tcPDPtr  out,
   Lorentz5Momentum pout = sbar.momentum()+vec.momentum();
   // first calculate the couplings
   if(kinematics()) calculateKinematics(pout,sbar.momentum(),vec.momentum());
-  setCoupling(q2,out,sbar.particle(),vec.particle());
+  updateCoupling(q2,out,sbar.particle(),vec.particle());
   Complex ii(0.,1.);
   // now evaluate the contribution
   // polarization components
@@ -174,7 +212,7 @@ VectorWaveFunction FFVVertex::evaluate(Energy2 q2,int iopt,tcPDPtr  out,
   Lorentz5Momentum pout = sbar.momentum()+sp.momentum();
   // first calculate the couplings
   if(kinematics()) calculateKinematics(sp.momentum(),sbar.momentum(),pout);
-  setCoupling(q2,sp.particle(),sbar.particle(),out);
+  updateCoupling(q2,sp.particle(),sbar.particle(),out);
   Complex ii(0.,1.);
   // overall factor
   Energy2 p2 = pout.m2();
@@ -228,7 +266,7 @@ SpinorWaveFunction FFVVertex::evaluateSmall(Energy2 q2,int iopt, tcPDPtr out,
   assert( vhel == 0 || vhel == 2 );
   SpinorWaveFunction output;
   // first calculate the couplings
-  setCoupling(q2,sp.particle(),out,vec.particle());
+  updateCoupling(q2,sp.particle(),out,vec.particle());
   Complex ii(0.,1.);
   if(mass < ZERO) mass = iopt==5 ? ZERO : out->mass();
   Lorentz5Momentum pout = sp.momentum()+vec.momentum();
@@ -358,7 +396,7 @@ SpinorBarWaveFunction FFVVertex::evaluateSmall(Energy2 q2,int iopt, tcPDPtr out,
   assert( vhel == 0 || vhel == 2 );
   SpinorBarWaveFunction output;
   // first calculate the couplings
-  setCoupling(q2,out,sbar.particle(),vec.particle());
+  updateCoupling(q2,out,sbar.particle(),vec.particle());
   Complex ii(0.,1.);
   if(mass < ZERO) mass  = iopt==5 ? ZERO : out->mass();
   Lorentz5Momentum pout = sbar.momentum()+vec.momentum();
@@ -63,6 +63,25 @@ public:
 			   const SpinorBarWaveFunction & sbar2,
 			   const VectorWaveFunction & vec3);
 
+  /**
+   * Evaluate the vertex for all combinations of the wavefunctions in
+   * \a sp1, \a sbar2 and \a vec3. The coupling is only calculated
+   * once and the products of each spinor with each polarization vector
+   * are reused for all the barred spinors, giving the same results as
+   * evaluate().
+   * @param q2 The scale \f$q^2\f$ for the coupling at the vertex.
+   * @param sp1   The wavefunctions for the ferimon.
+   * @param sbar2 The wavefunctions for the antifermion.
+   * @param vec3  The wavefunctions for the vector.
+   * @param amp   Is filled with the amplitudes, where the one for
+   * <code>sp1[i]</code>, <code>sbar2[j]</code> and <code>vec3[k]</code>
+   * is <code>amp[(i*sbar2.size() + j)*vec3.size() + k]</code>.
+   */
+  virtual void evaluateAll(Energy2 q2,const vector<SpinorWaveFunction> & sp1,
+			   const vector<SpinorBarWaveFunction> & sbar2,
+			   const vector<VectorWaveFunction> & vec3,
+			   vector<Complex> & amp);
+
   /**
    * Evaluate the off-shell barred spinor coming from the vertex.
    * @param q2 The scale \f$q^2\f$ for the coupling at the vertex.
@@ -38,7 +38,7 @@ Complex GeneralFFVVertex::evaluate(Energy2 q2,
 				   const SpinorBarWaveFunction & sbar,
 				   const VectorWaveFunction & vec) {
   // first calculate the couplings
-  setCoupling(q2,sp.particle(),sbar.particle(),vec.particle());
+  updateCoupling(q2,sp.particle(),sbar.particle(),vec.particle());
   const Complex ii(0.,1.);
   const complex<InvEnergy> zero(ZERO,ZERO);
   // useful combinations of the polarization vector components
@@ -97,7 +97,7 @@ SpinorWaveFunction GeneralFFVVertex::evaluate(Energy2 q2, int iopt,tcPDPtr  out,
   tcPDPtr  Psp=sp.particle();
   tcPDPtr  Pvec=vec.particle();
   // first calculate the couplings
-  setCoupling(q2,Psp,out,Pvec);
+  updateCoupling(q2,Psp,out,Pvec);
   const Complex ii(0.,1.);
   const complex<InvEnergy> zero(ZERO,ZERO);
   // work out the momentum of the off-shell particle
@@ -182,7 +182,7 @@ SpinorBarWaveFunction GeneralFFVVertex::evaluate(Energy2 q2,int iopt,tcPDPtr  ou
 						 complex<Energy> mass,
 						 complex<Energy> width) {
   // first calculate the couplings
-  setCoupling(q2,out,sbar.particle(),vec.particle());
+  updateCoupling(q2,out,sbar.particle(),vec.particle());
   const Complex ii(0.,1.);
   const complex<InvEnergy> zero(ZERO,ZERO);
   // work out the momentum of the off-shell particle
@@ -266,7 +266,7 @@ VectorWaveFunction GeneralFFVVertex::evaluate(Energy2 q2,int iopt,tcPDPtr  out,
 					      complex<Energy> mass,
 					      complex<Energy> width) {
   // first calculate the couplings
-  setCoupling(q2,sp.particle(),sbar.particle(),out);
+  updateCoupling(q2,sp.particle(),sbar.particle(),out);
   const Complex ii(0.,1.);
   const complex<InvEnergy> zero(ZERO,ZERO);
   // work out the momentum of the off-shell particle
@@ -36,7 +36,7 @@ Complex RFVVertex::evaluate(Energy2 q2,const RSSpinorWaveFunction & sp,
 			    const SpinorBarWaveFunction & sbar,
 			    const VectorWaveFunction & vec) {
   // calculate the couplings
-  setCoupling(q2,sp.particle(),sbar.particle(),vec.particle());
+  updateCoupling(q2,sp.particle(),sbar.particle(),vec.particle());
   LorentzSpinor<double> wdot1 = sp.wave().dot(vec.wave());
   Complex lS1 = wdot1. leftScalar(sbar.wave());
   Complex rS1 = wdot1.rightScalar(sbar.wave());
@@ -57,7 +57,7 @@ Complex RFVVertex::evaluate(Energy2 q2,const SpinorWaveFunction & sp,
 			    const RSSpinorBarWaveFunction & sbar,
 			    const VectorWaveFunction & vec) {
   // calculate the couplings
-  setCoupling(q2,sbar.particle(),sp.particle(),vec.particle());
+  updateCoupling(q2,sbar.particle(),sp.particle(),vec.particle());
   LorentzSpinorBar<double> wdot1 = sbar.wave().dot(vec.wave());
   Complex lS1 = sp.wave(). leftScalar(wdot1);
   Complex rS1 = sp.wave().rightScalar(wdot1);
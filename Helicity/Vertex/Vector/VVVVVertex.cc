@@ -36,7 +36,7 @@ Complex VVVVVertex::evaluate(Energy2 q2 , int iopt,
 			     const VectorWaveFunction & vec3,
 			     const VectorWaveFunction & vec4) {
   // workout the coupling
-  setCoupling(q2,vec1.particle(),vec2.particle(),
+  updateCoupling(q2,vec1.particle(),vec2.particle(),
 	      vec3.particle(),vec4.particle());
   Complex vertex,ii(0.,1.);
   // calculate the vertex
@@ -37,7 +37,7 @@ Complex VVVVertex::evaluate(Energy2 q2, const VectorWaveFunction & vec1,
 			    const VectorWaveFunction & vec2,
 			    const VectorWaveFunction & vec3) {
   // calculate the coupling
-  setCoupling(q2,vec1.particle(),vec2.particle(),vec3.particle());
+  updateCoupling(q2,vec1.particle(),vec2.particle(),vec3.particle());
   complex<Energy> alpha1(ZERO);
   // decide if we need to use special treatment to avoid gauge cancelations
   // first vector
@@ -76,6 +76,80 @@ Complex VVVVertex::evaluate(Energy2 q2, const VectorWaveFunction & vec1,
   return Complex(0.,1.)*norm()*UnitRemoval::InvE*
     (dot12*(dotp13-dotp23)+dot23*(dotp21-dotp31)+dot13*(dotp32-dotp12));
 }
+
+
+namespace {
+
+/**
+ * Return true and set \a alpha if the special treatment to avoid
+ * gauge cancellations in VVVVertex::evaluate() should be applied to
+ * the polarization vector \a vec.
+ */
+bool gaugeAlpha(const VectorWaveFunction & vec, complex<Energy> & alpha) {
+  if(abs(vec.t())!=0.) {
+    if(abs(vec.t())>0.1*max( max(abs(vec.x()),abs(vec.y())),abs(vec.z()))) {
+      alpha=vec.e()/vec.t();
+      return true;
+    }
+  }
+  return false;
+}
+
+}
+
+// evaluate the vertex for all combinations of helicities
+void VVVVertex::evaluateAll(Energy2 q2, const vector<VectorWaveFunction> & vec1,
+			    const vector<VectorWaveFunction> & vec2,
+			    const vector<VectorWaveFunction> & vec3,
+			    vector<Complex> & amp) {
+  const unsigned int n1 = vec1.size(), n2 = vec2.size(), n3 = vec3.size();
+  amp.resize(n1*n2*n3);
+  if ( amp.empty() ) return;
+  // calculate the coupling
+  updateCoupling(q2,vec1[0].particle(),vec2[0].particle(),vec3[0].particle());
+  complex<InvEnergy> fact = Complex(0.,1.)*norm()*UnitRemoval::InvE;
+  // decide for which vectors we need to use special treatment to
+  // avoid gauge cancelations
+  vector<complex<Energy> > alpha(n1+n2+n3, complex<Energy>(ZERO));
+  vector<bool> gauge(n1+n2+n3);
+  for(unsigned int i=0;i<n1;++i) gauge[i]       = gaugeAlpha(vec1[i],alpha[i]);
+  for(unsigned int j=0;j<n2;++j) gauge[n1+j]    = gaugeAlpha(vec2[j],alpha[n1+j]);
+  for(unsigned int k=0;k<n3;++k) gauge[n1+n2+k] = gaugeAlpha(vec3[k],alpha[n1+n2+k]);
+  // dot products of the polarization vectors
+  vector<Complex> dot12(n1*n2), dot13(n1*n3), dot23(n2*n3);
+  for(unsigned int i=0;i<n1;++i) {
+    for(unsigned int j=0;j<n2;++j)
+      dot12[i*n2+j] = vec1[i].wave().dot(vec2[j].wave());
+    for(unsigned int k=0;k<n3;++k)
+      dot13[i*n3+k] = vec1[i].wave().dot(vec3[k].wave());
+  }
+  for(unsigned int j=0;j<n2;++j)
+    for(unsigned int k=0;k<n3;++k)
+      dot23[j*n3+k] = vec3[k].wave().dot(vec2[j].wave());
+  const LorentzPolarizationVectorE p1(vec1[0].momentum());
+  const LorentzPolarizationVectorE p2(vec2[0].momentum());
+  const LorentzPolarizationVectorE p3(vec3[0].momentum());
+  for(unsigned int i=0;i<n1;++i) {
+    for(unsigned int j=0;j<n2;++j) {
+      for(unsigned int k=0;k<n3;++k) {
+	// the last vector needing special treatment fixes the gauge
+	complex<Energy> alpha1 =
+	  gauge[n1+n2+k] ? alpha[n1+n2+k] : gauge[n1+j] ? alpha[n1+j] : alpha[i];
+	// dot products of polarization vectors and momentum
+	complex<Energy> dotp13 = vec3[k].wave().dot(p1 - alpha1 * vec1[i].wave());
+	complex<Energy> dotp23 = vec3[k].wave().dot(p2 - alpha1 * vec2[j].wave());
+	complex<Energy> dotp21 = vec1[i].wave().dot(p2 - alpha1 * vec2[j].wave());
+	complex<Energy> dotp31 = vec1[i].wave().dot(p3 - alpha1 * vec3[k].wave());
+	complex<Energy> dotp32 = vec2[j].wave().dot(p3 - alpha1 * vec3[k].wave());
+	complex<Energy> dotp12 = vec2[j].wave().dot(p1 - alpha1 * vec1[i].wave());
+	// finally calculate the vertex
+	amp[(i*n2+j)*n3+k] = fact*
+	  (dot12[i*n2+j]*(dotp13-dotp23)+dot23[j*n3+k]*(dotp21-dotp31)
+	   +dot13[i*n3+k]*(dotp32-dotp12));
+      }
+    }
+  }
+}
   
 // off-shell vector
 VectorWaveFunction VVVVertex::evaluate(Energy2 q2,int iopt, tcPDPtr out,
@@ -85,7 +159,7 @@ VectorWaveFunction VVVVertex::evaluate(Energy2 q2,int iopt, tcPDPtr out,
   // output momenta
   Lorentz5Momentum pout =vec1.momentum()+vec2.momentum();
   // calculate the coupling
-  setCoupling(q2,out,vec1.particle(),vec2.particle());
+  updateCoupling(q2,out,vec1.particle(),vec2.particle());
   // prefactor
   Energy2 p2    = pout.m2();
   Complex fact  = norm()*propagator(iopt,p2,out,mass,width);
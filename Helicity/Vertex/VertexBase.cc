@@ -32,7 +32,9 @@ VertexBase::VertexBase(VertexType::T name, bool kine)
     _ordergEM(0), _ordergS(0),
     _coupopt(0), _gs(sqrt(4.*Constants::pi*0.3)), 
     _ee(sqrt(4.*Constants::pi/137.04)),
-    _sw(sqrt(0.232)) 
+    _sw(sqrt(0.232)),
+    _cacheCouplings(true), _cacheQ2(ZERO), _cacheKine(), _cacheValid(false),
+    _cacheHits(0), _cacheMisses(0)
 {
   assert ( name != VertexType::UNDEFINED ); 
   // Count number of lines from length of 'name'
@@ -90,19 +92,45 @@ void VertexBase::doinit() {
 		       << " a perturbative interaction. Either it's an"
 		       << " effective vertex or something is wrong.\n";
   assert(_npoint<=2+_ordergEM+_ordergS);
+  clearCouplingCache();
+}
+
+void VertexBase::doinitrun() {
+  Interfaced::doinitrun();
+  clearCouplingCache();
+}
+
+bool VertexBase::couplingCached(Energy2 q2, tcPDPtr part1, tcPDPtr part2,
+				tcPDPtr part3, tcPDPtr part4) {
+  // The couplings may only depend on the arguments of setCoupling()
+  // and, for loop-induced vertices, on the kinematic invariants.
+  if ( _cacheValid && _cacheQ2 == q2 &&
+       _cacheParticles[0] == part1 && _cacheParticles[1] == part2 &&
+       _cacheParticles[2] == part3 && _cacheParticles[3] == part4 &&
+       ( !_calckinematics || _cacheKine == _kine ) ) {
+    ++_cacheHits;
+    return true;
+  }
+  ++_cacheMisses;
+  _cacheValid = false;
+  _cacheQ2 = q2;
+  _cacheParticles = {{ part1, part2, part3, part4 }};
+  if ( _calckinematics ) _cacheKine = _kine;
+  return false;
 }
 
     
 void VertexBase::persistentOutput(PersistentOStream & os) const {
   os << _npoint << _inpart << _outpart 
      << _particles << _calckinematics
-     << _coupopt << _gs << _ee << _sw;
+     << _coupopt << _gs << _ee << _sw << _cacheCouplings;
 }
 
 void VertexBase::persistentInput(PersistentIStream & is, int) {
   is >> _npoint >> _inpart >> _outpart 
      >> _particles >> _calckinematics
-     >> _coupopt >> _gs >> _ee >> _sw;
+     >> _coupopt >> _gs >> _ee >> _sw >> _cacheCouplings;
+  clearCouplingCache();
 }
 
 // Static variable needed for the type description system in ThePEG.
@@ -169,6 +197,25 @@ void VertexBase::Init() {
      &VertexBase::_sw, sqrt(0.232), 0.0, 10.0,
      false, false, Interface::limited);
 
+  static Switch<VertexBase,bool> interfaceCacheCouplings
+    ("CacheCouplings",
+     "Reuse the couplings calculated in the previous call to setCoupling "
+     "if the scale, the particles and, if they are calculated, the "
+     "kinematic invariants are the same, as in a loop over helicities. "
+     "Should be switched off for vertices where the couplings depend on "
+     "anything else which may change during a run.",
+     &VertexBase::_cacheCouplings, true, false, false);
+  static SwitchOption interfaceCacheCouplingsYes
+    (interfaceCacheCouplings,
+     "Yes",
+     "Reuse the couplings",
+     true);
+  static SwitchOption interfaceCacheCouplingsNo
+    (interfaceCacheCouplings,
+     "No",
+     "Always calculate the couplings",
+     false);
+
 }
 
 // find particles with a given id    
@@ -16,6 +16,7 @@
 #include <ThePEG/Helicity/HelicityDefinitions.h>
 #include <ThePEG/Repository/EventGenerator.h>
 #include "ThePEG/StandardModel/StandardModelBase.h"
+#include "ThePEG/Utilities/CacheStatistics.h"
 #include "VertexBase.fh"
 #include <array>
 
@@ -47,8 +48,15 @@ namespace VertexType {
  *  included for future extensions. It can also be used at the development
  *  and debugging stage.
  *
+ *  The vertices call setCoupling() through updateCoupling(), which
+ *  reuses the couplings from the previous call if the scale, the
+ *  particles and, if they are calculated, the kinematic invariants
+ *  are the same, as in a loop over helicities. The number of reused
+ *  and calculated couplings is reported through the CacheStatistics
+ *  interface.
+ *
  */
-class VertexBase  : public Interfaced {
+class VertexBase  : public Interfaced, public CacheStatistics {
 /**
  *  The output operator is a friend to avoid the data being public.
  */
@@ -263,6 +271,96 @@ public:
 			   tcPDPtr part4)=0;
   //@}
 
+public:
+
+  /**
+   *  Access to the caching of the couplings
+   */
+  //@{
+  /**
+   * Whether or not the couplings may be reused by updateCoupling().
+   */
+  bool cacheCouplings() const { return _cacheCouplings; }
+
+  /**
+   * Set whether or not the couplings may be reused by updateCoupling().
+   */
+  void cacheCouplings(bool on) { _cacheCouplings = on; clearCouplingCache(); }
+
+  /**
+   * The number of calls to updateCoupling() where the couplings
+   * from the previous call to setCoupling() could be reused.
+   */
+  virtual unsigned long cacheHits() const { return _cacheHits; }
+
+  /**
+   * The number of calls to updateCoupling() where the couplings had
+   * to be calculated.
+   */
+  virtual unsigned long cacheMisses() const { return _cacheMisses; }
+
+  /**
+   * Force the couplings to be recalculated in the next call to
+   * updateCoupling(), eg. if parameters they depend on have changed.
+   */
+  void clearCouplingCache() { _cacheValid = false; }
+
+  /**
+   * Reset the hit and miss counters.
+   */
+  void resetCouplingCacheCounters() { _cacheHits = _cacheMisses = 0; }
+  //@}
+
+protected:
+
+  /**
+   * Calculate the couplings for a three point interaction with
+   * setCoupling(), unless the scale, the particles and, if
+   * kinematics() is true, the kinematic invariants are the same as in
+   * the previous call, in which case the couplings already set are
+   * reused. To be used instead of setCoupling() in the evaluate()
+   * functions, so that a loop over helicities only calculates the
+   * couplings once.
+   * @param q2 The scale \f$q^2\f$ for the coupling at the vertex.
+   * @param part1 The ParticleData pointer for the first  particle.
+   * @param part2 The ParticleData pointer for the second particle.
+   * @param part3 The ParticleData pointer for the third  particle.
+   */
+  void updateCoupling(Energy2 q2, tcPDPtr part1, tcPDPtr part2,
+		      tcPDPtr part3) {
+    if ( couplingCached(q2, part1, part2, part3, tcPDPtr()) ) return;
+    setCoupling(q2, part1, part2, part3);
+    _cacheValid = _cacheCouplings;
+  }
+
+  /**
+   * Calculate the couplings for a four point interaction with
+   * setCoupling(), unless they can be reused from the previous call
+   * as for the three point version above.
+   * @param q2 The scale \f$q^2\f$ for the coupling at the vertex.
+   * @param part1 The ParticleData pointer for the first  particle.
+   * @param part2 The ParticleData pointer for the second particle.
+   * @param part3 The ParticleData pointer for the third  particle.
+   * @param part4 The ParticleData pointer for the fourth particle.
+   */
+  void updateCoupling(Energy2 q2, tcPDPtr part1, tcPDPtr part2,
+		      tcPDPtr part3, tcPDPtr part4) {
+    if ( couplingCached(q2, part1, part2, part3, part4) ) return;
+    setCoupling(q2, part1, part2, part3, part4);
+    _cacheValid = _cacheCouplings;
+  }
+
+private:
+
+  /**
+   * Return true if the arguments, and the kinematic invariants if
+   * used, are the same as in the previous call to updateCoupling().
+   * Otherwise invalidate the cache, store the new arguments and
+   * return false.
+   */
+  bool couplingCached(Energy2 q2, tcPDPtr part1, tcPDPtr part2,
+		      tcPDPtr part3, tcPDPtr part4);
+
 protected:
 
   /** @name Standard Interfaced functions. */
@@ -274,6 +372,12 @@ protected:
    */
   virtual void doinit();
 
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins.
+   */
+  virtual void doinitrun();
+
   /**
    * Rebind pointer to other Interfaced objects. Called in the setup phase
    * after all objects used in an EventGenerator has been cloned so that
@@ -523,6 +627,46 @@ private:
    *  Fixed value of \f$\sin\theta_W\f$ to use
    */
   double _sw;
+
+  /**
+   * Cache of the arguments to the previous call to setCoupling()
+   */
+  //@{
+  /**
+   *  Whether or not the couplings may be reused
+   */
+  bool _cacheCouplings;
+
+  /**
+   *  The scale
+   */
+  Energy2 _cacheQ2;
+
+  /**
+   *  The particles
+   */
+  std::array<tcPDPtr,4> _cacheParticles;
+
+  /**
+   *  The kinematic invariants, if calculated
+   */
+  std::array<std::array<Energy2,5>,5> _cacheKine;
+
+  /**
+   *  Whether the stored couplings correspond to the stored arguments
+   */
+  bool _cacheValid;
+
+  /**
+   *  The number of times the couplings were reused
+   */
+  unsigned long _cacheHits;
+
+  /**
+   *  The number of times the couplings were calculated
+   */
+  unsigned long _cacheMisses;
+  //@}
 };
   
 /**
@@ -0,0 +1,153 @@
+// -*- C++ -*-
+//
+// helicityBenchVertexBatch.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 2003-2017 Peter Richardson, Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Compares the time needed to evaluate the FFV, VVV and VVS vertices for
+// all helicity combinations with evaluate() and with evaluateAll(). The
+// couplings are set by a setCoupling() which, like a running coupling,
+// calls log() and sqrt(). Usage: helicity_bench_vertex_batch [npoints]
+//
+
+#include "ThePEG/Helicity/Vertex/Vector/FFVVertex.h"
+#include "ThePEG/Helicity/Vertex/Vector/VVVVertex.h"
+#include "ThePEG/Helicity/Vertex/Scalar/VVSVertex.h"
+#include "ThePEG/PDT/EnumParticles.h"
+#include <chrono>
+#include <cstdlib>
+
+using namespace ThePEG;
+using namespace ThePEG::Helicity;
+
+namespace {
+
+double runningCoupling(Energy2 q2) {
+  return sqrt(4.0*Constants::pi*12.0*Constants::pi/(23.0*log(q2/(0.04*GeV2))));
+}
+
+struct BenchFFVVertex: public FFVVertex {
+  virtual void setCoupling(Energy2 q2, tcPDPtr, tcPDPtr, tcPDPtr) {
+    left(1.0);
+    right(1.0);
+    norm(-runningCoupling(q2));
+  }
+  virtual IBPtr clone() const { return new_ptr(*this); }
+  virtual IBPtr fullclone() const { return new_ptr(*this); }
+};
+
+struct BenchVVVVertex: public VVVVertex {
+  virtual void setCoupling(Energy2 q2, tcPDPtr, tcPDPtr, tcPDPtr) {
+    norm(runningCoupling(q2));
+  }
+  virtual IBPtr clone() const { return new_ptr(*this); }
+  virtual IBPtr fullclone() const { return new_ptr(*this); }
+};
+
+struct BenchVVSVertex: public VVSVertex {
+  virtual void setCoupling(Energy2 q2, tcPDPtr, tcPDPtr, tcPDPtr) {
+    norm(runningCoupling(q2)*double(80.0*GeV/(246.0*GeV)));
+  }
+  virtual IBPtr clone() const { return new_ptr(*this); }
+  virtual IBPtr fullclone() const { return new_ptr(*this); }
+};
+
+typedef std::chrono::steady_clock Clock;
+
+double nsPer(Clock::time_point start, long n) {
+  return std::chrono::duration<double,std::nano>(Clock::now() - start).count()/n;
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  long npoints = argc > 1 ? std::atol(argv[1]) : 200000;
+
+  PDPtr quark = ParticleData::Create(ParticleID::u, "u");
+  quark->iSpin(PDT::Spin1Half);
+  PDPtr gluon = ParticleData::Create(ParticleID::g, "g");
+  gluon->iSpin(PDT::Spin1);
+  PDPtr higgs = ParticleData::Create(ParticleID::h0, "h0");
+  higgs->iSpin(PDT::Spin0);
+
+  // On-shell external states with all their helicities.
+  Lorentz5Momentum p1(ZERO, ZERO, 50.0*GeV, 50.0*GeV, ZERO);
+  Lorentz5Momentum p2(ZERO, ZERO, -50.0*GeV, 50.0*GeV, ZERO);
+  Lorentz5Momentum p3(30.0*GeV, 20.0*GeV, 10.0*GeV, ZERO, ZERO);
+  p3.rescaleEnergy();
+  Lorentz5Momentum p4 = p1 + p2 - p3;
+  p4.rescaleMass();
+  vector<SpinorWaveFunction> sp;
+  vector<SpinorBarWaveFunction> sbar;
+  vector<VectorWaveFunction> g1, g2, g3;
+  for ( unsigned int h = 0; h < 2; ++h ) {
+    sp.push_back(SpinorWaveFunction(p1, quark, h, incoming));
+    sbar.push_back(SpinorBarWaveFunction(p2, quark, h, incoming));
+  }
+  for ( unsigned int h = 0; h < 3; h += 2 ) {
+    g1.push_back(VectorWaveFunction(p1, gluon, h, incoming));
+    g2.push_back(VectorWaveFunction(p2, gluon, h, incoming));
+  }
+  for ( unsigned int h = 0; h < 3; ++h )
+    g3.push_back(VectorWaveFunction(p4, gluon, h, outgoing));
+  vector<ScalarWaveFunction> h0(1, ScalarWaveFunction(p3, higgs, outgoing));
+
+  BenchFFVVertex ffv;
+  BenchVVVVertex vvv;
+  BenchVVSVertex vvs;
+  Energy2 q2 = 1000.0*GeV2;
+  vector<Complex> amp;
+  Complex sum;
+
+  cout << "Time per amplitude (ns), " << npoints << " points:" << endl
+       << "vertex  evaluate()  evaluateAll()" << endl;
+
+  Clock::time_point start = Clock::now();
+  for ( long n = 0; n < npoints; ++n )
+    for ( unsigned int i = 0; i < sp.size(); ++i )
+      for ( unsigned int j = 0; j < sbar.size(); ++j )
+	for ( unsigned int k = 0; k < g3.size(); ++k )
+	  sum += ffv.evaluate(q2, sp[i], sbar[j], g3[k]);
+  long namp = npoints*sp.size()*sbar.size()*g3.size();
+  double t1 = nsPer(start, namp);
+  start = Clock::now();
+  for ( long n = 0; n < npoints; ++n ) {
+    ffv.evaluateAll(q2, sp, sbar, g3, amp);
+    sum += amp[1];
+  }
+  cout << "FFV     " << t1 << "  " << nsPer(start, namp) << endl;
+
+  start = Clock::now();
+  for ( long n = 0; n < npoints; ++n )
+    for ( unsigned int i = 0; i < g1.size(); ++i )
+      for ( unsigned int j = 0; j < g2.size(); ++j )
+	for ( unsigned int k = 0; k < g3.size(); ++k )
+	  sum += vvv.evaluate(q2, g1[i], g2[j], g3[k]);
+  namp = npoints*g1.size()*g2.size()*g3.size();
+  t1 = nsPer(start, namp);
+  start = Clock::now();
+  for ( long n = 0; n < npoints; ++n ) {
+    vvv.evaluateAll(q2, g1, g2, g3, amp);
+    sum += amp[1];
+  }
+  cout << "VVV     " << t1 << "  " << nsPer(start, namp) << endl;
+
+  start = Clock::now();
+  for ( long n = 0; n < npoints; ++n )
+    for ( unsigned int i = 0; i < g1.size(); ++i )
+      for ( unsigned int j = 0; j < g2.size(); ++j )
+	sum += vvs.evaluate(q2, g1[i], g2[j], h0[0]);
+  namp = npoints*g1.size()*g2.size();
+  t1 = nsPer(start, namp);
+  start = Clock::now();
+  for ( long n = 0; n < npoints; ++n ) {
+    vvs.evaluateAll(q2, g1, g2, h0, amp);
+    sum += amp[1];
+  }
+  cout << "VVS     " << t1 << "  " << nsPer(start, namp) << endl;
+
+  cerr << "(checksum " << sum << ")" << endl;
+  return 0;
+}
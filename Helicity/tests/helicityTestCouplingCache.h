@@ -0,0 +1,145 @@
+// -*- C++ -*-
+//
+// helicityTestCouplingCache.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 2003-2017 Peter Richardson, Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_Helicity_Test_CouplingCache_H
+#define ThePEG_Helicity_Test_CouplingCache_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/Helicity/Vertex/Vector/FFVVertex.h"
+#include "ThePEG/PDT/EnumParticles.h"
+
+using namespace ThePEG;
+using namespace ThePEG::Helicity;
+
+/*
+ * A vertex where the coupling depends on the scale and, if the
+ * kinematic invariants are calculated, on the vector boson
+ * virtuality, and which counts the calls to setCoupling().
+ */
+struct CountingFFVVertex: public FFVVertex {
+  CountingFFVVertex() : calls(0) { orderInGem(1); }
+  virtual void setCoupling(Energy2 q2, tcPDPtr, tcPDPtr, tcPDPtr) {
+    ++calls;
+    left(1.0);
+    right(1.0);
+    Energy2 m2 = kinematics() ? invariant(2, 2) : ZERO;
+    norm(Complex((q2 + m2)/GeV2));
+  }
+  virtual IBPtr clone() const { return new_ptr(*this); }
+  virtual IBPtr fullclone() const { return new_ptr(*this); }
+  int calls;
+};
+
+/*
+ * Fixture with particle data objects and wavefunctions.
+ */
+struct FixCouplingCache {
+  FixCouplingCache()
+    : quark(ParticleData::Create(ParticleID::u, "u")),
+      photon(ParticleData::Create(ParticleID::gamma, "gamma")),
+      gluon(ParticleData::Create(ParticleID::g, "g")),
+      p1(1.0*GeV, 2.0*GeV, 3.0*GeV, 10.0*GeV),
+      p2(-2.0*GeV, 1.0*GeV, 5.0*GeV, 12.0*GeV) {
+    quark->iSpin(PDT::Spin1Half);
+    photon->iSpin(PDT::Spin1);
+    gluon->iSpin(PDT::Spin1);
+    sp = SpinorWaveFunction(p1, quark, Complex(0.1, 0.2), Complex(0.3, -0.1),
+			    Complex(-0.2, 0.4), Complex(0.5, 0.1));
+    sbar = SpinorBarWaveFunction(p2, quark, Complex(0.2, -0.3),
+				 Complex(0.1, 0.1), Complex(0.4, 0.2),
+				 Complex(-0.3, 0.2));
+    vec = VectorWaveFunction(p1 - p2, photon, Complex(0.3, 0.1),
+			     Complex(-0.2, 0.2), Complex(0.1, -0.4),
+			     Complex(0.2, 0.3));
+  }
+
+  PDPtr quark;
+  PDPtr photon;
+  PDPtr gluon;
+  Lorentz5Momentum p1;
+  Lorentz5Momentum p2;
+  SpinorWaveFunction sp;
+  SpinorBarWaveFunction sbar;
+  VectorWaveFunction vec;
+};
+
+/*
+ * Start of boost unit tests for the reuse of couplings in VertexBase.
+ */
+BOOST_FIXTURE_TEST_SUITE(helicityCouplingCache, FixCouplingCache)
+
+BOOST_AUTO_TEST_CASE(reuseSameArguments)
+{
+  CountingFFVVertex vertex;
+  Energy2 q2 = 100.0*GeV2;
+  Complex a1 = vertex.evaluate(q2, sp, sbar, vec);
+  Complex a2 = vertex.evaluate(q2, sp, sbar, vec);
+  BOOST_CHECK_EQUAL(vertex.calls, 1);
+  BOOST_CHECK_EQUAL(vertex.cacheHits(), 1u);
+  BOOST_CHECK_EQUAL(vertex.cacheMisses(), 1u);
+  BOOST_CHECK_EQUAL(a1.real(), a2.real());
+  BOOST_CHECK_EQUAL(a1.imag(), a2.imag());
+
+  vector<Complex> amp;
+  vertex.evaluateAll(q2, vector<SpinorWaveFunction>(2, sp),
+		     vector<SpinorBarWaveFunction>(2, sbar),
+		     vector<VectorWaveFunction>(3, vec), amp);
+  BOOST_CHECK_EQUAL(vertex.calls, 1);
+  BOOST_CHECK_EQUAL(vertex.cacheHits(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(recalculateChangedArguments)
+{
+  CountingFFVVertex vertex;
+  Energy2 q2 = 100.0*GeV2;
+  Complex a1 = vertex.evaluate(q2, sp, sbar, vec);
+  Complex a2 = vertex.evaluate(2.0*q2, sp, sbar, vec);
+  BOOST_CHECK_EQUAL(vertex.calls, 2);
+  BOOST_CHECK_CLOSE(a2.real(), 2.0*a1.real(), 1e-10);
+
+  VectorWaveFunction glu(vec.momentum(), gluon, vec.wave());
+  vertex.evaluate(2.0*q2, sp, sbar, glu);
+  BOOST_CHECK_EQUAL(vertex.calls, 3);
+
+  vertex.clearCouplingCache();
+  vertex.evaluate(2.0*q2, sp, sbar, glu);
+  BOOST_CHECK_EQUAL(vertex.calls, 4);
+  BOOST_CHECK_EQUAL(vertex.cacheHits(), 0u);
+  BOOST_CHECK_EQUAL(vertex.cacheMisses(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(recalculateChangedKinematics)
+{
+  CountingFFVVertex vertex;
+  vertex.kinematics(true);
+  Energy2 q2 = 100.0*GeV2;
+  Complex a1 = vertex.evaluate(q2, sp, sbar, vec);
+  vertex.evaluate(q2, sp, sbar, vec);
+  BOOST_CHECK_EQUAL(vertex.calls, 1);
+
+  VectorWaveFunction moved(p1 + p2, photon, vec.wave());
+  Complex a2 = vertex.evaluate(q2, sp, sbar, moved);
+  BOOST_CHECK_EQUAL(vertex.calls, 2);
+  BOOST_CHECK(a1 != a2);
+}
+
+BOOST_AUTO_TEST_CASE(cachingSwitchedOff)
+{
+  CountingFFVVertex vertex;
+  vertex.cacheCouplings(false);
+  Energy2 q2 = 100.0*GeV2;
+  vertex.evaluate(q2, sp, sbar, vec);
+  vertex.evaluate(q2, sp, sbar, vec);
+  BOOST_CHECK_EQUAL(vertex.calls, 2);
+  BOOST_CHECK_EQUAL(vertex.cacheHits(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* ThePEG_Helicity_Test_CouplingCache_H */
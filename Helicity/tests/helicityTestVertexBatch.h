@@ -0,0 +1,215 @@
+// -*- C++ -*-
+//
+// helicityTestVertexBatch.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 2003-2017 Peter Richardson, Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_Helicity_Test_VertexBatch_H
+#define ThePEG_Helicity_Test_VertexBatch_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/Helicity/Vertex/Vector/FFVVertex.h"
+#include "ThePEG/Helicity/Vertex/Vector/VVVVertex.h"
+#include "ThePEG/Helicity/Vertex/Scalar/VVSVertex.h"
+#include "ThePEG/PDT/EnumParticles.h"
+
+using namespace ThePEG;
+using namespace ThePEG::Helicity;
+
+/*
+ * Vertices with fixed, complex couplings, which are all that is
+ * needed to compare evaluateAll() with evaluate().
+ */
+struct FixedFFVVertex: public FFVVertex {
+  FixedFFVVertex() { orderInGem(1); }
+  virtual void setCoupling(Energy2, tcPDPtr, tcPDPtr, tcPDPtr) {
+    left(Complex(0.3, 0.1));
+    right(Complex(-0.7, 0.4));
+    norm(Complex(0.31, -0.05));
+  }
+  virtual IBPtr clone() const { return new_ptr(*this); }
+  virtual IBPtr fullclone() const { return new_ptr(*this); }
+};
+
+struct FixedVVVVertex: public VVVVertex {
+  FixedVVVVertex() { orderInGs(1); }
+  virtual void setCoupling(Energy2, tcPDPtr, tcPDPtr, tcPDPtr) {
+    norm(Complex(1.2, 0.3));
+  }
+  virtual IBPtr clone() const { return new_ptr(*this); }
+  virtual IBPtr fullclone() const { return new_ptr(*this); }
+};
+
+struct FixedVVSVertex: public VVSVertex {
+  FixedVVSVertex() { orderInGem(1); }
+  virtual void setCoupling(Energy2, tcPDPtr, tcPDPtr, tcPDPtr) {
+    norm(Complex(0.6, -0.2));
+  }
+  virtual IBPtr clone() const { return new_ptr(*this); }
+  virtual IBPtr fullclone() const { return new_ptr(*this); }
+};
+
+/*
+ * Fixture with particle data objects and a simple source of complex
+ * numbers for the wavefunction components.
+ */
+struct FixVertexBatch {
+  FixVertexBatch()
+    : quark(ParticleData::Create(ParticleID::u, "u")),
+      boson(ParticleData::Create(ParticleID::g, "g")),
+      scalar(ParticleData::Create(ParticleID::h0, "h0")),
+      seed(12345) {
+    quark->iSpin(PDT::Spin1Half);
+    boson->iSpin(PDT::Spin1);
+    scalar->iSpin(PDT::Spin0);
+  }
+
+  Complex next() {
+    seed = (seed*1103515245 + 12345) % 2147483648ll;
+    double re = double(seed)/2147483648.0 - 0.5;
+    seed = (seed*1103515245 + 12345) % 2147483648ll;
+    double im = double(seed)/2147483648.0 - 0.5;
+    return Complex(re, im);
+  }
+
+  vector<SpinorWaveFunction> spinors(const Lorentz5Momentum & p, int n) {
+    vector<SpinorWaveFunction> ret;
+    for ( int i = 0; i < n; ++i )
+      ret.push_back(SpinorWaveFunction(p, quark, next(), next(), next(), next()));
+    return ret;
+  }
+
+  vector<SpinorBarWaveFunction> spinorBars(const Lorentz5Momentum & p, int n) {
+    vector<SpinorBarWaveFunction> ret;
+    for ( int i = 0; i < n; ++i )
+      ret.push_back(SpinorBarWaveFunction(p, quark, next(), next(), next(), next()));
+    return ret;
+  }
+
+  /*
+   * Every other vector has a dominating time component, so that both
+   * branches of the gauge treatment in VVVVertex are tested.
+   */
+  vector<VectorWaveFunction> vectors(const Lorentz5Momentum & p, int n) {
+    vector<VectorWaveFunction> ret;
+    for ( int i = 0; i < n; ++i ) {
+      Complex t = next();
+      if ( i%2 ) t *= 100.0;
+      ret.push_back(VectorWaveFunction(p, boson, next(), next(), next(), t));
+    }
+    return ret;
+  }
+
+  vector<ScalarWaveFunction> scalars(const Lorentz5Momentum & p, int n) {
+    vector<ScalarWaveFunction> ret;
+    for ( int i = 0; i < n; ++i )
+      ret.push_back(ScalarWaveFunction(p, scalar, next()));
+    return ret;
+  }
+
+  PDPtr quark;
+  PDPtr boson;
+  PDPtr scalar;
+  long long seed;
+};
+
+/*
+ * Check that the amplitudes are identical, bit for bit.
+ */
+#define CHECK_SAME_AMPLITUDE(a, b) \
+  BOOST_CHECK_EQUAL((a).real(), (b).real()); \
+  BOOST_CHECK_EQUAL((a).imag(), (b).imag())
+
+/*
+ * Start of boost unit tests for the evaluateAll() functions of the
+ * vertices, which must give the same results as evaluate().
+ */
+BOOST_FIXTURE_TEST_SUITE(helicityVertexBatch, FixVertexBatch)
+
+BOOST_AUTO_TEST_CASE(batchFFV)
+{
+  Energy2 q2 = 100.0*GeV2;
+  Lorentz5Momentum p1(1.0*GeV, 2.0*GeV, 3.0*GeV, 10.0*GeV);
+  Lorentz5Momentum p2(-2.0*GeV, 1.0*GeV, 5.0*GeV, 12.0*GeV);
+  Lorentz5Momentum p3 = p1 - p2;
+  vector<SpinorWaveFunction> sp = spinors(p1, 2);
+  vector<SpinorBarWaveFunction> sbar = spinorBars(p2, 2);
+  vector<VectorWaveFunction> vec = vectors(p3, 3);
+  FixedFFVVertex vertex;
+  vector<Complex> amp;
+  vertex.evaluateAll(q2, sp, sbar, vec, amp);
+  BOOST_REQUIRE_EQUAL(amp.size(), 12u);
+  for ( unsigned int i = 0; i < sp.size(); ++i )
+    for ( unsigned int j = 0; j < sbar.size(); ++j )
+      for ( unsigned int k = 0; k < vec.size(); ++k ) {
+	Complex a = vertex.evaluate(q2, sp[i], sbar[j], vec[k]);
+	CHECK_SAME_AMPLITUDE(amp[(i*sbar.size() + j)*vec.size() + k], a);
+      }
+  // The default version in the base class must also agree.
+  vector<Complex> base;
+  vertex.AbstractFFVVertex::evaluateAll(q2, sp, sbar, vec, base);
+  BOOST_REQUIRE_EQUAL(base.size(), amp.size());
+  for ( unsigned int i = 0; i < amp.size(); ++i ) {
+    CHECK_SAME_AMPLITUDE(base[i], amp[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(batchVVV)
+{
+  Energy2 q2 = 100.0*GeV2;
+  Lorentz5Momentum p1(1.0*GeV, 2.0*GeV, 3.0*GeV, 10.0*GeV);
+  Lorentz5Momentum p2(-2.0*GeV, 1.0*GeV, 5.0*GeV, 12.0*GeV);
+  Lorentz5Momentum p3 = -p1 - p2;
+  vector<VectorWaveFunction> vec1 = vectors(p1, 3);
+  vector<VectorWaveFunction> vec2 = vectors(p2, 2);
+  vector<VectorWaveFunction> vec3 = vectors(p3, 3);
+  FixedVVVVertex vertex;
+  vector<Complex> amp;
+  vertex.evaluateAll(q2, vec1, vec2, vec3, amp);
+  BOOST_REQUIRE_EQUAL(amp.size(), 18u);
+  for ( unsigned int i = 0; i < vec1.size(); ++i )
+    for ( unsigned int j = 0; j < vec2.size(); ++j )
+      for ( unsigned int k = 0; k < vec3.size(); ++k ) {
+	Complex a = vertex.evaluate(q2, vec1[i], vec2[j], vec3[k]);
+	CHECK_SAME_AMPLITUDE(amp[(i*vec2.size() + j)*vec3.size() + k], a);
+      }
+}
+
+BOOST_AUTO_TEST_CASE(batchVVS)
+{
+  Energy2 q2 = 100.0*GeV2;
+  Lorentz5Momentum p1(1.0*GeV, 2.0*GeV, 3.0*GeV, 10.0*GeV);
+  Lorentz5Momentum p2(-2.0*GeV, 1.0*GeV, 5.0*GeV, 12.0*GeV);
+  Lorentz5Momentum p3 = -p1 - p2;
+  vector<VectorWaveFunction> vec1 = vectors(p1, 3);
+  vector<VectorWaveFunction> vec2 = vectors(p2, 3);
+  vector<ScalarWaveFunction> sca = scalars(p3, 2);
+  FixedVVSVertex vertex;
+  vector<Complex> amp;
+  vertex.evaluateAll(q2, vec1, vec2, sca, amp);
+  BOOST_REQUIRE_EQUAL(amp.size(), 18u);
+  for ( unsigned int i = 0; i < vec1.size(); ++i )
+    for ( unsigned int j = 0; j < vec2.size(); ++j )
+      for ( unsigned int k = 0; k < sca.size(); ++k ) {
+	Complex a = vertex.evaluate(q2, vec1[i], vec2[j], sca[k]);
+	CHECK_SAME_AMPLITUDE(amp[(i*vec2.size() + j)*sca.size() + k], a);
+      }
+}
+
+BOOST_AUTO_TEST_CASE(batchEmpty)
+{
+  Energy2 q2 = 100.0*GeV2;
+  Lorentz5Momentum p(1.0*GeV, 2.0*GeV, 3.0*GeV, 10.0*GeV);
+  FixedFFVVertex vertex;
+  vector<Complex> amp(5);
+  vertex.evaluateAll(q2, spinors(p, 2), vector<SpinorBarWaveFunction>(),
+		     vectors(p, 3), amp);
+  BOOST_CHECK(amp.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
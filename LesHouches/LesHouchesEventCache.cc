@@ -0,0 +1,369 @@
+// -*- C++ -*-
+//
+// LesHouchesEventCache.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+//
+// This is the implementation of the non-inlined, non-templated member
+// functions of the LesHouchesEventCache class.
+//
+
+#include "LesHouchesEventCache.h"
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace ThePEG;
+
+namespace {
+
+/** The tag at the beginning and end of a cache file. */
+const char cacheMagic[8] = { 'T', 'h', 'e', 'P', 'E', 'G', 'L', 'H' };
+
+/** The version of the cache file format. */
+const std::uint32_t cacheVersion = 1;
+
+/** The size of the file header: the tag, the version and a byte-order mark. */
+const std::size_t cacheHeaderSize = 16;
+
+/** The size of the trailer: number of events, offsets of index and
+    names and the tag. */
+const std::size_t cacheTrailerSize = 32;
+
+/** Round up to a multiple of eight bytes. */
+inline std::uint64_t align8(std::uint64_t n) { return (n + 7) & ~std::uint64_t(7); }
+
+/** The size of an event with \a N particles and \a W optional weights. */
+inline std::uint64_t eventSize(std::uint64_t N, std::uint64_t W) {
+  return align8(sizeof(LesHouchesEventCache::Header)) + 8*N + align8(4*N)
+    + 8*N + 8*N + 5*8*N + 8*N + 8*N + align8(4*W) + 8*W;
+}
+
+}
+
+LesHouchesEventCache::LesHouchesEventCache()
+  : theWFile(0), theWPos(0), writeFailed(false), theData(0), theSize(0),
+    isMapped(false), theNext(0) {}
+
+LesHouchesEventCache::~LesHouchesEventCache() {
+  close();
+}
+
+bool LesHouchesEventCache::openWrite(string file) {
+  close();
+  theWFile = std::fopen(file.c_str(), "wb");
+  if ( !theWFile ) return false;
+  theWPos = 0;
+  std::uint32_t head[2] = { cacheVersion, 0x01020304 };
+  put(cacheMagic, sizeof(cacheMagic));
+  put(head, sizeof(head));
+  if ( writeFailed ) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void LesHouchesEventCache::put(const void * p, std::size_t n) {
+  static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  if ( writeFailed ) return;
+  std::size_t pad = align8(n) - n;
+  if ( ( n && std::fwrite(p, 1, n, theWFile) != n ) ||
+       ( pad && std::fwrite(zeros, 1, pad, theWFile) != pad ) )
+    writeFailed = true;
+  theWPos += n + pad;
+}
+
+bool LesHouchesEventCache::
+write(const HEPEUP & hepeup, double lastweight, double preweight,
+      const map<string,double> & weights, int npLO, int npNLO) {
+  if ( !theWFile || writeFailed ) return false;
+  theOffsets.push_back(theWPos);
+  std::size_t N = hepeup.NUP;
+
+  Header h;
+  h.NUP = hepeup.NUP;
+  h.IDPRUP = hepeup.IDPRUP;
+  h.nWeights = weights.size();
+  h.npLO = npLO;
+  h.npNLO = npNLO;
+  h.unused = 0;
+  h.XWGTUP = hepeup.XWGTUP;
+  h.XPDWUP[0] = hepeup.XPDWUP.first;
+  h.XPDWUP[1] = hepeup.XPDWUP.second;
+  h.SCALUP = hepeup.SCALUP;
+  h.AQEDUP = hepeup.AQEDUP;
+  h.AQCDUP = hepeup.AQCDUP;
+  h.lastweight = lastweight;
+  h.preweight = preweight;
+  put(&h, sizeof(h));
+
+  // The particle columns. The buffer is large enough for the widest.
+  theBuffer.resize(5*N*sizeof(double) + 8);
+  std::int64_t * i64 = reinterpret_cast<std::int64_t*>(&theBuffer[0]);
+  std::int32_t * i32 = reinterpret_cast<std::int32_t*>(&theBuffer[0]);
+  double * d = reinterpret_cast<double*>(&theBuffer[0]);
+  for ( std::size_t i = 0; i < N; ++i ) i64[i] = hepeup.IDUP[i];
+  put(i64, N*sizeof(std::int64_t));
+  for ( std::size_t i = 0; i < N; ++i ) i32[i] = hepeup.ISTUP[i];
+  put(i32, N*sizeof(std::int32_t));
+  for ( std::size_t i = 0; i < N; ++i ) {
+    i32[2*i] = hepeup.MOTHUP[i].first;
+    i32[2*i + 1] = hepeup.MOTHUP[i].second;
+  }
+  put(i32, 2*N*sizeof(std::int32_t));
+  for ( std::size_t i = 0; i < N; ++i ) {
+    i32[2*i] = hepeup.ICOLUP[i].first;
+    i32[2*i + 1] = hepeup.ICOLUP[i].second;
+  }
+  put(i32, 2*N*sizeof(std::int32_t));
+  for ( std::size_t i = 0; i < N; ++i )
+    for ( int j = 0; j < 5; ++j ) d[5*i + j] = hepeup.PUP[i][j];
+  put(d, 5*N*sizeof(double));
+  put(hepeup.VTIMUP.data(), N*sizeof(double));
+  put(hepeup.SPINUP.data(), N*sizeof(double));
+
+  // The optional weights, with the names replaced by indices.
+  std::size_t W = weights.size();
+  theBuffer.resize(W*sizeof(double) + 8);
+  i32 = reinterpret_cast<std::int32_t*>(&theBuffer[0]);
+  std::size_t iw = 0;
+  for ( map<string,double>::const_iterator it = weights.begin();
+	it != weights.end(); ++it, ++iw ) {
+    map<string,int>::iterator in = theNameIndex.find(it->first);
+    if ( in == theNameIndex.end() ) {
+      in = theNameIndex.insert(make_pair(it->first, int(theNames.size()))).first;
+      theNames.push_back(it->first);
+    }
+    i32[iw] = in->second;
+  }
+  put(i32, W*sizeof(std::int32_t));
+  d = reinterpret_cast<double*>(&theBuffer[0]);
+  iw = 0;
+  for ( map<string,double>::const_iterator it = weights.begin();
+	it != weights.end(); ++it, ++iw ) d[iw] = it->second;
+  put(d, W*sizeof(double));
+  return !writeFailed;
+}
+
+bool LesHouchesEventCache::openRead(string file) {
+  close();
+  int fd = ::open(file.c_str(), O_RDONLY);
+  if ( fd < 0 ) return false;
+  struct stat st;
+  if ( ::fstat(fd, &st) != 0 ||
+       std::size_t(st.st_size) < cacheHeaderSize + cacheTrailerSize ) {
+    ::close(fd);
+    return false;
+  }
+  theSize = st.st_size;
+  void * m = ::mmap(0, theSize, PROT_READ, MAP_SHARED, fd, 0);
+  if ( m != MAP_FAILED ) {
+    theData = static_cast<const char *>(m);
+    isMapped = true;
+  } else {
+    char * buff = new char[theSize];
+    std::size_t n = 0;
+    while ( n < theSize ) {
+      ssize_t r = ::read(fd, buff + n, theSize - n);
+      if ( r <= 0 ) break;
+      n += r;
+    }
+    theData = buff;
+    isMapped = false;
+    if ( n < theSize ) {
+      ::close(fd);
+      close();
+      return false;
+    }
+  }
+  ::close(fd);
+
+  // Check the header and the trailer.
+  std::uint32_t head[2];
+  std::memcpy(head, theData + sizeof(cacheMagic), sizeof(head));
+  std::uint64_t trailer = theSize - cacheTrailerSize;
+  std::uint64_t tail[3];
+  std::memcpy(tail, theData + trailer, sizeof(tail));
+  std::uint64_t nevents = tail[0], indexOffset = tail[1], namesOffset = tail[2];
+  if ( theSize%8 ||
+       std::memcmp(theData, cacheMagic, sizeof(cacheMagic)) != 0 ||
+       std::memcmp(theData + theSize - sizeof(cacheMagic), cacheMagic,
+		   sizeof(cacheMagic)) != 0 ||
+       head[0] != cacheVersion || head[1] != 0x01020304 ||
+       namesOffset < cacheHeaderSize || namesOffset%8 ||
+       indexOffset < namesOffset || indexOffset%8 || indexOffset > trailer ||
+       ( trailer - indexOffset )/sizeof(std::uint64_t) != nevents ) {
+    close();
+    return false;
+  }
+
+  // Read the names, which must fill the space up to the index.
+  const char * pos = theData + namesOffset;
+  std::uint64_t left = indexOffset - namesOffset;
+  std::uint64_t nnames = 0;
+  bool ok = left >= sizeof(nnames);
+  if ( ok ) {
+    std::memcpy(&nnames, pos, sizeof(nnames));
+    pos += sizeof(nnames);
+    left -= sizeof(nnames);
+  }
+  for ( std::uint64_t i = 0; ok && i < nnames; ++i ) {
+    std::uint64_t len = 0;
+    ok = left >= sizeof(len);
+    if ( !ok ) break;
+    std::memcpy(&len, pos, sizeof(len));
+    pos += sizeof(len);
+    left -= sizeof(len);
+    ok = len <= left && align8(len) <= left;
+    if ( !ok ) break;
+    theNames.push_back(string(pos, len));
+    pos += align8(len);
+    left -= align8(len);
+  }
+
+  // Read the index and check the events.
+  if ( ok && left == 0 ) {
+    const std::uint64_t * index =
+      reinterpret_cast<const std::uint64_t *>(theData + indexOffset);
+    theOffsets.assign(index, index + nevents);
+    ok = checkEvents(namesOffset);
+  } else
+    ok = false;
+  if ( !ok ) {
+    close();
+    return false;
+  }
+  theNext = 0;
+  return true;
+}
+
+bool LesHouchesEventCache::checkEvents(std::uint64_t end) const {
+  std::uint64_t begin = cacheHeaderSize;
+  for ( std::size_t i = 0; i < theOffsets.size(); ++i ) {
+    std::uint64_t offset = theOffsets[i];
+    if ( offset < begin || offset%8 || offset > end ||
+	 end - offset < sizeof(Header) ) return false;
+    Header h;
+    std::memcpy(&h, theData + offset, sizeof(h));
+    if ( h.NUP < 0 || h.nWeights < 0 ) return false;
+    std::uint64_t n = eventSize(h.NUP, h.nWeights);
+    if ( n > end - offset ) return false;
+    EventView v = event(i);
+    for ( int j = 0; j < h.nWeights; ++j )
+      if ( v.weightIndex[j] < 0 ||
+	   std::size_t(v.weightIndex[j]) >= theNames.size() ) return false;
+    begin = offset + n;
+  }
+  return true;
+}
+
+bool LesHouchesEventCache::close() {
+  bool ok = true;
+  if ( theWFile ) {
+    // Write the names of the weights, the index and the trailer. If
+    // writing has failed, they are left out, so that the file will
+    // not be accepted by openRead().
+    if ( !writeFailed ) writeTrailer();
+    if ( std::fclose(theWFile) != 0 ) writeFailed = true;
+    ok = !writeFailed;
+    theWFile = 0;
+  }
+  if ( theData ) {
+    if ( isMapped ) ::munmap(const_cast<char *>(theData), theSize);
+    else delete [] theData;
+    theData = 0;
+  }
+  theSize = 0;
+  isMapped = false;
+  writeFailed = false;
+  theOffsets.clear();
+  theNames.clear();
+  theNameIndex.clear();
+  theNext = 0;
+  return ok;
+}
+
+void LesHouchesEventCache::writeTrailer() {
+  std::uint64_t namesOffset = theWPos;
+  std::uint64_t nnames = theNames.size();
+  put(&nnames, sizeof(nnames));
+  for ( std::size_t i = 0; i < theNames.size(); ++i ) {
+    std::uint64_t len = theNames[i].size();
+    put(&len, sizeof(len));
+    put(theNames[i].data(), len);
+  }
+  std::uint64_t indexOffset = theWPos;
+  if ( !theOffsets.empty() )
+    put(&theOffsets[0], theOffsets.size()*sizeof(std::uint64_t));
+  std::uint64_t tail[3] = { theOffsets.size(), indexOffset, namesOffset };
+  put(tail, sizeof(tail));
+  put(cacheMagic, sizeof(cacheMagic));
+  if ( std::fflush(theWFile) != 0 ) writeFailed = true;
+}
+
+LesHouchesEventCache::EventView
+LesHouchesEventCache::event(std::size_t i) const {
+  EventView v;
+  const char * pos = theData + theOffsets[i];
+  v.header = reinterpret_cast<const Header *>(pos);
+  std::size_t N = v.header->NUP;
+  std::size_t W = v.header->nWeights;
+  pos += align8(sizeof(Header));
+  v.IDUP = reinterpret_cast<const std::int64_t *>(pos);
+  pos += align8(N*sizeof(std::int64_t));
+  v.ISTUP = reinterpret_cast<const std::int32_t *>(pos);
+  pos += align8(N*sizeof(std::int32_t));
+  v.MOTHUP = reinterpret_cast<const std::int32_t *>(pos);
+  pos += align8(2*N*sizeof(std::int32_t));
+  v.ICOLUP = reinterpret_cast<const std::int32_t *>(pos);
+  pos += align8(2*N*sizeof(std::int32_t));
+  v.PUP = reinterpret_cast<const double *>(pos);
+  pos += 5*N*sizeof(double);
+  v.VTIMUP = reinterpret_cast<const double *>(pos);
+  pos += N*sizeof(double);
+  v.SPINUP = reinterpret_cast<const double *>(pos);
+  pos += N*sizeof(double);
+  v.weightIndex = reinterpret_cast<const std::int32_t *>(pos);
+  pos += align8(W*sizeof(std::int32_t));
+  v.weights = reinterpret_cast<const double *>(pos);
+  return v;
+}
+
+bool LesHouchesEventCache::
+read(std::size_t i, HEPEUP & hepeup, double & lastweight, double & preweight,
+     map<string,double> & weights, int & npLO, int & npNLO) const {
+  if ( !theData || i >= size() ) return false;
+  EventView v = event(i);
+  const Header & h = *v.header;
+  hepeup.NUP = h.NUP;
+  hepeup.IDPRUP = h.IDPRUP;
+  hepeup.XWGTUP = h.XWGTUP;
+  hepeup.XPDWUP = make_pair(h.XPDWUP[0], h.XPDWUP[1]);
+  hepeup.SCALUP = h.SCALUP;
+  hepeup.AQEDUP = h.AQEDUP;
+  hepeup.AQCDUP = h.AQCDUP;
+  hepeup.resize();
+  for ( int j = 0; j < h.NUP; ++j ) {
+    hepeup.IDUP[j] = v.IDUP[j];
+    hepeup.ISTUP[j] = v.ISTUP[j];
+    hepeup.MOTHUP[j] = make_pair(v.MOTHUP[2*j], v.MOTHUP[2*j + 1]);
+    hepeup.ICOLUP[j] = make_pair(v.ICOLUP[2*j], v.ICOLUP[2*j + 1]);
+    hepeup.PUP[j].assign(v.PUP + 5*j, v.PUP + 5*j + 5);
+    hepeup.VTIMUP[j] = v.VTIMUP[j];
+    hepeup.SPINUP[j] = v.SPINUP[j];
+  }
+  lastweight = h.lastweight;
+  preweight = h.preweight;
+  npLO = h.npLO;
+  npNLO = h.npNLO;
+  weights.clear();
+  for ( int j = 0; j < h.nWeights; ++j )
+    weights[theNames[v.weightIndex[j]]] = v.weights[j];
+  return true;
+}
@@ -0,0 +1,294 @@
+// -*- C++ -*-
+//
+// LesHouchesEventCache.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef THEPEG_LesHouchesEventCache_H
+#define THEPEG_LesHouchesEventCache_H
+// This is the declaration of the LesHouchesEventCache class.
+
+#include "LesHouches.h"
+#include <cstdio>
+#include <cstdint>
+
+namespace ThePEG {
+
+/**
+ * LesHouchesEventCache handles the binary cache files used by
+ * LesHouchesReader to store events in a fast-readable form.
+ *
+ * Each event is stored as a fixed-size Header followed by the HEPEUP
+ * particle information in columns of fixed width (IDUP, ISTUP,
+ * MOTHUP, ICOLUP, PUP, VTIMUP and SPINUP), and the indices and values
+ * of the optional weights. All blocks are aligned to eight bytes. At
+ * the end of the file follow the names of the optional weights and an
+ * index with the offset of each event.
+ *
+ * When a file is opened for reading it is mapped into memory, if
+ * possible, so that event(i) gives direct access to any event without
+ * copying or parsing, and so that several processes reading the same
+ * file share the same pages. The file is written in the native byte
+ * order and is not intended to be portable between machines.
+ *
+ * @see LesHouchesReader
+ */
+class LesHouchesEventCache {
+
+public:
+
+  /**
+   * The fixed-size part of an event in the cache.
+   */
+  struct Header {
+    /** The number of particles. */
+    std::int32_t NUP;
+    /** The subprocess code. */
+    std::int32_t IDPRUP;
+    /** The number of optional weights. */
+    std::int32_t nWeights;
+    /** The optional number of partons at LO. */
+    std::int32_t npLO;
+    /** The optional number of partons at NLO. */
+    std::int32_t npNLO;
+    /** Unused, for alignment. */
+    std::int32_t unused;
+    /** The event weight. */
+    double XWGTUP;
+    /** The PDF weights of the incoming partons. */
+    double XPDWUP[2];
+    /** The scale of the event. */
+    double SCALUP;
+    /** The QED coupling. */
+    double AQEDUP;
+    /** The QCD coupling. */
+    double AQCDUP;
+    /** The weight after reweighting in LesHouchesReader. */
+    double lastweight;
+    /** The preweight of the event. */
+    double preweight;
+  };
+
+  /**
+   * A view of an event in the cache, pointing directly into the
+   * mapped file. The particle arrays have Header::NUP entries (twice
+   * as many for MOTHUP and ICOLUP and five times for PUP) and the
+   * weight arrays have Header::nWeights entries.
+   */
+  struct EventView {
+    /** The fixed-size part. */
+    const Header * header;
+    /** The particle codes. */
+    const std::int64_t * IDUP;
+    /** The status codes. */
+    const std::int32_t * ISTUP;
+    /** The mother indices, in pairs. */
+    const std::int32_t * MOTHUP;
+    /** The colour indices, in pairs. */
+    const std::int32_t * ICOLUP;
+    /** The momenta and masses, five per particle. */
+    const double * PUP;
+    /** The lifetimes. */
+    const double * VTIMUP;
+    /** The spins. */
+    const double * SPINUP;
+    /** The indices of the names of the optional weights. */
+    const std::int32_t * weightIndex;
+    /** The values of the optional weights. */
+    const double * weights;
+  };
+
+public:
+
+  /** @name Standard constructors and destructors. */
+  //@{
+  /**
+   * The default constructor.
+   */
+  LesHouchesEventCache();
+
+  /**
+   * The destructor closes the file.
+   */
+  ~LesHouchesEventCache();
+  //@}
+
+public:
+
+  /**
+   * Open the given \a file for writing.
+   * @return false if the file could not be opened.
+   */
+  bool openWrite(string file);
+
+  /**
+   * Open the given \a file for reading. The file is mapped into
+   * memory or, if that fails, read in completely. The header, the
+   * index and the extent of each event are checked against the size
+   * of the file.
+   * @return false if the file could not be read or was not a
+   * complete and consistent cache file.
+   */
+  bool openRead(string file);
+
+  /**
+   * Close the file. If it was opened for writing the weight names
+   * and index are written first, unless writing has already failed.
+   * @return false if the file was opened for writing and could not
+   * be written completely.
+   */
+  bool close();
+
+  /**
+   * Return true if the file is open.
+   */
+  bool isOpen() const { return theWFile || theData; }
+
+  /**
+   * Return true if the file is open.
+   */
+  explicit operator bool() const { return isOpen(); }
+
+  /**
+   * Append an event to a file opened for writing.
+   * @return false if the event could not be written.
+   */
+  bool write(const HEPEUP & hepeup, double lastweight, double preweight,
+	     const map<string,double> & weights, int npLO, int npNLO);
+
+  /**
+   * The number of events in a file opened for reading.
+   */
+  std::size_t size() const { return theOffsets.size(); }
+
+  /**
+   * Return a view of event number \a i in a file opened for reading.
+   */
+  EventView event(std::size_t i) const;
+
+  /**
+   * Copy event number \a i in a file opened for reading into
+   * \a hepeup and the other arguments.
+   * @return false if there is no such event.
+   */
+  bool read(std::size_t i, HEPEUP & hepeup, double & lastweight,
+	    double & preweight, map<string,double> & weights,
+	    int & npLO, int & npNLO) const;
+
+  /**
+   * Copy the next event into the given arguments, as for read().
+   * @return false if the end of the file was reached.
+   */
+  bool next(HEPEUP & hepeup, double & lastweight, double & preweight,
+	    map<string,double> & weights, int & npLO, int & npNLO) {
+    return read(theNext++, hepeup, lastweight, preweight, weights,
+		npLO, npNLO);
+  }
+
+  /**
+   * Let next() start from the first event again.
+   */
+  void rewind() { theNext = 0; }
+
+  /**
+   * The names of the optional weights.
+   */
+  const vector<string> & weightNames() const { return theNames; }
+
+private:
+
+  /**
+   * Write \a n bytes from \a p to the file, padded to a multiple of
+   * eight bytes. If the write fails, writeFailed is set.
+   */
+  void put(const void * p, std::size_t n);
+
+  /**
+   * Check that the events in the index lie one after the other
+   * between the file header and \a end, and that their weight
+   * indices refer to existing names.
+   */
+  bool checkEvents(std::uint64_t end) const;
+
+  /**
+   * Write the names of the optional weights, the index and the
+   * trailer to a file opened for writing.
+   */
+  void writeTrailer();
+
+private:
+
+  /**
+   * The file being written.
+   */
+  std::FILE * theWFile;
+
+  /**
+   * The number of bytes written so far.
+   */
+  std::uint64_t theWPos;
+
+  /**
+   * True if writing to theWFile has failed.
+   */
+  bool writeFailed;
+
+  /**
+   * The contents of the file being read.
+   */
+  const char * theData;
+
+  /**
+   * The size of the file being read.
+   */
+  std::size_t theSize;
+
+  /**
+   * True if theData is mapped rather than allocated.
+   */
+  bool isMapped;
+
+  /**
+   * The offsets of the events in the file.
+   */
+  vector<std::uint64_t> theOffsets;
+
+  /**
+   * The names of the optional weights.
+   */
+  vector<string> theNames;
+
+  /**
+   * The indices of the names of the optional weights.
+   */
+  map<string,int> theNameIndex;
+
+  /**
+   * The next event to be read by next().
+   */
+  std::size_t theNext;
+
+  /**
+   * A buffer used when writing.
+   */
+  vector<char> theBuffer;
+
+private:
+
+  /**
+   * The copy constructor is private and not implemented.
+   */
+  LesHouchesEventCache(const LesHouchesEventCache &);
+
+  /**
+   * The assignment operator is private and not implemented.
+   */
+  LesHouchesEventCache & operator=(const LesHouchesEventCache &);
+
+};
+
+}
+
+#endif /* THEPEG_LesHouchesEventCache_H */
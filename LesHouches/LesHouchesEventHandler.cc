@@ -173,6 +173,7 @@ void LesHouchesEventHandler::doinitrun() {
   EventHandler::doinitrun();
   stats.reset();
   histStats.reset();
+  theMergedStatistics = false;
 
   weightnames.clear(); 
   
@@ -493,6 +494,106 @@ const map<string,CrossSection> & LesHouchesEventHandler::optintegratedXSecMap()
   return result;
 }
 
+namespace {
+
+/**
+ * Add the statistics \a x of another run to \a s, where the weights
+ * of \a x are in units of \a xmax rather than of the overestimated
+ * cross section \a smax used for \a s. If \a first is true \a s is
+ * replaced.
+ */
+void mergeStat(XSecStat & s, const XSecStat & x, bool first,
+	       CrossSection smax, CrossSection xmax) {
+  if ( first ) s = XSecStat(x.maxXSec());
+  s.merge(x, smax > ZERO? double(xmax/smax): 1.0);
+}
+
+/**
+ * Add the statistics \a x of another run to \a s, where both have
+ * their weights in units of their own overestimated cross section.
+ */
+void mergeStat(XSecStat & s, const XSecStat & x, bool first) {
+  if ( first ) s = XSecStat(x.maxXSec());
+  mergeStat(s, x, false, s.maxXSec(), x.maxXSec());
+}
+
+}
+
+void LesHouchesEventHandler::outputStatistics(PersistentOStream & os) const {
+  stats.outputSums(os);
+  histStats.outputSums(os);
+  os << ntries << long(readers().size());
+  for ( int i = 0, N = readers().size(); i < N; ++i ) {
+    const LesHouchesReader & reader = *readers()[i];
+    reader.stats.outputSums(os);
+    os << long(reader.statmap.size());
+    typedef LesHouchesReader::StatMap::const_iterator const_iterator;
+    for ( const_iterator it = reader.statmap.begin();
+	  it != reader.statmap.end(); ++it ) {
+      os << it->first;
+      it->second.outputSums(os);
+    }
+  }
+  os << long(opt.size());
+  for ( map<string,OptWeight>::const_iterator it = opt.begin();
+	it != opt.end(); ++it ) {
+    os << it->first;
+    it->second.stats.outputSums(os);
+    it->second.histStats.outputSums(os);
+  }
+}
+
+void LesHouchesEventHandler::mergeStatistics(PersistentIStream & is) {
+  bool first = !theMergedStatistics;
+  theMergedStatistics = true;
+  XSecStat x;
+  x.inputSums(is);
+  mergeStat(stats, x, first);
+  x.inputSums(is);
+  mergeStat(histStats, x, first);
+  int n = 0;
+  long nreaders = 0;
+  is >> n >> nreaders;
+  ntries = first? n: ntries + n;
+  if ( nreaders != long(readers().size()) )
+    throw Exception() << "Could not merge the statistics of event handler '"
+		      << name() << "' since the number of readers differ ("
+		      << nreaders << " and " << readers().size() << ")."
+		      << Exception::runerror;
+  for ( int i = 0, N = readers().size(); i < N; ++i ) {
+    LesHouchesReader & reader = *readers()[i];
+    x.inputSums(is);
+    // The per-process weights are given in units of the
+    // overestimated cross section of the reader.
+    CrossSection smax = first? x.maxXSec(): reader.stats.maxXSec();
+    CrossSection xmax = x.maxXSec();
+    mergeStat(reader.stats, x, first);
+    if ( first ) reader.statmap.clear();
+    long nproc = 0;
+    is >> nproc;
+    for ( long ip = 0; ip < nproc; ++ip ) {
+      int id = 0;
+      is >> id;
+      x.inputSums(is);
+      bool newproc = reader.statmap.find(id) == reader.statmap.end();
+      mergeStat(reader.statmap[id], x, newproc, smax, xmax);
+    }
+  }
+  if ( first ) opt.clear();
+  long nopt = 0;
+  is >> nopt;
+  for ( long iw = 0; iw < nopt; ++iw ) {
+    string wname;
+    is >> wname;
+    bool newopt = opt.find(wname) == opt.end();
+    OptWeight & o = opt[wname];
+    x.inputSums(is);
+    mergeStat(o.stats, x, newopt);
+    x.inputSums(is);
+    mergeStat(o.histStats, x, newopt);
+  }
+}
+
 CrossSection LesHouchesEventHandler::histogramScale() const {
   return histStats.xSec()/histStats.sumWeights();
 }
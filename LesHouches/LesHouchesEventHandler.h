@@ -70,8 +70,8 @@ public:
    * The default constructor.
    */
   LesHouchesEventHandler()
-    : theWeightOption(unitweight), theUnitTolerance(1.0e-6), warnPNum(true),
-      theNormWeight(0)
+    : ntries(0), theMergedStatistics(false), theWeightOption(unitweight),
+      theUnitTolerance(1.0e-6), warnPNum(true), theNormWeight(0)
   {
     selector().tolerance(unitTolerance());
   }
@@ -131,6 +131,17 @@ public:
 
   virtual const map<string,CrossSection> & optintegratedXSecMap() const;
 
+  /**
+   * Write the raw sums of the total, per-reader and optional weight
+   * statistics.
+   */
+  virtual void outputStatistics(PersistentOStream &) const;
+
+  /**
+   * Add the statistics written by outputStatistics() in another run.
+   */
+  virtual void mergeStatistics(PersistentIStream &);
+
   //@}
 
   /** @name Functions used for the actual generation */
@@ -363,6 +374,12 @@ protected:
   
   int ntries;
 
+  /**
+   * True if the statistics have been combined from other runs with
+   * mergeStatistics().
+   */
+  bool theMergedStatistics;
+
   /** 
    * Return the optional weights' statistics 
    */ 
@@ -17,14 +17,37 @@
 #include "ThePEG/Interface/Switch.h"
 #include "ThePEG/Interface/Parameter.h"
 #include "ThePEG/Utilities/Throw.h"
+#include "ThePEG/Utilities/HoldFlag.h"
 #include "ThePEG/PDT/DecayMode.h"
 #include "ThePEG/Persistency/PersistentOStream.h"
 #include "ThePEG/Persistency/PersistentIStream.h"
 #include <sstream>
 #include <iostream>
+#include <cctype>
 
 using namespace ThePEG;
 
+namespace {
+
+/**
+ * Find the \a n'th (counting from zero) white-space separated token
+ * in \a line and set \a tok to point to its first character.
+ * @return false if there are not that many tokens.
+ */
+bool lineToken(const char * line, int n, const char *& tok) {
+  for ( int i = 0; ; ++i ) {
+    while ( std::isspace(*line) ) ++line;
+    if ( *line == 0 ) return false;
+    if ( i == n ) {
+      tok = line;
+      return true;
+    }
+    while ( *line != 0 && !std::isspace(*line) ) ++line;
+  }
+}
+
+}
+
 LesHouchesFileReader::
 LesHouchesFileReader(const LesHouchesFileReader & x)
   : LesHouchesReader(x), neve(x.neve), ieve(0),
@@ -35,9 +58,13 @@ LesHouchesFileReader(const LesHouchesFileReader & x)
     theFileName(x.theFileName), theQNumbers(x.theQNumbers),
     theIncludeFxFxTags(x.theIncludeFxFxTags),
     theIncludeCentral(x.theIncludeCentral),
-    theDecayer(x.theDecayer) {}
+    theDecayer(x.theDecayer), thePrefetch(x.thePrefetch),
+    thePrefetchAllowed(false), thePrefetchHead(0), thePrefetchCount(0),
+    thePrefetchStop(false), thePrefetchEnd(false) {}
 
-LesHouchesFileReader::~LesHouchesFileReader() {}
+LesHouchesFileReader::~LesHouchesFileReader() {
+  stopPrefetch();
+}
 
 IBPtr LesHouchesFileReader::clone() const {
   return new_ptr(*this);
@@ -476,6 +503,7 @@ void LesHouchesFileReader::open() {
       << "No Les Houches file name. "
       << "Use 'set " << name() << ":FileName'."
       << Exception::runerror;
+  stopPrefetch();
   cfile.open(filename());
   if ( !cfile )
     throw LesHouchesFileError()
@@ -648,15 +676,118 @@ void LesHouchesFileReader::open() {
 }
 
 bool LesHouchesFileReader::doReadEvent() {
+  // If the prefetch thread has been started, cfile must not be
+  // touched here.
+  if ( thePrefetchThread.joinable() || thePrefetchEnd )
+    return readPrefetched();
   if ( !cfile ) return false;
   if ( LHFVersion.empty() ) return false;
   if ( heprup.NPRUP < 0 ) return false;
+  if ( thePrefetch > 0 && thePrefetchAllowed ) {
+    startPrefetch();
+    return readPrefetched();
+  }
+  theEvent.ok = parseEvent(theEvent);
+  return takeEvent(theEvent);
+}
+
+bool LesHouchesFileReader::takeEvent(EventRecord & rec) {
+  using std::swap;
   eventComments = "";
+  swap(hepeup, rec.hepeup);
+  swap(optionalWeights, rec.optionalWeights);
+  optionalnpLO = rec.npLO;
+  optionalnpNLO = rec.npNLO;
+  swap(eventAttributes, rec.eventAttributes);
+  swap(outsideBlock, rec.outsideBlock);
+  return rec.ok;
+}
+
+void LesHouchesFileReader::startPrefetch() {
+  thePrefetchBuffer.resize(thePrefetch);
+  thePrefetchHead = thePrefetchCount = 0;
+  thePrefetchStop = thePrefetchEnd = false;
+  thePrefetchThread = std::thread(&LesHouchesFileReader::prefetchEvents, this);
+}
+
+void LesHouchesFileReader::stopPrefetch() {
+  if ( thePrefetchThread.joinable() ) {
+    {
+      std::lock_guard<std::mutex> lock(thePrefetchMutex);
+      thePrefetchStop = true;
+    }
+    thePrefetchCondition.notify_all();
+    thePrefetchThread.join();
+  }
+  thePrefetchBuffer.clear();
+  thePrefetchHead = thePrefetchCount = 0;
+  thePrefetchStop = thePrefetchEnd = false;
+}
+
+void LesHouchesFileReader::prefetchEvents() {
+  const std::size_t N = thePrefetchBuffer.size();
+  while ( true ) {
+    EventRecord * rec = 0;
+    {
+      std::unique_lock<std::mutex> lock(thePrefetchMutex);
+      while ( !thePrefetchStop && thePrefetchCount >= N )
+	thePrefetchCondition.wait(lock);
+      if ( thePrefetchStop ) return;
+      // This slot is not seen by the reading thread until the count
+      // is increased below.
+      rec = &thePrefetchBuffer[(thePrefetchHead + thePrefetchCount)%N];
+    }
+    rec->error = std::exception_ptr();
+    try {
+      rec->ok = parseEvent(*rec);
+    }
+    catch ( ... ) {
+      rec->ok = false;
+      rec->error = std::current_exception();
+    }
+    bool end = !rec->ok && !rec->error;
+    {
+      std::lock_guard<std::mutex> lock(thePrefetchMutex);
+      ++thePrefetchCount;
+    }
+    thePrefetchCondition.notify_all();
+    if ( end ) return;
+  }
+}
+
+bool LesHouchesFileReader::readPrefetched() {
+  if ( thePrefetchEnd ) return false;
+  EventRecord * rec = 0;
+  {
+    std::unique_lock<std::mutex> lock(thePrefetchMutex);
+    while ( thePrefetchCount == 0 ) thePrefetchCondition.wait(lock);
+    rec = &thePrefetchBuffer[thePrefetchHead];
+  }
+  bool ok = takeEvent(*rec);
+  std::exception_ptr error;
+  swap(error, rec->error);
+  {
+    std::lock_guard<std::mutex> lock(thePrefetchMutex);
+    thePrefetchHead = (thePrefetchHead + 1)%thePrefetchBuffer.size();
+    --thePrefetchCount;
+  }
+  thePrefetchCondition.notify_all();
+  if ( error ) std::rethrow_exception(error);
+  if ( !ok ) thePrefetchEnd = true;
+  return ok;
+}
+
+bool LesHouchesFileReader::parseEvent(EventRecord & rec) {
+  HEPEUP & hepeup = rec.hepeup;
+  map<string,double> & optionalWeights = rec.optionalWeights;
+  string & outsideBlock = rec.outsideBlock;
+  map<string,double> optionalWeightsTemp;
   outsideBlock = "";
   hepeup.NUP = 0;
   hepeup.XPDWUP.first = hepeup.XPDWUP.second = 0.0;
   optionalWeights.clear();
-  optionalWeightsTemp.clear();
+  rec.eventAttributes.clear();
+  rec.npLO = rec.npNLO = -99;
   // Keep reading lines until we hit the next event or the end of
   // the event block. Save any inbetween lines. Exit if we didn't
   // find an event.
@@ -664,30 +795,29 @@ bool LesHouchesFileReader::doReadEvent() {
     outsideBlock += cfile.getline() + "\n";
 
   // We found an event. First scan for attributes.
-  eventAttributes = StringUtils::xmlAttributes("event", cfile.getline());
+  rec.eventAttributes = StringUtils::xmlAttributes("event", cfile.getline());
 
   /* information necessary for FxFx merging:
    * the npLO and npNLO tags
    */
-  istringstream ievat(cfile.getline());
-  int we(0), npLO(-99), npNLO(-99);
-  do {
-    string sub; ievat >> sub;
-    if(we==2) { npLO = atoi(sub.c_str()); }
-    if(we==5) { npNLO = atoi(sub.c_str()); }
-    ++we;
-  } while (ievat);
-  optionalnpLO = npLO;
-  optionalnpNLO = npNLO;
-  std::stringstream npstringstream;
-  npstringstream << "np " << npLO << " " << npNLO;
-  std::string npstrings = npstringstream.str();
+  int npLO(-99), npNLO(-99);
+  const char * tok = 0;
+  if ( lineToken(cfile.current(), 1, tok) )
+    npLO = lineToken(cfile.current(), 2, tok)? atoi(tok): 0;
+  if ( lineToken(cfile.current(), 4, tok) )
+    npNLO = lineToken(cfile.current(), 5, tok)? atoi(tok): 0;
+  rec.npLO = npLO;
+  rec.npNLO = npNLO;
   /* the FxFx merging information 
    * becomes part of the optionalWeights, labelled -999 
    * for future reference
    */
 
-  if(theIncludeFxFxTags) optionalWeights[npstrings.c_str()] = -999;
+  if(theIncludeFxFxTags) {
+    std::stringstream npstringstream;
+    npstringstream << "np " << npLO << " " << npNLO;
+    optionalWeights[npstringstream.str()] = -999;
+  }
 
   if ( !cfile.readline()  ) return false;
 
@@ -737,17 +867,14 @@ bool LesHouchesFileReader::doReadEvent() {
      */
     if(readingWeights) { 
       if(!cfile.find("<wgt")) { continue; }
-      istringstream iss(cfile.getline());
-      int wi = 0;
+      // the line is "<wgt id='name'> value </wgt>": skip the tag and
+      // read the name and the value directly from the line buffer.
       double weightValue(0);
-      string weightName = "";
-      // we need to put the actual weight value into a double
-      do {
-	string sub; iss >> sub;
-	if(wi==1) { string str_arrow = ">" ; erase_substr(sub, str_arrow); weightName = sub; }
-	if(wi==2) weightValue = atof(sub.c_str());
-	++wi;
-      } while (iss);
+      string weightName;
+      cfile >> weightName >> weightName >> weightValue;
+      cfile.resetline();
+      string str_arrow = ">";
+      erase_substr(weightName, str_arrow);
       // store the optional weights found in the temporary map
       optionalWeightsTemp[weightName] = weightValue; 
     }
@@ -838,19 +965,42 @@ bool LesHouchesFileReader::doReadEvent() {
 }
 
 void LesHouchesFileReader::close() {
+  stopPrefetch();
   cfile.close();
 }
 
+long LesHouchesFileReader::scan() {
+  long n = 0;
+  {
+    HoldFlag<> noPrefetch(thePrefetchAllowed, false);
+    n = LesHouchesReader::scan();
+  }
+  if ( !thePrefetchAllowed ) close();
+  return n;
+}
+
+void LesHouchesFileReader::doinitrun() {
+  thePrefetchAllowed = true;
+  LesHouchesReader::doinitrun();
+}
+
+void LesHouchesFileReader::dofinish() {
+  thePrefetchAllowed = false;
+  LesHouchesReader::dofinish();
+}
+
 void LesHouchesFileReader::persistentOutput(PersistentOStream & os) const {
   os << neve << LHFVersion << outsideBlock << headerBlock << initComments
      << initAttributes << eventComments << eventAttributes << theFileName
-     << theQNumbers << theIncludeFxFxTags << theIncludeCentral << theDecayer ;
+     << theQNumbers << theIncludeFxFxTags << theIncludeCentral << theDecayer
+     << thePrefetch;
 }
 
 void LesHouchesFileReader::persistentInput(PersistentIStream & is, int) {
   is >> neve >> LHFVersion >> outsideBlock >> headerBlock >> initComments
      >> initAttributes >> eventComments >> eventAttributes >> theFileName
-     >> theQNumbers >> theIncludeFxFxTags >> theIncludeCentral >> theDecayer;
+     >> theQNumbers >> theIncludeFxFxTags >> theIncludeCentral >> theDecayer
+     >> thePrefetch;
   ieve = 0;
 }
 
@@ -927,6 +1077,15 @@ void LesHouchesFileReader::Init() {
 
 
 
+  static Parameter<LesHouchesFileReader,unsigned int> interfacePrefetch
+    ("Prefetch",
+     "The number of events to read ahead from the file in a separate "
+     "thread, so that reading and parsing the file overlaps with the "
+     "processing of the events. If zero, no separate thread is used and "
+     "each event is read when it is requested.",
+     &LesHouchesFileReader::thePrefetch, 0, 0, 0,
+     true, false, Interface::lowerlim);
+
   static Reference<LesHouchesFileReader,Decayer> interfaceDecayer
     ("Decayer",
      "Decayer to use for any decays read from the QNUMBERS Blocks",
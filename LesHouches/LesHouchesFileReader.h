@@ -16,6 +16,10 @@
 #include "ThePEG/Utilities/CFileLineReader.h"
 #include <string>
 #include <stdio.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 namespace ThePEG {
 
@@ -31,6 +35,13 @@ namespace ThePEG {
  * class is able to read plain event files conforming to the Les
  * Houches Event File accord.
  *
+ * If the Prefetch parameter is non-zero, events are read and parsed
+ * in a separate thread which fills a ring buffer of the given number
+ * of events, so that reading the file overlaps with the processing
+ * of the previous events. The thread is only used in the run phase
+ * and not while the file is scanned, so it is never running while
+ * the EventGenerator is initialized, saved or forked.
+ *
  * @see \ref LesHouchesFileReaderInterfaces "Th1e interfaces"
  * defined for LesHouchesFileReader.
  * @see Event
@@ -47,7 +58,10 @@ public:
    */
   LesHouchesFileReader() : neve(0), ieve(0), theQNumbers(false),
 			   theIncludeFxFxTags(false),
-			   theIncludeCentral(false) {}
+			   theIncludeCentral(false), thePrefetch(0),
+			   thePrefetchAllowed(false),
+			   thePrefetchHead(0), thePrefetchCount(0),
+			   thePrefetchStop(false), thePrefetchEnd(false) {}
 
   /**
    * Copy-constructor. Note that a file which is opened in the object
@@ -82,6 +96,13 @@ public:
    * Close the file from which events have been read.
    */
   virtual void close();
+
+  /**
+   * Scan the file as LesHouchesReader::scan() without reading ahead in
+   * a separate thread. Unless called in the run phase, the file is
+   * closed afterwards.
+   */
+  virtual long scan();
  
 
   /**
@@ -134,6 +155,67 @@ public:
   
   void erase_substr(std::string& subject, const std::string& search);
 
+private:
+
+  /**
+   * The information parsed from one event in the file.
+   */
+  struct EventRecord {
+    /** Default constructor. */
+    EventRecord() : ok(false), npLO(-99), npNLO(-99) {}
+    /** False if the event could not be read. */
+    bool ok;
+    /** The event. */
+    HEPEUP hepeup;
+    /** The optional weights. */
+    map<string,double> optionalWeights;
+    /** The optional number of partons at LO. */
+    int npLO;
+    /** The optional number of partons at NLO. */
+    int npNLO;
+    /** The attributes of the event tag. */
+    map<string,string> eventAttributes;
+    /** The lines found before the event tag. */
+    string outsideBlock;
+    /** An exception thrown while parsing the event. */
+    std::exception_ptr error;
+  };
+
+  /**
+   * Read the next event from cfile into \a rec. Only \a rec and
+   * cfile are modified, so that this can be run in a separate thread.
+   * @return false if no event could be read.
+   */
+  bool parseEvent(EventRecord & rec);
+
+  /**
+   * Swap the contents of \a rec with the corresponding protected
+   * variables.
+   * @return \a rec.ok.
+   */
+  bool takeEvent(EventRecord & rec);
+
+  /**
+   * Start the thread filling the prefetch buffer.
+   */
+  void startPrefetch();
+
+  /**
+   * Stop and join the thread filling the prefetch buffer, and discard
+   * any events in the buffer.
+   */
+  void stopPrefetch();
+
+  /**
+   * The function run by the thread filling the prefetch buffer.
+   */
+  void prefetchEvents();
+
+  /**
+   * Take the next event from the prefetch buffer, waiting for it to
+   * be parsed if necessary.
+   */
+  bool readPrefetched();
 
 protected:
 
@@ -161,6 +243,19 @@ protected:
    */
   virtual void doinit();
 
+  /**
+   * Initialize this object. Called in the run phase just before a run
+   * begins. Only after this are events read ahead in a separate
+   * thread.
+   */
+  virtual void doinitrun();
+
+  /**
+   * Finalize this object. Called in the run phase just after a run
+   * has ended.
+   */
+  virtual void dofinish();
+
   /**
    * Return true if this object needs to be initialized before all
    * other objects because it needs to extract PDFs from the event file.
@@ -260,10 +355,62 @@ private:
   map<string,string> scalemap;
 
   /**
-   * Temporary holder for optional weights
+   * The number of events to read ahead in a separate thread. If zero
+   * all events are read when requested.
    */
-  
-  map<string,double> optionalWeightsTemp;
+  unsigned int thePrefetch;
+
+  /**
+   * True in the run phase, outside of scan(), when the prefetch thread
+   * may be started. The thread is never running while the object is
+   * being set up, saved or copied to worker processes.
+   */
+  bool thePrefetchAllowed;
+
+  /**
+   * The event being read if not prefetching.
+   */
+  EventRecord theEvent;
+
+  /**
+   * The thread filling the prefetch buffer.
+   */
+  std::thread thePrefetchThread;
+
+  /**
+   * Protects the prefetch buffer.
+   */
+  std::mutex thePrefetchMutex;
+
+  /**
+   * Signals changes in the prefetch buffer.
+   */
+  std::condition_variable thePrefetchCondition;
+
+  /**
+   * The ring buffer of prefetched events.
+   */
+  vector<EventRecord> thePrefetchBuffer;
+
+  /**
+   * The position in thePrefetchBuffer of the next event to be taken.
+   */
+  std::size_t thePrefetchHead;
+
+  /**
+   * The number of parsed events in thePrefetchBuffer.
+   */
+  std::size_t thePrefetchCount;
+
+  /**
+   * Set to tell the prefetch thread to stop.
+   */
+  bool thePrefetchStop;
+
+  /**
+   * True if the prefetch thread has reached the end of the file.
+   */
+  bool thePrefetchEnd;
 
 
 private:
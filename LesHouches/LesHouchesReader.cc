@@ -496,8 +496,7 @@ void LesHouchesReader::reopen() {
         << name() << Exception::runerror;
   }
   if ( cacheFile() ) {
-    closeCacheFile();
-    openReadCacheFile();
+    cacheFile().rewind();
     if ( !uncacheEvent() ) Throw<LesHouchesReopenError>()
       << "Could not reopen LesHouchesReader '" << name()
       << "'." << Exception::runerror;
@@ -1145,86 +1144,42 @@ void LesHouchesReader::connectMothers() {
 
 void LesHouchesReader::openReadCacheFile() {
   if ( cacheFile() ) closeCacheFile();
-  cacheFile().open(cacheFileName(), "r");
+  if ( !cacheFile().openRead(cacheFileName()) )
+    Throw<LesHouchesCacheWarning>()
+      << "Could not read the cache file '" << cacheFileName()
+      << "' in LesHouchesReader '" << name() << "', or it was not a valid "
+      << "cache file. The events will be read from the event file instead."
+      << Exception::warning;
   position = 0;
 }
 
 void LesHouchesReader::openWriteCacheFile() {
   if ( cacheFile() ) closeCacheFile();
-  cacheFile().open(cacheFileName(), "w");
+  if ( !cacheFile().openWrite(cacheFileName()) )
+    Throw<LesHouchesCacheWarning>()
+      << "Could not open the cache file '" << cacheFileName()
+      << "' for writing in LesHouchesReader '" << name() << "'."
+      << Exception::warning;
 }
 
 void LesHouchesReader::closeCacheFile() {
-  cacheFile().close();
+  if ( !cacheFile().close() )
+    Throw<LesHouchesCacheWarning>()
+      << "Could not write the cache file '" << cacheFileName()
+      << "' in LesHouchesReader '" << name() << "'. It will not be used "
+      << "and the events will be read from the event file instead."
+      << Exception::warning;
 }
 
-void LesHouchesReader::cacheEvent() const {
-  static vector<char> buff;
-  cacheFile().write(&hepeup.NUP, sizeof(hepeup.NUP));
-  buff.resize(eventSize(hepeup.NUP));
-  char * pos = &buff[0];
-  pos = mwrite(pos, hepeup.IDPRUP);
-  pos = mwrite(pos, hepeup.XWGTUP);
-  pos = mwrite(pos, hepeup.XPDWUP);
-  pos = mwrite(pos, hepeup.SCALUP);
-  pos = mwrite(pos, hepeup.AQEDUP);
-  pos = mwrite(pos, hepeup.AQCDUP);
-  pos = mwrite(pos, hepeup.IDUP[0], hepeup.NUP);
-  pos = mwrite(pos, hepeup.ISTUP[0], hepeup.NUP);
-  pos = mwrite(pos, hepeup.MOTHUP[0], hepeup.NUP);
-  pos = mwrite(pos, hepeup.ICOLUP[0], hepeup.NUP);
-  for ( int i = 0; i < hepeup.NUP; ++i )
-    pos = mwrite(pos, hepeup.PUP[i][0], 5);
-  pos = mwrite(pos, hepeup.VTIMUP[0], hepeup.NUP);
-  pos = mwrite(pos, hepeup.SPINUP[0], hepeup.NUP);
-  pos = mwrite(pos, lastweight);
-  pos = mwrite(pos, optionalWeights);
-  for(size_t ff = 0; ff < optionalWeightsNames.size(); ff++) {
-    pos = mwrite(pos, optionalWeightsNames[ff]);
-  }
-  pos = mwrite(pos, optionalnpLO);
-  pos = mwrite(pos, optionalnpNLO);
-  pos = mwrite(pos, preweight);
-  cacheFile().write(&buff[0], buff.size(), 1);
+void LesHouchesReader::cacheEvent() {
+  cacheFile().write(hepeup, lastweight, preweight, optionalWeights,
+		    optionalnpLO, optionalnpNLO);
 }
 
 bool LesHouchesReader::uncacheEvent() {
   reset();
-  static vector<char> buff;
-  if ( cacheFile().read(&hepeup.NUP, sizeof(hepeup.NUP)) != 1 )
-    return false;
-  buff.resize(eventSize(hepeup.NUP));
-  if ( cacheFile().read(&buff[0], buff.size()) != 1 ) return false;
-  const char * pos = &buff[0];
-  pos = mread(pos, hepeup.IDPRUP);
-  pos = mread(pos, hepeup.XWGTUP);
-  pos = mread(pos, hepeup.XPDWUP);
-  pos = mread(pos, hepeup.SCALUP);
-  pos = mread(pos, hepeup.AQEDUP);
-  pos = mread(pos, hepeup.AQCDUP);
-  hepeup.IDUP.resize(hepeup.NUP);
-  pos = mread(pos, hepeup.IDUP[0], hepeup.NUP);
-  hepeup.ISTUP.resize(hepeup.NUP);
-  pos = mread(pos, hepeup.ISTUP[0], hepeup.NUP);
-  hepeup.MOTHUP.resize(hepeup.NUP);
-  pos = mread(pos, hepeup.MOTHUP[0], hepeup.NUP);
-  hepeup.ICOLUP.resize(hepeup.NUP);
-  pos = mread(pos, hepeup.ICOLUP[0], hepeup.NUP);
-  hepeup.PUP.resize(hepeup.NUP, vector<double>(5));
-  for ( int i = 0; i < hepeup.NUP; ++i ) 
-    pos = mread(pos, hepeup.PUP[i][0], 5);
-  hepeup.VTIMUP.resize(hepeup.NUP);
-  pos = mread(pos, hepeup.VTIMUP[0], hepeup.NUP);
-  hepeup.SPINUP.resize(hepeup.NUP);
-  pos = mread(pos, hepeup.SPINUP[0], hepeup.NUP);
-  pos = mread(pos, lastweight);
-  pos = mread(pos, optionalWeights);
-  for(size_t ff = 0; ff < optionalWeightsNames.size(); ff++) {
-    pos = mread(pos, optionalWeightsNames[ff]);
-  }
-  pos = mread(pos, optionalnpLO);
-  pos = mread(pos, optionalnpNLO);
-  pos = mread(pos, preweight);
+  if ( !cacheFile().next(hepeup, lastweight, preweight, optionalWeights,
+			 optionalnpLO, optionalnpNLO) ) return false;
 
   // If we are skipping, we do not have to do anything else.
   if ( skipping ) return true;
@@ -1369,7 +1324,8 @@ void LesHouchesReader::Init() {
   static Parameter<LesHouchesReader,string> interfaceCacheFileName
     ("CacheFileName",
      "Name of file used to cache the events from the reader in a fast-readable "
-     "form. If empty, no cache file will be generated.",
+     "binary form. If empty, no cache file will be generated. The file is "
+     "mapped into memory when read, so it cannot be compressed.",
      &LesHouchesReader::theCacheFileName, "",
      true, false);
   interfaceCacheFileName.fileType();
@@ -20,6 +20,7 @@
 #include "ThePEG/MatrixElement/ReweightBase.h"
 #include "LesHouchesEventHandler.fh"
 #include "LesHouchesReader.fh"
+#include "LesHouchesEventCache.h"
 #include "ThePEG/Utilities/CFile.h"
 #include <cstdio>
 #include <cstring>
@@ -258,21 +259,6 @@ public:
   /** @name Access information about the current event. */
   //@{
 
-  /**
-   * Return the size of this event in bytes. To be used for the cache
-   * file. \a npart is the number of particles. If \a npart is 0, the
-   * number is taken from NUP.
-   */
-  static size_t eventSize(int N) {
-    return (N + 1)*sizeof(int) +       // IDPRUP, ISTUP
-      (7*N + 4)*sizeof(double) +       // XWGTUP, SCALUP, AQEDUP, AQCDUP, PUP,
-                                       // VTIMUP, SPINUP
-      N*sizeof(long) +                 // IDUP
-      2*N*sizeof(pair<int,int>) +      // MOTHUP, ICOLUP
-      sizeof(pair<double,double>) +    // XPDWUP.
-      2*sizeof(double);                // lastweight and preweight
-  }
-
   /**
    * The current event weight given by XWGTUP times possible
    * reweighting. Note that this is not necessarily the same as what
@@ -450,12 +436,19 @@ protected:
   bool cutEarly() const { return doCutEarly; }
 
   /**
-   * File stream for the cache.
+   * The cache file.
    */
-  CFile cacheFile() const { return theCacheFile;}
+  LesHouchesEventCache & cacheFile() { return theCacheFile; }
 
   /**
-   * Open the cache file for reading.
+   * The cache file.
+   */
+  const LesHouchesEventCache & cacheFile() const { return theCacheFile; }
+
+  /**
+   * Open the cache file for reading. If it cannot be read or is not
+   * a valid cache file, a warning is issued and the events are read
+   * from the event file instead.
    */
   void openReadCacheFile();
 
@@ -465,17 +458,19 @@ protected:
   void openWriteCacheFile();
 
   /**
-   * Close the cache file;
+   * Close the cache file. If it could not be written completely a
+   * warning is issued.
    */
   void closeCacheFile();
 
   /**
    * Write the current event to the cache file.
    */
-  void cacheEvent() const;
+  void cacheEvent();
 
   /**
-   * Read an event from the cache file. Return false if something went wrong.
+   * Read the next event from the cache file. Return false if something
+   * went wrong or if the end of the file was reached.
    */
   bool uncacheEvent();
 
@@ -486,24 +481,6 @@ protected:
    */
   void reopen();
 
-  /**
-   * Helper function to write a variable to a memory location
-   */
-  template <typename T>
-  static char * mwrite(char * pos, const T & t, size_t n = 1) {
-    std::memcpy(pos, &t, n*sizeof(T));
-    return pos + n*sizeof(T);
-  }
-
-  /**
-   * Helper function to read a variable from a memory location
-   */
-  template <typename T>
-  static const char * mread(const char * pos, T & t, size_t n = 1) {
-    std::memcpy(&t, pos, n*sizeof(T));
-    return pos + n*sizeof(T);
-  }
-
   //@}
 
   /** @name Auxilliary virtual methods which may be verridden by sub-classes. */
@@ -773,9 +750,9 @@ protected:
   PVector theIntermediates;
 
   /**
-   * File stream for the cache.
+   * The cache file.
    */
-  CFile theCacheFile;
+  LesHouchesEventCache theCacheFile;
 
   /**
    * The reweight objects modifying the weights of this reader.
@@ -946,6 +923,10 @@ public:
       event file fails. */
   class LesHouchesReopenError: public Exception {};
 
+  /** Exception class used by LesHouchesReader in case the cache file
+      cannot be written or read. */
+  class LesHouchesCacheWarning: public Exception {};
+
   /** Exception class used by LesHouchesReader in case there is
       information missing in the initialization phase. */
   class LesHouchesInitError: public InitException {};
@@ -0,0 +1,213 @@
+// -*- C++ -*-
+//
+// lesHouchesBenchParse.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Measures how fast the event blocks of a Les Houches event file are
+// parsed. A synthetic file with a number of particles and <wgt>
+// weights per event is written and then read twice: once with
+// CFileLineReader, parsing the lines as LesHouchesFileReader did
+// before, with strtol()/strtod(), std::string searches and an
+// istringstream for the event tag and each weight line, and once with
+// LesHouchesFileReader itself, which also matches each weight with its
+// <initrwgt> description and fills the event record. The throughput
+// in MB/s and a checksum of the numbers read are printed for both; the
+// checksums should agree up to rounding.
+// Usage: leshouches_bench_parse [nevents [nweights [file]]]
+//
+
+#include "ThePEG/LesHouches/LesHouchesFileReader.h"
+#include "ThePEG/Repository/BaseRepository.h"
+#include "ThePEG/Interface/InterfaceBase.h"
+#include "ThePEG/Utilities/CFileLineReader.h"
+#include <cctype>
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+using namespace ThePEG;
+
+namespace {
+
+const int nParticles = 8;
+
+void writeFile(string filename, long nevents, int nweights) {
+  FILE * f = std::fopen(filename.c_str(), "w");
+  // The weights are only kept by LesHouchesFileReader if they are
+  // described in an <initrwgt> block.
+  std::fprintf(f, "<LesHouchesEvents version=\"3.0\">\n<header>\n"
+	       "<initrwgt>\n<weightgroup type='bench'>\n");
+  for ( int iw = 0; iw < nweights; ++iw )
+    std::fprintf(f, "<weight id='%d'> bench%d </weight>\n",
+		 1001 + iw, iw);
+  std::fprintf(f, "</weightgroup>\n</initrwgt>\n</header>\n<init>\n"
+	       "2212 2212 6.5e+03 6.5e+03 0 0 247000 247000 -4 1\n"
+	       "1.0e+01 1.0e-01 1.0e+01 1\n</init>\n");
+  for ( long ie = 0; ie < nevents; ++ie ) {
+    std::fprintf(f, "<event npLO=\" %ld \" npNLO=\" %ld \">\n",
+		 ie%3, (ie + 1)%3);
+    std::fprintf(f, " %d 1 +%.10e %.8e %.8e %.8e\n", nParticles,
+		 1.0 + 1.0e-3*ie, 91.188 + ie%7, 7.54e-3, 0.118);
+    for ( int ip = 0; ip < nParticles; ++ip )
+      std::fprintf(f, " %8d %2d %4d %4d %4d %4d %+.10e %+.10e %+.10e"
+		   " %.10e %.10e %.4e %.4e\n",
+		   ip%2? 21: 2, ip < 2? -1: 1, ip < 2? 0: 1, ip < 2? 0: 2,
+		   501 + ip, 502 + ip, 1.234567891e2*(ip - 3.5),
+		   -9.87654321e1 + ip*ie%11, 3.3e3/(ip + 1.0),
+		   4.0e3 + 13.0*ip, 0.0, 0.0, 9.0);
+    std::fprintf(f, "<rwgt>\n");
+    for ( int iw = 0; iw < nweights; ++iw )
+      std::fprintf(f, "<wgt id='%d'> %+.8e </wgt>\n", 1001 + iw,
+		   (1.0 + 1.0e-3*ie)*(1.0 + 0.01*iw));
+    std::fprintf(f, "</rwgt>\n</event>\n");
+  }
+  std::fprintf(f, "</LesHouchesEvents>\n");
+  std::fclose(f);
+}
+
+/*
+ * A LesHouchesFileReader giving access to the start of the run phase
+ * and to the event read.
+ */
+struct BenchFileReader: public LesHouchesFileReader {
+  void startRun() { doinitrun(); }
+  const HEPEUP & event() const { return hepeup; }
+};
+
+/*
+ * Parse the events the way LesHouchesFileReader did before.
+ */
+double parseBefore(string filename) {
+  CFileLineReader cfile(filename);
+  double sum = 0.0;
+  while ( true ) {
+    while ( cfile.readline() && string(cfile.current()).find("<event")
+	    == string::npos );
+    if ( !cfile ) break;
+    istringstream ievat(cfile.getline());
+    int we(0), npLO(-99), npNLO(-99);
+    do {
+      string sub; ievat >> sub;
+      if(we==2) { npLO = atoi(sub.c_str()); }
+      if(we==5) { npNLO = atoi(sub.c_str()); }
+      ++we;
+    } while (ievat);
+    sum += npLO + 10*npNLO;
+    if ( !cfile.readline() ) break;
+    char * p = const_cast<char *>(cfile.current());
+    long nup = std::strtol(p, &p, 0);
+    sum += std::strtol(p, &p, 0);
+    for ( int i = 0; i < 4; ++i ) sum += std::strtod(p, &p);
+    for ( long ip = 0; ip < nup; ++ip ) {
+      if ( !cfile.readline() ) return sum;
+      p = const_cast<char *>(cfile.current());
+      for ( int i = 0; i < 6; ++i ) sum += std::strtol(p, &p, 0);
+      for ( int i = 0; i < 7; ++i ) sum += std::strtod(p, &p);
+    }
+    bool readingWeights = false;
+    while ( cfile.readline() &&
+	    string(cfile.current()).find("</event>") == string::npos ) {
+      if ( string(cfile.current()).find("</rwgt") != string::npos )
+	readingWeights = false;
+      if ( readingWeights ) {
+	if ( string(cfile.current()).find("<wgt") == string::npos ) continue;
+	istringstream iss(cfile.getline());
+	int wi = 0;
+	double weightValue(0);
+	string weightName = "";
+	do {
+	  string sub; iss >> sub;
+	  if(wi==1) weightName = sub;
+	  if(wi==2) weightValue = atof(sub.c_str());
+	  ++wi;
+	} while (iss);
+	sum += weightValue;
+      }
+      if ( string(cfile.current()).find("<rwgt") != string::npos )
+	readingWeights = true;
+    }
+  }
+  return sum;
+}
+
+/*
+ * Create a reader for the file and start the run, which opens it.
+ */
+RCPtr<BenchFileReader> openReader(string filename) {
+  RCPtr<BenchFileReader> r = new_ptr(BenchFileReader());
+  IBPtr proto = new_ptr(LesHouchesFileReader());
+  BaseRepository::FindInterface(proto, "FileName")->exec(*r, "set", filename);
+  r->startRun();
+  return r;
+}
+
+/*
+ * Read all events with LesHouchesFileReader::doReadEvent(), which
+ * parses them with LesHouchesFileReader::parseEvent().
+ */
+double parseAfter(BenchFileReader & reader) {
+  double sum = 0.0;
+  while ( reader.doReadEvent() ) {
+    const HEPEUP & e = reader.event();
+    sum += reader.optionalEventnpLO() + 10*reader.optionalEventnpNLO();
+    sum += e.IDPRUP + e.XWGTUP + e.SCALUP + e.AQEDUP + e.AQCDUP;
+    for ( int ip = 0; ip < e.NUP; ++ip ) {
+      sum += e.IDUP[ip] + e.ISTUP[ip] + e.MOTHUP[ip].first
+	+ e.MOTHUP[ip].second + e.ICOLUP[ip].first + e.ICOLUP[ip].second;
+      for ( int i = 0; i < 5; ++i ) sum += e.PUP[ip][i];
+      sum += e.VTIMUP[ip] + e.SPINUP[ip];
+    }
+    for ( map<string,double>::const_iterator w =
+	    reader.optionalEventWeights().begin();
+	  w != reader.optionalEventWeights().end(); ++w )
+      sum += w->second;
+  }
+  reader.close();
+  return sum;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+double seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  long nevents = argc > 1 ? std::atol(argv[1]) : 40000;
+  int nweights = argc > 2 ? std::atoi(argv[2]) : 100;
+  string filename = argc > 3 ? argv[3] : "leshouches_bench_parse.lhe";
+
+  writeFile(filename, nevents, nweights);
+  FILE * f = std::fopen(filename.c_str(), "r");
+  std::fseek(f, 0, SEEK_END);
+  double mb = std::ftell(f)/1.0e6;
+  std::fclose(f);
+  std::cout << nevents << " events with " << nParticles << " particles and "
+	    << nweights << " weights, " << mb << " MB" << std::endl;
+
+  // Read the file once to have it in the page cache.
+  parseBefore(filename);
+
+  Clock::time_point start = Clock::now();
+  double sum = parseBefore(filename);
+  double t = seconds(start);
+  std::cout << "before: " << mb/t << " MB/s, checksum " << sum << std::endl;
+
+  RCPtr<BenchFileReader> reader = openReader(filename);
+  start = Clock::now();
+  double sum2 = parseAfter(*reader);
+  t = seconds(start);
+  std::cout << "after:  " << mb/t << " MB/s, checksum " << sum2 << std::endl;
+
+  std::remove(filename.c_str());
+  // The weights are summed in a different order, so allow for rounding.
+  return std::abs(sum - sum2) <= 1.0e-12*std::abs(sum)? 0: 1;
+}
@@ -0,0 +1,394 @@
+// -*- C++ -*-
+//
+// lesHouchesTestCache.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_LesHouches_Test_Cache_H
+#define ThePEG_LesHouches_Test_Cache_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/LesHouches/LesHouchesEventCache.h"
+#include "ThePEG/LesHouches/LesHouchesFileReader.h"
+#include "ThePEG/Repository/BaseRepository.h"
+#include "ThePEG/Interface/InterfaceBase.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+using namespace ThePEG;
+
+namespace {
+
+/*
+ * One event as it is written to and read from the cache.
+ */
+struct CacheTestEvent {
+  HEPEUP hepeup;
+  double lastweight;
+  double preweight;
+  map<string,double> weights;
+  int npLO;
+  int npNLO;
+};
+
+/*
+ * A LesHouchesFileReader giving access to the start of the run phase
+ * and to the cache file.
+ */
+struct CacheTestFileReader: public LesHouchesFileReader {
+  void startRun() { doinitrun(); }
+  bool cached() const { return bool(cacheFile()); }
+  const HEPEUP & event() const { return hepeup; }
+};
+
+/*
+ * Fixture with a set of events, including events without particles
+ * and weights and events with an odd number of particles, so that
+ * the padding of the columns is exercised.
+ */
+struct FixLesHouchesCache {
+  FixLesHouchesCache()
+    : filename("lesHouchesTestCache.cache"),
+      corrupt("lesHouchesTestCacheCorrupt.cache") {
+    const int nups[] = { 0, 1, 4, 3, 7, 2 };
+    for ( int ie = 0; ie < 6; ++ie ) {
+      CacheTestEvent e;
+      HEPEUP & h = e.hepeup;
+      h.IDPRUP = 10 + ie;
+      h.XWGTUP = -1.5 + ie;
+      h.XPDWUP = make_pair(0.25*ie, -0.5*ie);
+      h.SCALUP = 91.188 + ie;
+      h.AQEDUP = 1.0/137.0;
+      h.AQCDUP = 0.118 - 0.001*ie;
+      h.resize(nups[ie]);
+      for ( int i = 0; i < h.NUP; ++i ) {
+	h.IDUP[i] = i%2? -5000000000L - i: 21;
+	h.ISTUP[i] = i < 2? -1: 1;
+	h.MOTHUP[i] = make_pair(i < 2? 0: 1, i < 2? 0: 2);
+	h.ICOLUP[i] = make_pair(501 + i, 502 + ie);
+	for ( int j = 0; j < 5; ++j ) h.PUP[i][j] = 1.0e-3*ie - 12.5*i + j;
+	h.VTIMUP[i] = 1.0e-12*i;
+	h.SPINUP[i] = i%3 - 1.0;
+      }
+      e.lastweight = 2.0*ie;
+      e.preweight = 1.0 - 0.125*ie;
+      for ( int iw = 0; iw < ie%4; ++iw ) {
+	ostringstream name;
+	name << "weight " << ( ie + iw )%5;
+	e.weights[name.str()] = 1.0 + 0.5*iw - ie;
+      }
+      e.npLO = ie%3 - 1;
+      e.npNLO = ie%2;
+      events.push_back(e);
+    }
+  }
+
+  ~FixLesHouchesCache() {
+    std::remove(filename.c_str());
+    std::remove(corrupt.c_str());
+  }
+
+  /*
+   * Write all events to the given file.
+   */
+  bool writeAll(string file) const {
+    LesHouchesEventCache cache;
+    if ( !cache.openWrite(file) ) return false;
+    for ( int ie = 0, N = events.size(); ie < N; ++ie ) {
+      const CacheTestEvent & e = events[ie];
+      if ( !cache.write(e.hepeup, e.lastweight, e.preweight, e.weights,
+			e.npLO, e.npNLO) ) return false;
+    }
+    return cache.close();
+  }
+
+  static void checkSame(const CacheTestEvent & a, const CacheTestEvent & b) {
+    const HEPEUP & ea = a.hepeup;
+    const HEPEUP & eb = b.hepeup;
+    BOOST_REQUIRE_EQUAL(ea.NUP, eb.NUP);
+    BOOST_CHECK_EQUAL(ea.IDPRUP, eb.IDPRUP);
+    BOOST_CHECK_EQUAL(ea.XWGTUP, eb.XWGTUP);
+    BOOST_CHECK_EQUAL(ea.XPDWUP.first, eb.XPDWUP.first);
+    BOOST_CHECK_EQUAL(ea.XPDWUP.second, eb.XPDWUP.second);
+    BOOST_CHECK_EQUAL(ea.SCALUP, eb.SCALUP);
+    BOOST_CHECK_EQUAL(ea.AQEDUP, eb.AQEDUP);
+    BOOST_CHECK_EQUAL(ea.AQCDUP, eb.AQCDUP);
+    for ( int i = 0; i < ea.NUP; ++i ) {
+      BOOST_CHECK_EQUAL(ea.IDUP[i], eb.IDUP[i]);
+      BOOST_CHECK_EQUAL(ea.ISTUP[i], eb.ISTUP[i]);
+      BOOST_CHECK_EQUAL(ea.MOTHUP[i].first, eb.MOTHUP[i].first);
+      BOOST_CHECK_EQUAL(ea.MOTHUP[i].second, eb.MOTHUP[i].second);
+      BOOST_CHECK_EQUAL(ea.ICOLUP[i].first, eb.ICOLUP[i].first);
+      BOOST_CHECK_EQUAL(ea.ICOLUP[i].second, eb.ICOLUP[i].second);
+      BOOST_REQUIRE_EQUAL(eb.PUP[i].size(), 5u);
+      for ( int j = 0; j < 5; ++j )
+	BOOST_CHECK_EQUAL(ea.PUP[i][j], eb.PUP[i][j]);
+      BOOST_CHECK_EQUAL(ea.VTIMUP[i], eb.VTIMUP[i]);
+      BOOST_CHECK_EQUAL(ea.SPINUP[i], eb.SPINUP[i]);
+    }
+    BOOST_CHECK_EQUAL(a.lastweight, b.lastweight);
+    BOOST_CHECK_EQUAL(a.preweight, b.preweight);
+    BOOST_CHECK(a.weights == b.weights);
+    BOOST_CHECK_EQUAL(a.npLO, b.npLO);
+    BOOST_CHECK_EQUAL(a.npNLO, b.npNLO);
+  }
+
+  /*
+   * Return the contents of the given file.
+   */
+  static string contents(string file) {
+    std::ifstream is(file.c_str(), std::ios::binary);
+    return string(std::istreambuf_iterator<char>(is),
+		  std::istreambuf_iterator<char>());
+  }
+
+  /*
+   * Write \a data to the corrupt file and try to read it as a cache.
+   */
+  bool readCorrupt(const string & data) const {
+    std::ofstream os(corrupt.c_str(), std::ios::binary);
+    os.write(data.data(), data.size());
+    os.close();
+    LesHouchesEventCache cache;
+    bool ok = cache.openRead(corrupt);
+    BOOST_CHECK_EQUAL(ok, cache.isOpen());
+    return ok;
+  }
+
+  /*
+   * Return a copy of \a data where the bytes at \a pos have been
+   * replaced by \a x.
+   */
+  template <typename T>
+  static string patch(string data, std::size_t pos, T x) {
+    std::memcpy(&data[pos], &x, sizeof(x));
+    return data;
+  }
+
+  /*
+   * Read the 64 bit integer at \a pos in \a data.
+   */
+  static std::uint64_t peek(const string & data, std::size_t pos) {
+    std::uint64_t x;
+    std::memcpy(&x, &data[pos], sizeof(x));
+    return x;
+  }
+
+  string filename;
+  string corrupt;
+  vector<CacheTestEvent> events;
+};
+
+}
+
+/*
+ * Start of boost unit tests for the LesHouchesEventCache.
+ */
+BOOST_FIXTURE_TEST_SUITE(lesHouchesCache, FixLesHouchesCache)
+
+BOOST_AUTO_TEST_CASE(cacheRoundTrip)
+{
+  BOOST_REQUIRE(writeAll(filename));
+  LesHouchesEventCache cache;
+  BOOST_REQUIRE(cache.openRead(filename));
+  BOOST_REQUIRE_EQUAL(cache.size(), events.size());
+  BOOST_CHECK_EQUAL(cache.weightNames().size(), 5u);
+
+  // Read the events in order and then in reverse order.
+  for ( int pass = 0; pass < 2; ++pass ) {
+    for ( int ie = 0, N = events.size(); ie < N; ++ie ) {
+      int i = pass? N - 1 - ie: ie;
+      CacheTestEvent e;
+      BOOST_REQUIRE(cache.read(i, e.hepeup, e.lastweight, e.preweight,
+			       e.weights, e.npLO, e.npNLO));
+      checkSame(events[i], e);
+    }
+  }
+  CacheTestEvent e;
+  BOOST_CHECK(!cache.read(events.size(), e.hepeup, e.lastweight, e.preweight,
+			  e.weights, e.npLO, e.npNLO));
+
+  // The views point directly into the file.
+  for ( int ie = 0, N = events.size(); ie < N; ++ie ) {
+    LesHouchesEventCache::EventView v = cache.event(ie);
+    const HEPEUP & h = events[ie].hepeup;
+    BOOST_REQUIRE_EQUAL(v.header->NUP, h.NUP);
+    BOOST_CHECK_EQUAL(v.header->XWGTUP, h.XWGTUP);
+    BOOST_CHECK_EQUAL(v.header->nWeights, int(events[ie].weights.size()));
+    for ( int i = 0; i < h.NUP; ++i ) {
+      BOOST_CHECK_EQUAL(v.IDUP[i], h.IDUP[i]);
+      BOOST_CHECK_EQUAL(v.PUP[5*i + 3], h.PUP[i][3]);
+      BOOST_CHECK_EQUAL(v.SPINUP[i], h.SPINUP[i]);
+    }
+  }
+
+  // next() reads the events in order, and rewind() starts again.
+  for ( int pass = 0; pass < 2; ++pass ) {
+    for ( int ie = 0, N = events.size(); ie < N; ++ie ) {
+      BOOST_REQUIRE(cache.next(e.hepeup, e.lastweight, e.preweight,
+			       e.weights, e.npLO, e.npNLO));
+      checkSame(events[ie], e);
+    }
+    BOOST_CHECK(!cache.next(e.hepeup, e.lastweight, e.preweight,
+			    e.weights, e.npLO, e.npNLO));
+    cache.rewind();
+  }
+  BOOST_CHECK(cache.close());
+  BOOST_CHECK(!cache.isOpen());
+}
+
+BOOST_AUTO_TEST_CASE(cacheEmpty)
+{
+  LesHouchesEventCache cache;
+  BOOST_REQUIRE(cache.openWrite(filename));
+  BOOST_REQUIRE(cache.close());
+  BOOST_REQUIRE(cache.openRead(filename));
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+  BOOST_CHECK(cache.weightNames().empty());
+  CacheTestEvent e;
+  BOOST_CHECK(!cache.next(e.hepeup, e.lastweight, e.preweight,
+			  e.weights, e.npLO, e.npNLO));
+}
+
+BOOST_AUTO_TEST_CASE(cacheMissing)
+{
+  LesHouchesEventCache cache;
+  BOOST_CHECK(!cache.openRead("lesHouchesTestCacheMissing.cache"));
+  BOOST_CHECK(!cache.openWrite("lesHouchesTestCacheMissing/x.cache"));
+  BOOST_CHECK(!cache.isOpen());
+}
+
+BOOST_AUTO_TEST_CASE(cacheCorrupt)
+{
+  BOOST_REQUIRE(writeAll(filename));
+  const string data = contents(filename);
+  BOOST_REQUIRE(!readCorrupt(string()));
+  BOOST_REQUIRE(readCorrupt(data));
+
+  const std::size_t size = data.size();
+  const std::size_t trailer = size - 32;
+  const std::uint64_t index = peek(data, trailer + 8);
+  const std::uint64_t names = peek(data, trailer + 16);
+
+  // Truncated files, also at a multiple of eight bytes, and a file
+  // with something appended.
+  BOOST_CHECK(!readCorrupt(data.substr(0, size - 1)));
+  BOOST_CHECK(!readCorrupt(data.substr(0, size - 8)));
+  BOOST_CHECK(!readCorrupt(data.substr(0, 48)));
+  BOOST_CHECK(!readCorrupt(data + string(8, '\0')));
+
+  // The header and the trailer.
+  BOOST_CHECK(!readCorrupt(patch(data, 0, 'X')));
+  BOOST_CHECK(!readCorrupt(patch(data, 8, std::uint32_t(2))));
+  BOOST_CHECK(!readCorrupt(patch(data, size - 1, 'X')));
+  BOOST_CHECK(!readCorrupt(patch(data, trailer, std::uint64_t(7))));
+  BOOST_CHECK(!readCorrupt(patch(data, trailer, std::uint64_t(5))));
+  BOOST_CHECK(!readCorrupt(patch(data, trailer, ~std::uint64_t(0))));
+  BOOST_CHECK(!readCorrupt(patch(data, trailer + 8, index + 8)));
+  BOOST_CHECK(!readCorrupt(patch(data, trailer + 8, index - 8)));
+  BOOST_CHECK(!readCorrupt(patch(data, trailer + 8, ~std::uint64_t(7))));
+  BOOST_CHECK(!readCorrupt(patch(data, trailer + 16, names + 8)));
+  BOOST_CHECK(!readCorrupt(patch(data, trailer + 16, std::uint64_t(8))));
+  BOOST_CHECK(!readCorrupt(patch(data, trailer + 16, index + 8)));
+
+  // The names of the weights.
+  BOOST_CHECK(!readCorrupt(patch(data, names, std::uint64_t(6))));
+  BOOST_CHECK(!readCorrupt(patch(data, names, ~std::uint64_t(0))));
+  BOOST_CHECK(!readCorrupt(patch(data, names + 8, std::uint64_t(100))));
+  BOOST_CHECK(!readCorrupt(patch(data, names + 8, ~std::uint64_t(0))));
+
+  // The index of the events.
+  const std::uint64_t first = peek(data, index);
+  const std::uint64_t last = peek(data, index + 8*(events.size() - 1));
+  BOOST_CHECK(!readCorrupt(patch(data, index, first + 8)));
+  BOOST_CHECK(!readCorrupt(patch(data, index, first - 8)));
+  BOOST_CHECK(!readCorrupt(patch(data, index, first + 4)));
+  BOOST_CHECK(!readCorrupt(patch(data, index + 8, first)));
+  BOOST_CHECK(!readCorrupt(patch(data, index + 8*(events.size() - 1),
+				 names)));
+  BOOST_CHECK(!readCorrupt(patch(data, index + 8*(events.size() - 1),
+				 ~std::uint64_t(7))));
+
+  // The number of particles and weights in the last event, and the
+  // indices of its weights.
+  BOOST_CHECK(!readCorrupt(patch(data, last, std::int32_t(-1))));
+  BOOST_CHECK(!readCorrupt(patch(data, last, std::int32_t(3))));
+  BOOST_CHECK(!readCorrupt(patch(data, last, std::int32_t(0x7fffffff))));
+  BOOST_CHECK(!readCorrupt(patch(data, last + 8, std::int32_t(-1))));
+  BOOST_CHECK(!readCorrupt(patch(data, last + 8, std::int32_t(100))));
+  BOOST_REQUIRE_EQUAL(events.back().weights.size(), 1u);
+  const std::size_t windex = names - 16;
+  BOOST_REQUIRE_EQUAL(peek(data, windex) & 0xffffffff, 3u);
+  BOOST_CHECK(!readCorrupt(patch(data, windex, std::int32_t(5))));
+  BOOST_CHECK(!readCorrupt(patch(data, windex, std::int32_t(-1))));
+  BOOST_CHECK(readCorrupt(patch(data, windex, std::int32_t(2))));
+}
+
+BOOST_AUTO_TEST_CASE(cacheWriteError)
+{
+  // Writing to a full device fails when the buffer is flushed, at
+  // the latest when the file is closed.
+  LesHouchesEventCache cache;
+  if ( !cache.openWrite("/dev/full") ) return;
+  bool ok = true;
+  for ( int i = 0; i < 10000 && ok; ++i ) {
+    const CacheTestEvent & e = events[i%events.size()];
+    ok = cache.write(e.hepeup, e.lastweight, e.preweight, e.weights,
+		     e.npLO, e.npNLO);
+  }
+  BOOST_CHECK(!ok);
+  BOOST_CHECK(!cache.close());
+  BOOST_CHECK(!cache.isOpen());
+  BOOST_REQUIRE(cache.openWrite("/dev/full"));
+  BOOST_CHECK(!cache.close());
+}
+
+BOOST_AUTO_TEST_CASE(cacheFallback)
+{
+  // A reader with a broken cache file reads the events from the
+  // event file instead.
+  string lhefile = "lesHouchesTestCache.lhe";
+  {
+    std::ofstream os(lhefile.c_str());
+    os << "<LesHouchesEvents version=\"3.0\">\n"
+       << "<init>\n"
+       << "2212 2212 6.5e+03 6.5e+03 0 0 247000 247000 -4 1\n"
+       << "1.0e+01 1.0e-01 1.0e+01 1\n"
+       << "</init>\n";
+    for ( int ie = 0; ie < 3; ++ie )
+      os << "<event>\n"
+	 << " 2 1 +" << 1.0 + ie << " 91.188 7.54e-03 1.18e-01\n"
+	 << "  2 -1 0 0 501 0 0 0 +100 100 0 0 9\n"
+	 << " -2 -1 0 0 0 501 0 0 -50 50 0 0 9\n"
+	 << "</event>\n";
+    os << "</LesHouchesEvents>\n";
+  }
+  BOOST_REQUIRE(writeAll(filename));
+  string data = contents(filename);
+  BOOST_REQUIRE(!readCorrupt(data.substr(0, data.size() - 8)));
+
+  RCPtr<CacheTestFileReader> r = new_ptr(CacheTestFileReader());
+  IBPtr proto = new_ptr(LesHouchesFileReader());
+  BaseRepository::FindInterface(proto, "FileName")->exec(*r, "set", lhefile);
+  BaseRepository::FindInterface(proto, "CacheFileName")
+    ->exec(*r, "set", corrupt);
+  r->startRun();
+  BOOST_CHECK(!r->cached());
+  for ( int ie = 0; ie < 3; ++ie ) {
+    BOOST_REQUIRE(r->doReadEvent());
+    BOOST_CHECK_EQUAL(r->event().NUP, 2);
+    BOOST_CHECK_EQUAL(r->event().XWGTUP, 1.0 + ie);
+  }
+  BOOST_CHECK(!r->doReadEvent());
+  r->close();
+  std::remove(lhefile.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* ThePEG_LesHouches_Test_Cache_H */
@@ -0,0 +1,183 @@
+// -*- C++ -*-
+//
+// lesHouchesTestPrefetch.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_LesHouches_Test_Prefetch_H
+#define ThePEG_LesHouches_Test_Prefetch_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/LesHouches/LesHouchesFileReader.h"
+#include "ThePEG/Repository/BaseRepository.h"
+#include "ThePEG/Interface/InterfaceBase.h"
+#include <cstdio>
+#include <fstream>
+
+using namespace ThePEG;
+
+/*
+ * A LesHouchesFileReader giving access to the event read and to the
+ * start of the run phase, when the prefetch thread may be used.
+ */
+struct TestFileReader: public LesHouchesFileReader {
+  void startRun() { doinitrun(); }
+  const HEPEUP & event() const { return hepeup; }
+};
+
+/*
+ * Fixture writing a small event file where the third event has a
+ * particle which is its own mother, which makes the reader throw.
+ */
+struct FixLesHouchesFile {
+  FixLesHouchesFile() : filename("lesHouchesTestPrefetch.lhe") {
+    std::ofstream os(filename.c_str());
+    os << "<LesHouchesEvents version=\"3.0\">\n"
+       << "<init>\n"
+       << "2212 2212 6.5e+03 6.5e+03 0 0 247000 247000 -4 1\n"
+       << "1.0e+01 1.0e-01 1.0e+01 1\n"
+       << "</init>\n";
+    for ( int ie = 0; ie < 7; ++ie ) {
+      os << "<event>\n"
+	 << " 4 1 +" << 1.0 + 0.125*ie << " 91.188 7.54e-03 1.18e-01\n"
+	 << "  2 -1 0 0 501 0 0 0 +" << 100.0 + ie << " " << 100.0 + ie
+	 << " 0 0 9\n"
+	 << " -2 -1 0 0 0 501 0 0 -" << 50.0 + ie << " " << 50.0 + ie
+	 << " 0 0 9\n"
+	 << " 11 1 " << ( ie == 2? 3: 1 ) << " 2 0 0 " << 10.0 + ie
+	 << " 5.0 " << 25.0 + ie << " 30.0 0 0 9\n"
+	 << "-11 1 1 2 0 0 -" << 10.0 + ie << " -5.0 " << 25.0
+	 << " 120.0 0 0 9\n"
+	 << "<rwgt>\n"
+	 << "<wgt id='1001'> " << 1.5 + ie << " </wgt>\n"
+	 << "<wgt id='1002'> " << -0.5*ie << " </wgt>\n"
+	 << "</rwgt>\n"
+	 << "</event>\n";
+    }
+    os << "</LesHouchesEvents>\n";
+  }
+
+  ~FixLesHouchesFile() { std::remove(filename.c_str()); }
+
+  /*
+   * Create a reader for the file with the given Prefetch parameter.
+   */
+  RCPtr<TestFileReader> reader(string prefetch) const {
+    RCPtr<TestFileReader> r = new_ptr(TestFileReader());
+    IBPtr proto = new_ptr(LesHouchesFileReader());
+    BaseRepository::FindInterface(proto, "FileName")->exec(*r, "set", filename);
+    BaseRepository::FindInterface(proto, "Prefetch")->exec(*r, "set", prefetch);
+    return r;
+  }
+
+  /*
+   * The result of reading one event: 0 if there was no event, 1 if
+   * the event was read and 2 if an exception was thrown.
+   */
+  static int read(TestFileReader & r) {
+    try {
+      return r.doReadEvent()? 1: 0;
+    }
+    catch ( Exception & e ) {
+      e.handle();
+      return 2;
+    }
+  }
+
+  static void checkSame(const TestFileReader & a, const TestFileReader & b) {
+    const HEPEUP & ea = a.event();
+    const HEPEUP & eb = b.event();
+    BOOST_REQUIRE_EQUAL(ea.NUP, eb.NUP);
+    BOOST_CHECK_EQUAL(ea.IDPRUP, eb.IDPRUP);
+    BOOST_CHECK_EQUAL(ea.XWGTUP, eb.XWGTUP);
+    BOOST_CHECK_EQUAL(ea.SCALUP, eb.SCALUP);
+    BOOST_CHECK_EQUAL(ea.AQEDUP, eb.AQEDUP);
+    BOOST_CHECK_EQUAL(ea.AQCDUP, eb.AQCDUP);
+    for ( int i = 0; i < ea.NUP; ++i ) {
+      BOOST_CHECK_EQUAL(ea.IDUP[i], eb.IDUP[i]);
+      BOOST_CHECK_EQUAL(ea.ISTUP[i], eb.ISTUP[i]);
+      BOOST_CHECK_EQUAL(ea.MOTHUP[i].first, eb.MOTHUP[i].first);
+      BOOST_CHECK_EQUAL(ea.MOTHUP[i].second, eb.MOTHUP[i].second);
+      BOOST_CHECK_EQUAL(ea.ICOLUP[i].first, eb.ICOLUP[i].first);
+      BOOST_CHECK_EQUAL(ea.ICOLUP[i].second, eb.ICOLUP[i].second);
+      for ( int j = 0; j < 5; ++j )
+	BOOST_CHECK_EQUAL(ea.PUP[i][j], eb.PUP[i][j]);
+      BOOST_CHECK_EQUAL(ea.VTIMUP[i], eb.VTIMUP[i]);
+      BOOST_CHECK_EQUAL(ea.SPINUP[i], eb.SPINUP[i]);
+    }
+    BOOST_CHECK(a.optionalEventWeights() == b.optionalEventWeights());
+  }
+
+  string filename;
+};
+
+/*
+ * Start of boost unit tests for the prefetching in LesHouchesFileReader.
+ */
+BOOST_FIXTURE_TEST_SUITE(lesHouchesPrefetch, FixLesHouchesFile)
+
+BOOST_AUTO_TEST_CASE(sameEventsWithAndWithoutPrefetch)
+{
+  for ( string prefetch : { "1", "3", "16" } ) {
+    RCPtr<TestFileReader> plain = reader("0");
+    RCPtr<TestFileReader> ahead = reader(prefetch);
+    plain->startRun();
+    ahead->startRun();
+    int nevents = 0;
+    int nerrors = 0;
+    while ( true ) {
+      int rp = read(*plain);
+      int ra = read(*ahead);
+      BOOST_REQUIRE_EQUAL(rp, ra);
+      if ( rp == 0 ) break;
+      if ( rp == 2 ) {
+	++nerrors;
+	continue;
+      }
+      ++nevents;
+      checkSame(*plain, *ahead);
+    }
+    BOOST_CHECK_EQUAL(nevents, 6);
+    BOOST_CHECK_EQUAL(nerrors, 1);
+
+    // Reading past the end of the file gives no more events.
+    BOOST_CHECK_EQUAL(read(*plain), 0);
+    BOOST_CHECK_EQUAL(read(*ahead), 0);
+
+    // Reopening starts from the first event again.
+    plain->open();
+    ahead->open();
+    BOOST_REQUIRE_EQUAL(read(*plain), 1);
+    BOOST_REQUIRE_EQUAL(read(*ahead), 1);
+    checkSame(*plain, *ahead);
+    BOOST_CHECK_EQUAL(ahead->event().XWGTUP, 1.0);
+    plain->close();
+    ahead->close();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(noPrefetchBeforeRun)
+{
+  // Outside the run phase, events are read in the calling thread, so
+  // that the file can be closed and reopened at any point.
+  RCPtr<TestFileReader> plain = reader("0");
+  RCPtr<TestFileReader> ahead = reader("4");
+  plain->open();
+  ahead->open();
+  BOOST_REQUIRE_EQUAL(read(*plain), 1);
+  BOOST_REQUIRE_EQUAL(read(*ahead), 1);
+  checkSame(*plain, *ahead);
+  BOOST_REQUIRE_EQUAL(read(*plain), 1);
+  BOOST_REQUIRE_EQUAL(read(*ahead), 1);
+  checkSame(*plain, *ahead);
+  BOOST_CHECK_EQUAL(ahead->event().XWGTUP, 1.125);
+  ahead->close();
+  plain->close();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* ThePEG_LesHouches_Test_Prefetch_H */
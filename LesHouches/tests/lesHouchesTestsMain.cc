@@ -0,0 +1,22 @@
+// -*- C++ -*-
+//
+// lesHouchesTestsMain.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+
+/**
+ * The following part should be included only once. 
+*/
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+#define BOOST_TEST_MODULE lesHouchesTest
+
+/**
+ * Include here the sub tests
+ */
+#include "ThePEG/LesHouches/tests/lesHouchesTestPrefetch.h"
+#include "ThePEG/LesHouches/tests/lesHouchesTestCache.h"
@@ -15,7 +15,10 @@
 #include "ThePEG/PDT/ParticleData.h"
 #include "ThePEG/Repository/EventGenerator.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Interface/Parameter.h"
 #include "ThePEG/Repository/UseRandom.h"
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
 
 using namespace ThePEG;
 
@@ -27,7 +30,20 @@ IBPtr BreitWignerMass::fullclone() const {
   return new_ptr(*this);
 }
 
+const BreitWignerMass::MassTable *
+BreitWignerMass::table(const ParticleData & pd) const {
+  if ( theTables.empty() ) return 0;
+  auto it = theTables.find(&pd);
+  if ( it == theTables.end() ) return 0;
+  const MassTable & t = it->second;
+  if ( t.mass != pd.mass() || t.width != pd.width() ||
+       t.lo != max(pd.massMin(), max(pd.mass() - pd.widthCut(), ZERO)) ||
+       t.hi != min(pd.massMax(), pd.mass() + pd.widthCut()) ) return 0;
+  return &t;
+}
+
 Energy BreitWignerMass::mass(const ParticleData & pd) const {
+  if ( const MassTable * t = table(pd) ) return mass(*t, UseRandom::rnd());
   Energy ret = ZERO;
   do {
     ret = UseRandom::rndRelBW(pd.mass(), pd.width(), pd.widthCut());
@@ -35,7 +51,68 @@ Energy BreitWignerMass::mass(const ParticleData & pd) const {
   return ret;
 }
 
-NoPIOClassDescription<BreitWignerMass> BreitWignerMass::initBreitWignerMass;
+void BreitWignerMass::masses(const ParticleData & pd, Energy * m,
+			     std::size_t n) const {
+  const MassTable * t = table(pd);
+  if ( !t ) {
+    MassGenerator::masses(pd, m, n);
+    return;
+  }
+  for ( std::size_t i = 0; i < n; ++i ) m[i] = mass(*t, UseRandom::rnd());
+}
+
+void BreitWignerMass::doinitrun() {
+  MassGenerator::doinitrun();
+  theTables.clear();
+  if ( theTableSize <= 0 ) return;
+  for ( const auto & p : generator()->particles() )
+    if ( p.second->massGenerator() == this ) tabulate(*p.second);
+}
+
+void BreitWignerMass::tabulate(const ParticleData & pd) {
+  theTables.erase(&pd);
+  if ( theTableSize <= 0 ) return;
+  Energy m0 = pd.mass();
+  Energy w = pd.width();
+  Energy cut = pd.widthCut();
+  if ( m0 <= ZERO || w <= ZERO || cut <= ZERO ) return;
+  MassTable t;
+  t.mass = m0;
+  t.width = w;
+  t.lo = max(pd.massMin(), max(m0 - cut, ZERO));
+  t.hi = min(pd.massMax(), m0 + cut);
+  if ( t.lo >= t.hi ) return;
+  // Nodes equidistant in the integrated Breit-Wigner, which is
+  // proportional to atan((m^2 - m0^2)/(m0 w)).
+  double amin = atan((sqr(t.lo) - sqr(m0))/(m0*w));
+  double amax = atan((sqr(t.hi) - sqr(m0))/(m0*w));
+  t.nodes.resize(theTableSize + 1);
+  for ( int i = 0; i <= theTableSize; ++i ) {
+    double a = amin + (amax - amin)*double(i)/double(theTableSize);
+    Energy2 m2 = sqr(m0) + m0*w*tan(a);
+    t.nodes[i] = m2 > ZERO? sqrt(m2): ZERO;
+  }
+  t.nodes.front() = t.lo;
+  t.nodes.back() = t.hi;
+  theTables[&pd] = t;
+}
+
+bool BreitWignerMass::tabulated(const ParticleData & pd) const {
+  return table(pd) != 0;
+}
+
+void BreitWignerMass::persistentOutput(PersistentOStream & os) const {
+  os << theTableSize;
+}
+
+void BreitWignerMass::persistentInput(PersistentIStream & is, int version) {
+  // Objects written before the TableSize parameter was introduced
+  // have no persistent data.
+  if ( version > 0 ) is >> theTableSize;
+  else theTableSize = 0;
+}
+
+ClassDescription<BreitWignerMass> BreitWignerMass::initBreitWignerMass;
 
 void BreitWignerMass::Init() {
 
@@ -43,5 +120,16 @@ void BreitWignerMass::Init() {
     ("Generates masses of particle instances according to a Breit-Wigner "
      "distribution.");
 
+  static Parameter<BreitWignerMass,int> interfaceTableSize
+    ("TableSize",
+     "The number of intervals used to tabulate the inverse of the "
+     "cumulative mass distribution of each particle using this object "
+     "when a run is initialized. Masses are then generated by linear "
+     "interpolation in the table, which is faster but only approximates "
+     "the Breit-Wigner shape. If zero, no tables are used and masses are "
+     "generated exactly.",
+     &BreitWignerMass::theTableSize, 0, 0, 0,
+     true, false, Interface::lowerlim);
+
 }
 
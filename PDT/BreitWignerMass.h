@@ -11,6 +11,7 @@
 // This is the declaration of the BreitWignerMass class.
 
 #include "ThePEG/PDT/MassGenerator.h"
+#include <unordered_map>
 
 namespace ThePEG {
 
@@ -19,7 +20,17 @@ namespace ThePEG {
  * generate the mass for a particle given its nominal mass and its
  * with.
  *
+ * If the TableSize parameter is non-zero, the inverse of the
+ * cumulative distribution of the truncated Breit-Wigner is tabulated
+ * at the given number of points for each particle using this object,
+ * when the run is initialized. Masses are then generated by linear
+ * interpolation in the table using a single random number, rather
+ * than evaluating transcendental functions in a rejection loop. If
+ * the mass, width or mass limits of a particle are changed after the
+ * initialization, the table is not used for that particle.
  *
+ * @see \ref BreitWignerMassInterfaces "The interfaces"
+ * defined for BreitWignerMass.
  * @see MassGenerator
  * @see ParticleData
  * 
@@ -40,10 +51,40 @@ public:
    * Generate a mass for an instance of a given particle type.
    */
   virtual Energy mass(const ParticleData &) const;
+
+  /**
+   * Generate masses for \a n instances of a given particle type and
+   * store them in \a m.
+   */
+  virtual void masses(const ParticleData & pd, Energy * m,
+		      std::size_t n) const;
   //@}
 
 public:
 
+  /**
+   * The default constructor.
+   */
+  BreitWignerMass() : theTableSize(0) {}
+
+public:
+
+  /** @name Functions used by the persistent I/O system. */
+  //@{
+  /**
+   * Function used to write out object persistently.
+   * @param os the persistent output stream written to.
+   */
+  void persistentOutput(PersistentOStream & os) const;
+
+  /**
+   * Function used to read in object persistently.
+   * @param is the persistent input stream read from.
+   * @param version the version number of the object when written.
+   */
+  void persistentInput(PersistentIStream & is, int version);
+  //@}
+
   /**
    * Standard Init function used to initialize the interface.
    */
@@ -66,12 +107,84 @@ protected:
   virtual IBPtr fullclone() const;
   //@}
 
+protected:
+
+  /** @name Standard Interfaced functions. */
+  //@{
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins.
+   */
+  virtual void doinitrun();
+  //@}
+
+  /**
+   * Tabulate the mass distribution of the given particle type, if
+   * TableSize is non-zero and the particle has a width. Called from
+   * doinitrun() for each particle type using this object.
+   */
+  void tabulate(const ParticleData & pd);
+
+  /**
+   * Return true if masses of the given particle type are generated
+   * from a table.
+   */
+  bool tabulated(const ParticleData & pd) const;
+
+private:
+
+  /**
+   * The tabulated inverse cumulative mass distribution for one
+   * particle type, together with the parameters used to build it.
+   */
+  struct MassTable {
+    /** The nominal mass. */
+    Energy mass;
+    /** The width. */
+    Energy width;
+    /** The lower mass limit. */
+    Energy lo;
+    /** The upper mass limit. */
+    Energy hi;
+    /** The masses at equidistant values of the cumulative
+	distribution. */
+    vector<Energy> nodes;
+  };
+
+  /**
+   * Return the table for the given particle type, or null if there is
+   * none or if it is out of date.
+   */
+  const MassTable * table(const ParticleData & pd) const;
+
+  /**
+   * Generate a mass from the table \a t given a flat random number
+   * \a r.
+   */
+  static Energy mass(const MassTable & t, double r) {
+    double x = r*double(t.nodes.size() - 1);
+    std::size_t i = std::min(std::size_t(x), t.nodes.size() - 2);
+    double f = x - double(i);
+    return t.nodes[i] + f*(t.nodes[i + 1] - t.nodes[i]);
+  }
+
+  /**
+   * The number of intervals in the tabulated mass distributions. If
+   * zero, no tables are used.
+   */
+  int theTableSize;
+
+  /**
+   * The tables indexed by the particle types using this object.
+   */
+  std::unordered_map<const ParticleData *, MassTable> theTables;
+
 private:
 
   /**
-   * Describe concrete class without persistent data.
+   * Describe concrete class with persistent data.
    */
-  static NoPIOClassDescription<BreitWignerMass> initBreitWignerMass;
+  static ClassDescription<BreitWignerMass> initBreitWignerMass;
 
   /**
    *  Private and non-existent assignment operator.
@@ -82,7 +195,34 @@ private:
 
 
 /** @cond TRAITSPECIALIZATIONS */
-ThePEG_DECLARE_DYNAMIC_CLASS_TRAITS(BreitWignerMass,MassGenerator,"BreitWignerMass.so");
+
+/** This template specialization informs ThePEG about the
+ *  base classes of BreitWignerMass. */
+template <>
+struct BaseClassTrait<BreitWignerMass,1>: public ClassTraitsType {
+  /** Typedef of the first base class of BreitWignerMass. */
+  typedef MassGenerator NthBase;
+};
+
+/** This template specialization informs ThePEG about the name of
+ *  the BreitWignerMass class, the shared object where it is defined
+ *  and its version. */
+template <>
+struct ClassTraits<BreitWignerMass>
+  : public ClassTraitsBase<BreitWignerMass> {
+  /** Return a platform-independent class name */
+  static string className() { return "ThePEG::BreitWignerMass"; }
+  /** Return the name of the shared library be loaded to get access to
+   *  the BreitWignerMass class and every other class it uses (except
+   *  the base class). */
+  static string library() { return "BreitWignerMass.so"; }
+  /**
+   * Return the version of the BreitWignerMass class. Version 0 had no
+   * persistent data.
+   */
+  static int version() { return 1; }
+};
+
 /** @endcond */
 
 }
@@ -18,6 +18,9 @@
 #include "ThePEG/EventRecord/Particle.h"
 #include "ThePEG/Vectors/LorentzRotation.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Interface/Switch.h"
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
 
 using namespace ThePEG;
 
@@ -48,6 +51,9 @@ ParticleVector FlatDecayer::decay(const DecayMode & dm,
 	children[0]->scale(parent.momentum().mass2());
 	return children;
       }
+      else if ( useRAMBO ) {
+	SimplePhaseSpace::CMSnRAMBO(children, parent.mass());
+      }
       else {
 	SimplePhaseSpace::CMSn(children, parent.mass());
       }
@@ -64,7 +70,15 @@ ParticleVector FlatDecayer::decay(const DecayMode & dm,
   return children;
 }
 
-NoPIOClassDescription<FlatDecayer> FlatDecayer::initFlatDecayer;
+void FlatDecayer::persistentOutput(PersistentOStream & os) const {
+  os << useRAMBO;
+}
+
+void FlatDecayer::persistentInput(PersistentIStream & is, int) {
+  is >> useRAMBO;
+}
+
+ClassDescription<FlatDecayer> FlatDecayer::initFlatDecayer;
 // Definition of the static class description member.
 
 void FlatDecayer::Init() {
@@ -74,5 +88,24 @@ void FlatDecayer::Init() {
      "ThePEG::Particle into a set of specified children according "
      "to a flat distribution in phase space.");
 
+  static Switch<FlatDecayer,bool> interfaceRAMBO
+    ("RAMBO",
+     "Whether the momenta of the decay products should be generated with "
+     "the RAMBO algorithm rather than with the standard method. RAMBO is "
+     "efficient when the masses of the products are small compared to the "
+     "mass of the decaying particle, but becomes very inefficient close to "
+     "threshold.",
+     &FlatDecayer::useRAMBO, false, true, false);
+  static SwitchOption interfaceRAMBOYes
+    (interfaceRAMBO,
+     "Yes",
+     "Use the RAMBO algorithm.",
+     true);
+  static SwitchOption interfaceRAMBONo
+    (interfaceRAMBO,
+     "No",
+     "Use the standard method.",
+     false);
+
 }
 
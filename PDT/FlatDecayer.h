@@ -32,6 +32,13 @@ namespace ThePEG {
  */
 class FlatDecayer: public Decayer {
 
+public:
+
+  /**
+   * The default constructor.
+   */
+  FlatDecayer() : useRAMBO(false) {}
+
 public:
 
   /** @name Virtual functions required by the Decayer class.
@@ -72,6 +79,22 @@ public:
 
 public:
 
+  /** @name Functions used by the persistent I/O system. */
+  //@{
+  /**
+   * Function used to write out object persistently.
+   * @param os the persistent output stream written to.
+   */
+  void persistentOutput(PersistentOStream & os) const;
+
+  /**
+   * Function used to read in object persistently.
+   * @param is the persistent input stream read from.
+   * @param version the version number of the object when written.
+   */
+  void persistentInput(PersistentIStream & is, int version);
+  //@}
+
   /**
    * Standard Init function used to initialize the interfaces.
    */
@@ -97,9 +120,17 @@ protected:
 private:
 
   /**
-   * Describe a concrete class without persistent data.
+   * If true, use SimplePhaseSpace::CMSnRAMBO rather than
+   * SimplePhaseSpace::CMSn to generate the momenta of the children.
+   */
+  bool useRAMBO;
+
+private:
+
+  /**
+   * Describe a concrete class with persistent data.
    */
-  static NoPIOClassDescription<FlatDecayer> initFlatDecayer;
+  static ClassDescription<FlatDecayer> initFlatDecayer;
 
   /**
    *  Private and non-existent assignment operator.
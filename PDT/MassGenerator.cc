@@ -16,6 +16,11 @@
 
 using namespace ThePEG;
 
+void MassGenerator::masses(const ParticleData & pd, Energy * m,
+			   std::size_t n) const {
+  for ( std::size_t i = 0; i < n; ++i ) m[i] = mass(pd);
+}
+
 AbstractNoPIOClassDescription<MassGenerator> MassGenerator::initMassGenerator;
 
 void MassGenerator::Init() {
@@ -40,6 +40,14 @@ public:
    * Generate a mass for an instance of a given particle type.
    */
   virtual Energy mass(const ParticleData &) const = 0;
+
+  /**
+   * Generate masses for \a n instances of a given particle type and
+   * store them in \a m. The default version calls mass() \a n
+   * times.
+   */
+  virtual void masses(const ParticleData & pd, Energy * m,
+		      std::size_t n) const;
   //@}
 
 public:
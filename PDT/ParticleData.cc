@@ -268,7 +268,11 @@ void ParticleData::doupdate() {
   if ( theWidthGenerator &&
        !theWidthGenerator->accept(*this) )
     throw UpdateException();
-  if ( theWidthGenerator ) theDecaySelector = theWidthGenerator->rate(*this);
+  if ( theWidthGenerator ) {
+    bool frozen = theDecaySelector.frozen();
+    theDecaySelector = theWidthGenerator->rate(*this);
+    if ( frozen ) theDecaySelector.freeze();
+  }
   touch();
 }
 
@@ -299,6 +303,9 @@ void ParticleData::rebind(const TranslationMap & trans) {
 	it != theDecayModes.end(); ++it ) {
     DMPtr dm;
     dm = trans.translate(*it);
+    // Decay modes which are switched off may have been left out on
+    // purpose (see EventGenerator::pruneDecayModes()).
+    if ( !dm && !(**it).on() ) continue;
     if ( !dm ) throw RebindException();
     newModes.insert(dm);
     newSelector.insert(dm->brat(), dm);
@@ -334,6 +341,11 @@ Energy ParticleData::generateMass() const {
   return massGenerator()? massGenerator()->mass(*this): mass();
 }
 
+void ParticleData::generateMasses(Energy * m, std::size_t n) const {
+  if ( massGenerator() ) massGenerator()->masses(*this, m, n);
+  else std::fill(m, m + n, mass());
+}
+
 Energy ParticleData::generateWidth(Energy m) const {
   return widthGenerator()? widthGenerator()->width(*this, m): width();
 }
@@ -1033,6 +1045,7 @@ void ParticleData::doinitrun() {
   Interfaced::doinitrun();
   if( theMassGenerator )  theMassGenerator->initrun();
   if( theWidthGenerator ) theWidthGenerator->initrun();
+  if ( generator()->fastDecaySelection() ) theDecaySelector.freeze();
 }
 
 }
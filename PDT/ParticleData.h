@@ -138,6 +138,12 @@ public:
    */
   Energy generateMass() const;
 
+  /**
+   * Generate masses for \a n instances of this particle type and
+   * store them in \a m.
+   */
+  void generateMasses(Energy * m, std::size_t n) const;
+
   /**
    * Generate a width for an instance of this particle type. Given a
    * \a mass of an instance of this particle type, calculate its width.
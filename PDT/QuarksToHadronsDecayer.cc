@@ -15,6 +15,7 @@
 #include "ThePEG/Interface/ClassDocumentation.h"
 #include "ThePEG/Interface/Parameter.h"
 #include "ThePEG/Interface/Reference.h"
+#include "ThePEG/Interface/Switch.h"
 #include "ThePEG/PDT/DecayMode.h"
 #include "ThePEG/PDT/StandardMatchers.h"
 #include "ThePEG/Repository/EventGenerator.h"
@@ -148,7 +149,8 @@ void QuarksToHadronsDecayer::
 distribute(const Particle & parent, PVector & children) const {
   do {
     try {
-      SimplePhaseSpace::CMSn(children, parent.mass());
+      if ( useRAMBO ) SimplePhaseSpace::CMSnRAMBO(children, parent.mass());
+      else SimplePhaseSpace::CMSn(children, parent.mass());
     }
     catch ( ImpossibleKinematics ) {
       children.clear();
@@ -163,11 +165,13 @@ reweight(const Particle &, const PVector &) const {
 }
 
 void QuarksToHadronsDecayer::persistentOutput(PersistentOStream & os) const {
-  os << theFixedN << theMinN << theC1 << ounit(theC2,GeV) << theC3 << theFlavourGenerator;
+  os << theFixedN << theMinN << theC1 << ounit(theC2,GeV) << theC3 << theFlavourGenerator
+     << useRAMBO;
 }
 
 void QuarksToHadronsDecayer::persistentInput(PersistentIStream & is, int) {
-  is >> theFixedN >> theMinN >> theC1 >> iunit(theC2,GeV) >> theC3 >> theFlavourGenerator;
+  is >> theFixedN >> theMinN >> theC1 >> iunit(theC2,GeV) >> theC3 >> theFlavourGenerator
+     >> useRAMBO;
 }
 
 ClassDescription<QuarksToHadronsDecayer> QuarksToHadronsDecayer::initQuarksToHadronsDecayer;
@@ -226,6 +230,25 @@ void QuarksToHadronsDecayer::Init() {
      &QuarksToHadronsDecayer::theFlavourGenerator,
      true, false, true, false, true);
 
+  static Switch<QuarksToHadronsDecayer,bool> interfaceRAMBO
+    ("RAMBO",
+     "Whether the momenta of the decay products should be generated with "
+     "the RAMBO algorithm rather than with the standard method. RAMBO is "
+     "efficient when the masses of the products are small compared to the "
+     "mass of the decaying particle, but becomes very inefficient close to "
+     "threshold.",
+     &QuarksToHadronsDecayer::useRAMBO, false, true, false);
+  static SwitchOption interfaceRAMBOYes
+    (interfaceRAMBO,
+     "Yes",
+     "Use the RAMBO algorithm.",
+     true);
+  static SwitchOption interfaceRAMBONo
+    (interfaceRAMBO,
+     "No",
+     "Use the standard method.",
+     false);
+
   interfaceFixedN.rank(10);
   interfaceMinN.rank(9);
   interfaceFlavourGenerator.rank(8);
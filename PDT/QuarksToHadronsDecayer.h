@@ -42,7 +42,8 @@ public:
    * Default constructor.
    */
   QuarksToHadronsDecayer()
-    : theFixedN(0), theMinN(2), theC1(4.5), theC2(0.7*GeV), theC3(0.0) {}
+    : theFixedN(0), theMinN(2), theC1(4.5), theC2(0.7*GeV), theC3(0.0),
+      useRAMBO(false) {}
 
   /**
    * Destructor.
@@ -214,6 +215,12 @@ private:
    */
   FlavGenPtr theFlavourGenerator;
 
+  /**
+   * If true, use SimplePhaseSpace::CMSnRAMBO rather than
+   * SimplePhaseSpace::CMSn to generate the momenta of the hadrons.
+   */
+  bool useRAMBO;
+
 private:
 
   /**
@@ -0,0 +1,207 @@
+// -*- C++ -*-
+//
+// pdtTestBreitWignerMass.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_PDT_Test_BreitWignerMass_H
+#define ThePEG_PDT_Test_BreitWignerMass_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/PDT/BreitWignerMass.h"
+#include "ThePEG/PDT/ParticleData.h"
+#include "ThePEG/Repository/BaseRepository.h"
+#include "ThePEG/Repository/StandardRandom.h"
+#include "ThePEG/Repository/UseRandom.h"
+#include "ThePEG/Interface/InterfaceBase.h"
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+using namespace ThePEG;
+
+namespace {
+
+/*
+ * A BreitWignerMass giving access to the tabulation.
+ */
+struct TestBreitWignerMass: public BreitWignerMass {
+  using BreitWignerMass::tabulate;
+  using BreitWignerMass::tabulated;
+};
+
+/*
+ * Fixture with a random generator, a mass generator and a
+ * rho-like particle using it.
+ */
+struct FixBreitWignerMass {
+  FixBreitWignerMass()
+    : srng(), urng(&srng), bw(new_ptr(TestBreitWignerMass())),
+      pd(ParticleData::Create(113, "rho0")) {
+    pd->mass(0.77526*GeV);
+    pd->width(0.1491*GeV);
+    pd->widthCut(0.5*GeV);
+    pd->massGenerator(bw);
+  }
+
+  /*
+   * Set the TableSize parameter of the mass generator \a b.
+   */
+  static void tableSize(BreitWignerMass & b, string n) {
+    IBPtr proto = new_ptr(BreitWignerMass());
+    BaseRepository::FindInterface(proto, "TableSize")->exec(b, "set", n);
+  }
+
+  /*
+   * The exact cumulative distribution of the truncated relativistic
+   * Breit-Wigner at mass \a m.
+   */
+  double cdf(Energy m) const {
+    Energy m0 = pd->mass();
+    Energy w = pd->width();
+    Energy lo = max(pd->massMin(), max(m0 - pd->widthCut(), ZERO));
+    Energy hi = min(pd->massMax(), m0 + pd->widthCut());
+    double amin = atan((sqr(lo) - sqr(m0))/(m0*w));
+    double amax = atan((sqr(hi) - sqr(m0))/(m0*w));
+    double a = atan((sqr(m) - sqr(m0))/(m0*w));
+    return min(max((a - amin)/(amax - amin), 0.0), 1.0);
+  }
+
+  /*
+   * The Kolmogorov-Smirnov distance between the masses \a m and the
+   * exact distribution.
+   */
+  double distance(vector<Energy> m) const {
+    std::sort(m.begin(), m.end());
+    double d = 0.0;
+    double n = m.size();
+    for ( std::size_t i = 0; i < m.size(); ++i ) {
+      double f = cdf(m[i]);
+      d = max(d, max(std::abs(f - i/n), std::abs(f - (i + 1)/n)));
+    }
+    return d;
+  }
+
+  /*
+   * Generate \a n masses one by one and \a n more in one batch, and
+   * check that they are within the limits and follow the exact
+   * distribution.
+   */
+  void check(std::size_t n) const {
+    // The 99.9% limit of the Kolmogorov-Smirnov distance is about
+    // 1.95/sqrt(n).
+    double limit = 1.95/std::sqrt(double(n));
+    vector<Energy> m(n);
+    for ( std::size_t i = 0; i < n; ++i ) m[i] = pd->generateMass();
+    BOOST_CHECK_LT(distance(m), limit);
+    BOOST_CHECK_GE(*std::min_element(m.begin(), m.end())/GeV, pd->massMin()/GeV);
+    BOOST_CHECK_LE(*std::max_element(m.begin(), m.end())/GeV, pd->massMax()/GeV);
+    pd->generateMasses(&m[0], n);
+    BOOST_CHECK_LT(distance(m), limit);
+    BOOST_CHECK_GE(*std::min_element(m.begin(), m.end())/GeV, pd->massMin()/GeV);
+    BOOST_CHECK_LE(*std::max_element(m.begin(), m.end())/GeV, pd->massMax()/GeV);
+  }
+
+  StandardRandom srng;
+  UseRandom urng;
+  RCPtr<TestBreitWignerMass> bw;
+  PDPtr pd;
+};
+
+}
+
+/*
+ * Start of boost unit tests for BreitWignerMass.
+ */
+BOOST_FIXTURE_TEST_SUITE(pdtBreitWignerMass, FixBreitWignerMass)
+
+BOOST_AUTO_TEST_CASE(exactMasses)
+{
+  bw->tabulate(*pd);
+  BOOST_CHECK(!bw->tabulated(*pd));
+  check(100000);
+}
+
+BOOST_AUTO_TEST_CASE(tabulatedMasses)
+{
+  for ( string n : { "1000", "50" } ) {
+    tableSize(*bw, n);
+    bw->tabulate(*pd);
+    BOOST_REQUIRE(bw->tabulated(*pd));
+    check(100000);
+  }
+
+  // An asymmetric cut, where the lower limit is given by the minimum
+  // mass.
+  pd->widthLoCut(0.2*GeV);
+  BOOST_CHECK(!bw->tabulated(*pd));
+  bw->tabulate(*pd);
+  BOOST_REQUIRE(bw->tabulated(*pd));
+  check(100000);
+}
+
+BOOST_AUTO_TEST_CASE(outdatedTable)
+{
+  tableSize(*bw, "1000");
+  bw->tabulate(*pd);
+  BOOST_REQUIRE(bw->tabulated(*pd));
+
+  // If the width changes, the exact method is used.
+  pd->width(0.01*GeV);
+  BOOST_CHECK(!bw->tabulated(*pd));
+  check(100000);
+
+  // Particles without width are not tabulated.
+  pd->width(ZERO);
+  bw->tabulate(*pd);
+  BOOST_CHECK(!bw->tabulated(*pd));
+  BOOST_CHECK_EQUAL(pd->generateMass()/GeV, pd->mass()/GeV);
+}
+
+BOOST_AUTO_TEST_CASE(persistentTableSize)
+{
+  tableSize(*bw, "200");
+  std::ostringstream os;
+  {
+    PersistentOStream pos(os);
+    bw->persistentOutput(pos);
+    pos << 42;
+  }
+  RCPtr<TestBreitWignerMass> bw2 = new_ptr(TestBreitWignerMass());
+  std::istringstream is(os.str());
+  PersistentIStream pis(is);
+  bw2->persistentInput(pis, 1);
+  int marker = 0;
+  pis >> marker;
+  BOOST_CHECK_EQUAL(marker, 42);
+  bw2->tabulate(*pd);
+  BOOST_CHECK(bw2->tabulated(*pd));
+
+  // Objects written before TableSize was introduced had no
+  // persistent data.
+  std::ostringstream os0;
+  {
+    PersistentOStream pos(os0);
+    pos << 42;
+  }
+  RCPtr<TestBreitWignerMass> bw0 = new_ptr(TestBreitWignerMass());
+  tableSize(*bw0, "200");
+  std::istringstream is0(os0.str());
+  PersistentIStream pis0(is0);
+  bw0->persistentInput(pis0, 0);
+  marker = 0;
+  pis0 >> marker;
+  BOOST_CHECK_EQUAL(marker, 42);
+  bw0->tabulate(*pd);
+  BOOST_CHECK(!bw0->tabulated(*pd));
+  BOOST_CHECK_EQUAL(ClassTraits<BreitWignerMass>::version(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* ThePEG_PDT_Test_BreitWignerMass_H */
@@ -20,7 +20,8 @@
 namespace ThePEG {
 
 PersistentIStream::PersistentIStream(string file) 
-  : theIStream(0), isPedantic(true), allocStream(true), badState(false) {
+  : theIStream(0), isPedantic(true), allocStream(true), badState(false),
+    isBinary(false) {
 //    if ( file[0] == '|' )
 //      theIStream = new ipfstream(file.substr(1).c_str());
 //    else if ( file.substr(file.length()-3, file.length()) == ".gz" )
@@ -36,7 +37,8 @@ PersistentIStream::PersistentIStream(string file)
 void PersistentIStream::init() {
   string tag;
   operator>>(tag);
-  if ( tag != "ThePEG version 1 Database" ) setBadState();
+  if ( tag == "ThePEG version 1 Binary Database" ) isBinary = true;
+  else if ( tag != "ThePEG version 1 Database" ) setBadState();
   operator>>(version);
   operator>>(subVersion);
   if ( version > 0 || subVersion > 0 ) {
@@ -158,12 +160,11 @@ PersistentIStream::BPtr PersistentIStream::getObject() {
       << "PersistentIStream could not read in object because its number ("
       << oid << ") was inconsistent." << Exception::runerror;
     pid = getClass();
-    unsigned long uid = ReferenceCounted::objectCounter + 1;
+    unsigned long uid = ReferenceCounted::peekId();
     if ( version > 0 || subVersion >= 3 ) *this >> uid;
-    unsigned long saveid = ReferenceCounted::objectCounter;
-    ReferenceCounted::objectCounter = uid - 1;
+    ReferenceCounted::setNextId(uid);
     obj = pid->create();
-    ReferenceCounted::objectCounter = max(saveid, uid);
+    ReferenceCounted::setNextId(0);
     readObjects.erase(readObjects.begin() + (oid - 1), readObjects.end());
     readObjects.push_back(obj);
     getObjectPart(obj, pid);
@@ -242,7 +243,46 @@ const InputDescription * PersistentIStream::getClass() {
 }
 
 
+void PersistentIStream::skipBinaryField() {
+  switch ( get() ) {
+  case bInt:
+  case bUInt:
+    getVarint();
+    break;
+  case bDouble:
+    is().ignore(8);
+    break;
+  case bFloat:
+    is().ignore(4);
+    break;
+  case bString:
+    is().ignore(getVarint());
+    break;
+  case bChar:
+    get();
+    break;
+  case bYes:
+  case bNo:
+    break;
+  default:
+    setBadState();
+  }
+  if ( !is() ) setBadState();
+}
+
 PersistentIStream & PersistentIStream::operator>>(string & s) {
+  if ( isBinary ) {
+    if ( get() != bString ) {
+      setBadState();
+      s.erase();
+      return *this;
+    }
+    uint64_t n = getVarint();
+    s.resize(n);
+    if ( n ) is().read(&s[0], n);
+    if ( !is() ) setBadState();
+    return *this;
+  }
   s.erase();
   char c = 0;
   while ( good() && (c = get()) != tSep ) {
@@ -253,6 +293,11 @@ PersistentIStream & PersistentIStream::operator>>(string & s) {
 }
 
 PersistentIStream & PersistentIStream::operator>>(char & c) {
+  if ( isBinary ) {
+    if ( get() != bChar ) setBadState();
+    c = get();
+    return *this;
+  }
   if ( (c = get()) == tNull ) c = escaped();
   getSep();
   return *this;
@@ -273,6 +318,12 @@ PersistentIStream & PersistentIStream::operator>>(signed char & c) {
 }
 
 PersistentIStream & PersistentIStream::operator>>(bool & t) {
+  if ( isBinary ) {
+    char c = get();
+    t = ( c == bYes );
+    if ( !t && c != bNo ) setBadState();
+    return *this;
+  }
   char c = get();
   t = ( c == tYes );
   if ( !t && c != tNo ) setBadState();
@@ -14,8 +14,11 @@
 #include "InputDescription.h"
 #include "PersistentIStream.fh"
 #include "ThePEG/Utilities/Exception.h"
+#include "ThePEG/Utilities/FlatSet.h"
 #include <climits>
 #include <valarray>
+#include <cstring>
+#include <stdint.h>
 
 namespace ThePEG {
 
@@ -42,6 +45,10 @@ namespace ThePEG {
  * structures, the virtual base classes will be written out several
  * times for the same object.
  *
+ * Both the text and the compact binary format written by
+ * PersistentOStream can be read. The format is determined from the
+ * header of the stream.
+ *
  * @see PersistentOStream
  * @see ClassTraits
  */
@@ -65,7 +72,7 @@ public:
    */
   PersistentIStream(istream & is) 
     : theIStream(&is), isPedantic(true), 
-      allocStream(false), badState(false)
+      allocStream(false), badState(false), isBinary(false)
   {
     init();
   }
@@ -164,6 +171,7 @@ public:
    * Read an integer.
    */
   PersistentIStream & operator>>(int & i) {
+    if ( isBinary ) return getInteger(i);
     is() >> i;
     getSep();
     return *this;
@@ -173,6 +181,7 @@ public:
    * Read an unsigned integer.
    */
   PersistentIStream & operator>>(unsigned int & i) {
+    if ( isBinary ) return getInteger(i);
     is() >> i;
     getSep();
     return *this;
@@ -182,6 +191,7 @@ public:
    * Read a long integer.
    */
   PersistentIStream & operator>>(long & i) {
+    if ( isBinary ) return getInteger(i);
     is() >> i;
     getSep();
     return *this;
@@ -191,6 +201,7 @@ public:
    * Read an unsigned long integer.
    */
   PersistentIStream & operator>>(unsigned long & i) {
+    if ( isBinary ) return getInteger(i);
     is() >> i;
     getSep();
     return *this;
@@ -200,6 +211,7 @@ public:
    * Read a short integer.
    */
   PersistentIStream & operator>>(short & i) {
+    if ( isBinary ) return getInteger(i);
     is() >> i;
     getSep();
     return *this;
@@ -209,6 +221,7 @@ public:
    * Read an unsigned short integer.
    */
   PersistentIStream & operator>>(unsigned short & i) {
+    if ( isBinary ) return getInteger(i);
     is() >> i;
     getSep();
     return *this;
@@ -218,6 +231,7 @@ public:
    * Read a double.
    */
   PersistentIStream & operator>>(double & d) {
+    if ( isBinary ) return getFloating(d);
     is() >> d;
     getSep();
     return *this;
@@ -227,6 +241,7 @@ public:
    * Read a float.
    */
   PersistentIStream & operator>>(float & f) {
+    if ( isBinary ) return getFloating(f);
     is() >> f;
     getSep();
     return *this;
@@ -327,6 +342,11 @@ public:
    */
   bool pedantic() const { return isPedantic; }
 
+  /**
+   * Return true if the stream is in the compact binary format.
+   */
+  bool binary() const { return isBinary; }
+
   /**
    * The global libraries loaded on initialization.
    */
@@ -369,6 +389,83 @@ private:
     return c == tNoSep? tSep: c;
   }
 
+  /**
+   * Read \a n bytes and return them as an integer, the first byte
+   * being the least significant one.
+   */
+  uint64_t getBytes(int n) {
+    unsigned char buff[8];
+    is().read(reinterpret_cast<char *>(buff), n);
+    uint64_t b = 0;
+    for ( int i = n - 1; i >= 0; --i ) b = (b << 8) | buff[i];
+    return b;
+  }
+
+  /**
+   * Read a variable-length integer.
+   */
+  uint64_t getVarint() {
+    uint64_t u = 0;
+    for ( int shift = 0; shift < 64 && good(); shift += 7 ) {
+      unsigned char c = static_cast<unsigned char>(get());
+      u |= uint64_t(c & 0x7f) << shift;
+      if ( !(c & 0x80) ) return u;
+    }
+    setBadState();
+    return u;
+  }
+
+  /**
+   * Read an integer in the binary format. Both signed and unsigned
+   * integers are accepted.
+   */
+  template <typename T>
+  PersistentIStream & getInteger(T & i) {
+    char tag = get();
+    if ( tag == bInt ) {
+      uint64_t u = getVarint();
+      i = static_cast<T>(static_cast<long long>(u >> 1) ^
+			 -static_cast<long long>(u & 1));
+    }
+    else if ( tag == bUInt ) i = static_cast<T>(getVarint());
+    else setBadState();
+    return *this;
+  }
+
+  /**
+   * Read a floating point number in the binary format. Integers are
+   * also accepted.
+   */
+  template <typename T>
+  PersistentIStream & getFloating(T & x) {
+    char tag = is().peek();
+    if ( tag == bDouble ) {
+      get();
+      uint64_t b = getBytes(8);
+      double d;
+      std::memcpy(&d, &b, sizeof(d));
+      x = static_cast<T>(d);
+    }
+    else if ( tag == bFloat ) {
+      get();
+      uint32_t b = static_cast<uint32_t>(getBytes(4));
+      float f;
+      std::memcpy(&f, &b, sizeof(f));
+      x = static_cast<T>(f);
+    }
+    else {
+      long long i = 0;
+      getInteger(i);
+      x = static_cast<T>(i);
+    }
+    return *this;
+  }
+
+  /**
+   * Skip one field in the binary format.
+   */
+  void skipBinaryField();
+
   /**
    * Set the stream in a bad state
    */
@@ -389,6 +486,7 @@ private:
    * Scan the stream for the next field separator.
    */
   void skipField() {
+    if ( isBinary ) return skipBinaryField();
     is().ignore(INT_MAX, tSep);
     if ( !is() ) setBadState();
   }
@@ -455,6 +553,11 @@ private:
    */
   bool badState;
 
+  /**
+   * True if the stream is in the compact binary format.
+   */
+  bool isBinary;
+
   /** Version number of the PersistentOStream which has written the
    *  file being read. */
   int version;
@@ -513,6 +616,50 @@ private:
   static const char tNo = 'n';
   //@}
 
+  /** @name Type tags used in the binary format. See PersistentOStream. */
+  //@{
+  /**
+   * A signed integer written as a zig-zag encoded variable-length
+   * integer.
+   */
+  static const char bInt = 'I';
+
+  /**
+   * An unsigned integer written as a variable-length integer.
+   */
+  static const char bUInt = 'U';
+
+  /**
+   * A double written as eight bytes.
+   */
+  static const char bDouble = 'D';
+
+  /**
+   * A float written as four bytes.
+   */
+  static const char bFloat = 'F';
+
+  /**
+   * A string written as its length followed by the characters.
+   */
+  static const char bString = 'S';
+
+  /**
+   * A single character.
+   */
+  static const char bChar = 'C';
+
+  /**
+   * A true boolean value.
+   */
+  static const char bYes = 'Y';
+
+  /**
+   * A false boolean value.
+   */
+  static const char bNo = 'N';
+  //@}
+
 private:
 
   /**
@@ -608,6 +755,14 @@ inline PersistentIStream & operator>>(PersistentIStream & is,
   return is;
 }
 
+/** Input a FlatSet of objects. */
+template <typename Key, typename Cmp>
+inline PersistentIStream & operator>>(PersistentIStream & is,
+				      FlatSet<Key,Cmp> & s) {
+  is.getContainer(s);
+  return is;
+}
+
 /** Input a multoset of objects. */
 template <typename Key, typename Cmp, typename A>
 inline PersistentIStream & operator>>(PersistentIStream & is,
@@ -17,19 +17,22 @@
 
 namespace ThePEG {
 
-PersistentOStream::PersistentOStream(ostream & os, const vector<string> & libs)
-: theOStream(&os), badState(false), allocStream(false) {
+PersistentOStream::PersistentOStream(ostream & os, const vector<string> & libs,
+				     bool binary)
+: theOStream(&os), badState(false), allocStream(false), isBinary(binary) {
   init(libs);
 }
 
-PersistentOStream::PersistentOStream(string file, const vector<string> & libs)
-  : badState(false), allocStream(true) {
+PersistentOStream::PersistentOStream(string file, const vector<string> & libs,
+				     bool binary)
+  : badState(false), allocStream(true), isBinary(binary) {
 //    if ( file[0] == '|' )
 //      theOStream = new opfstream(file.substr(1).c_str());
 //    else if ( file.substr(file.length()-3, file.length()) == ".gz" )
 //      theOStream = new opfstream(string("gzip > " + file).c_str());
 //    else
-    theOStream = new ofstream(file.c_str());
+    theOStream = binary? new ofstream(file.c_str(), ios::out | ios::binary):
+                         new ofstream(file.c_str());
   if ( theOStream )
     init(libs);
   else
@@ -37,7 +40,13 @@ PersistentOStream::PersistentOStream(string file, const vector<string> & libs)
 }
 
 void PersistentOStream::init(const vector<string> & libs) {
-  operator<<(string("ThePEG version 1 Database"));
+  // The header tag is always written as text, so that
+  // PersistentIStream can tell which format is used.
+  bool binary = isBinary;
+  isBinary = false;
+  operator<<(string(binary? "ThePEG version 1 Binary Database":
+		             "ThePEG version 1 Database"));
+  isBinary = binary;
   operator<<(version);
   operator<<(subVersion);
   *this << DynamicLoader::appendedPaths();
@@ -14,9 +14,12 @@
 #include "ThePEG/Utilities/ClassDescription.h"
 #include "ThePEG/Utilities/Exception.h"
 #include "ThePEG/Utilities/Debug.h"
+#include "ThePEG/Utilities/FlatSet.h"
 #include "PersistentOStream.fh"
 #include "PersistentOStream.xh"
 #include <valarray>
+#include <cstring>
+#include <stdint.h>
 
 namespace ThePEG {
 
@@ -44,6 +47,15 @@ namespace ThePEG {
  * structures, the virtual base classes will be written out several
  * times for the same object.
  *
+ * The stream is normally written as text. Optionally a compact
+ * binary format may be used, where integers are written as
+ * variable-length integers, floating point numbers in their raw IEEE
+ * representation and strings prefixed by their length. Each value is
+ * preceded by a one-character type tag, so that PersistentIStream can
+ * still skip fields it does not know about. The format is recorded in
+ * the header of the stream and is detected automatically by
+ * PersistentIStream.
+ *
  * @see PersistentIStream
  * @see ClassDescription
  * @see ClassTraits
@@ -68,9 +80,11 @@ public:
   /**
    * Constuctor giving an output stream. Optionally a vector of
    * libraries to be loaded before the resulting file can be read in
-   * again can be given in \a libs.
+   * again can be given in \a libs. If \a binary is true the compact
+   * binary format is used.
    */
-  PersistentOStream(ostream &, const vector<string> & libs = vector<string>());
+  PersistentOStream(ostream &, const vector<string> & libs = vector<string>(),
+		    bool binary = false);
 
   /**
    * Constuctor giving a file name to read. If the first
@@ -78,9 +92,11 @@ public:
    * run and its standard input is used instead. If the filename ends
    * in ".gz" the file is compressed with gzip. Optionally a vector of
    * libraries to be loaded before the resulting file can be read in
-   * again can be given in \a libs.
+   * again can be given in \a libs. If \a binary is true the compact
+   * binary format is used.
    */
-  PersistentOStream(string, const vector<string> & libs = vector<string>());
+  PersistentOStream(string, const vector<string> & libs = vector<string>(),
+		    bool binary = false);
 
   /**
    * The destructor
@@ -134,6 +150,12 @@ public:
    * Write a character string.
    */
   PersistentOStream & operator<<(string s) {
+    if ( isBinary ) {
+      put(bString);
+      putVarint(s.size());
+      os().write(s.data(), s.size());
+      return *this;
+    }
     for ( string::const_iterator i = s.begin(); i < s.end(); ++i ) escape(*i);
     put(tSep);
     return *this;
@@ -143,6 +165,11 @@ public:
    * Write a character.
    */
   PersistentOStream & operator<<(char c) {
+    if ( isBinary ) {
+      put(bChar);
+      put(c);
+      return *this;
+    }
     escape(c);
     put(tSep);
     return *this;
@@ -166,6 +193,7 @@ public:
    * Write an integer.
    */
   PersistentOStream & operator<<(int i) {
+    if ( isBinary ) return putSigned(i);
     os() << i;
     put(tSep);
     return *this;
@@ -175,6 +203,7 @@ public:
    * Write an unsigned integer.
    */
   PersistentOStream & operator<<(unsigned int i) {
+    if ( isBinary ) return putUnsigned(i);
     os() << i;
     put(tSep);
     return *this;
@@ -184,6 +213,7 @@ public:
    * Write a long integer.
    */
   PersistentOStream & operator<<(long i) {
+    if ( isBinary ) return putSigned(i);
     os() << i;
     put(tSep);
     return *this;
@@ -193,6 +223,7 @@ public:
    * Write an unsigned long integer.
    */
   PersistentOStream & operator<<(unsigned long i) {
+    if ( isBinary ) return putUnsigned(i);
     os() << i;
     put(tSep);
     return *this;
@@ -202,6 +233,7 @@ public:
    * Write a short integer.
    */
   PersistentOStream & operator<<(short i) {
+    if ( isBinary ) return putSigned(i);
     os() << i;
     put(tSep);
     return *this;
@@ -211,6 +243,7 @@ public:
    * Write an unsigned short integer.
    */
   PersistentOStream & operator<<(unsigned short i) {
+    if ( isBinary ) return putUnsigned(i);
     os() << i;
     put(tSep);
     return *this;
@@ -224,6 +257,12 @@ public:
       throw WriteError()
 	<< "Tried to write a NaN or Inf double to a persistent stream."
 	<< Exception::runerror;
+    if ( isBinary ) {
+      uint64_t b;
+      std::memcpy(&b, &d, sizeof(b));
+      put(bDouble);
+      return putBytes(b, 8);
+    }
     os() << setprecision(18) << d;
     put(tSep);
     return *this;
@@ -237,6 +276,12 @@ public:
       throw WriteError()
 	<< "Tried to write a NaN or Inf float to a persistent stream."
 	<< Exception::runerror;
+    if ( isBinary ) {
+      uint32_t b;
+      std::memcpy(&b, &f, sizeof(b));
+      put(bFloat);
+      return putBytes(b, 4);
+    }
     os() << setprecision(9) << f;
     put(tSep);
     return *this;
@@ -246,6 +291,10 @@ public:
    * Write a boolean.
    */
   PersistentOStream & operator<<(bool t) {
+    if ( isBinary ) {
+      put(t? bYes: bNo);
+      return *this;
+    }
     if (t) put(tYes);
     else put(tNo);
     // This is a workaround for a possible bug in gcc 4.0.0
@@ -326,6 +375,11 @@ public:
    */
   bool good() const { return !badState && os(); }
 
+  /**
+   * Return true if the compact binary format is used.
+   */
+  bool binary() const { return isBinary; }
+
   /**
    * Check the state of the stream.
    */
@@ -407,6 +461,51 @@ private:
   static const char tNo = 'n';
   //@}
 
+  /** @name Type tags used in the binary format. None of these may
+   *  coincide with the special marker characters above. */
+  //@{
+  /**
+   * A signed integer written as a zig-zag encoded variable-length
+   * integer.
+   */
+  static const char bInt = 'I';
+
+  /**
+   * An unsigned integer written as a variable-length integer.
+   */
+  static const char bUInt = 'U';
+
+  /**
+   * A double written as eight bytes.
+   */
+  static const char bDouble = 'D';
+
+  /**
+   * A float written as four bytes.
+   */
+  static const char bFloat = 'F';
+
+  /**
+   * A string written as its length followed by the characters.
+   */
+  static const char bString = 'S';
+
+  /**
+   * A single character.
+   */
+  static const char bChar = 'C';
+
+  /**
+   * A true boolean value.
+   */
+  static const char bYes = 'Y';
+
+  /**
+   * A false boolean value.
+   */
+  static const char bNo = 'N';
+  //@}
+
   /**
    * Return true if the given character is aspecial marker character.
    */
@@ -457,6 +556,50 @@ private:
    */
   void put(char c) { os().put(c); }
 
+  /**
+   * Write the \a n least significant bytes of \a b, starting with the
+   * least significant one.
+   */
+  PersistentOStream & putBytes(uint64_t b, int n) {
+    char buff[8];
+    for ( int i = 0; i < n; ++i, b >>= 8 ) buff[i] = char(b & 0xff);
+    os().write(buff, n);
+    return *this;
+  }
+
+  /**
+   * Write \a u as a variable-length integer with seven bits per byte.
+   */
+  void putVarint(uint64_t u) {
+    char buff[10];
+    int n = 0;
+    while ( u >= 0x80 ) {
+      buff[n++] = char((u & 0x7f) | 0x80);
+      u >>= 7;
+    }
+    buff[n++] = char(u);
+    os().write(buff, n);
+  }
+
+  /**
+   * Write a signed integer in the binary format.
+   */
+  PersistentOStream & putSigned(long long i) {
+    put(bInt);
+    putVarint((static_cast<uint64_t>(i) << 1) ^
+	      static_cast<uint64_t>(i < 0? -1: 0));
+    return *this;
+  }
+
+  /**
+   * Write an unsigned integer in the binary format.
+   */
+  PersistentOStream & putUnsigned(unsigned long long u) {
+    put(bUInt);
+    putVarint(u);
+    return *this;
+  }
+
   /**
    * Put a character on the associated ostream but escape it if it is
    * a token.
@@ -514,6 +657,11 @@ private:
    */
   bool allocStream;
 
+  /**
+   * True if the compact binary format is used.
+   */
+  bool isBinary;
+
 private:
 
   /**
@@ -601,6 +749,17 @@ inline PersistentOStream & operator<<(PersistentOStream & os,
 }
 
 
+/**
+ * Output a FlatSet of objects.
+ */
+template <typename Key, typename Cmp>
+inline PersistentOStream & operator<<(PersistentOStream & os,
+				      const FlatSet<Key,Cmp> & s) {
+  os.putContainer(s);
+  return os;
+}
+
+
 /**
  * Output a multiset of objects.
  */
@@ -94,6 +94,11 @@ public:
    */
   RCPtr(const RCPtr & p) : ptr(p.ptr) { increment(); }
 
+  /**
+   * Move constructor. The pointer \a p is left null.
+   */
+  RCPtr(RCPtr && p) noexcept : ptr(p.ptr) { p.ptr = nullptr; }
+
   /**
    * Copy constructor for class UPtr which has operator-> defined
    * resulting in a value implicitly convertible to T *.
@@ -165,6 +170,17 @@ public:
     return *this;
   }
 
+  /**
+   * Move assignment. The pointer \a p is left null.
+   */
+  RCPtr & operator=(RCPtr && p) {
+    if ( this == &p ) return *this;
+    release();
+    ptr = p.ptr;
+    p.ptr = nullptr;
+    return *this;
+  }
+
   /**
    * Assignment from class UPtr which has operator-> defined resulting
    * in a value implicitly convertible to T *.
@@ -353,6 +369,11 @@ public:
    */
   ConstRCPtr(const ConstRCPtr & p) : ptr(p.ptr) { increment(); }
 
+  /**
+   * Move constructor. The pointer \a p is left null.
+   */
+  ConstRCPtr(ConstRCPtr && p) noexcept : ptr(p.ptr) { p.ptr = nullptr; }
+
   /**
    * Copyconstructor for class UPtr which has operator-> defined
    * resulting in a value implicitly convertible to const T *.
@@ -381,6 +402,17 @@ public:
     increment();
     return *this;
   }
+
+  /**
+   * Move assignment. The pointer \a p is left null.
+   */
+  ConstRCPtr & operator=(ConstRCPtr && p) {
+    if ( this == &p ) return *this;
+    release();
+    ptr = p.ptr;
+    p.ptr = nullptr;
+    return *this;
+  }
   
   /**
    * Assignment from class UPtr which has operator-> defined resulting
@@ -1,2 +1,86 @@
 #include "ReferenceCounted.h"
-unsigned long ThePEG::Pointer::ReferenceCounted::objectCounter = 0;
+
+using namespace ThePEG::Pointer;
+
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+
+std::atomic<unsigned long> ReferenceCounted::objectCounter(0);
+
+namespace {
+
+/**
+ * The block of unique IDs reserved by the current thread, and an ID
+ * requested with setNextId().
+ */
+struct IdBlock {
+  unsigned long next;
+  unsigned long last;
+  unsigned long forced;
+};
+
+thread_local IdBlock idBlock = { 0, 0, 0 };
+
+}
+
+unsigned long ReferenceCounted::newId() {
+  if ( idBlock.forced ) {
+    unsigned long id = idBlock.forced;
+    idBlock.forced = 0;
+    unsigned long c = objectCounter.load(std::memory_order_relaxed);
+    while ( c < id &&
+	    !objectCounter.compare_exchange_weak(c, id,
+						 std::memory_order_relaxed) ) {}
+    // Drop the rest of the current block if it could give an ID
+    // which is not larger than the restored one.
+    if ( idBlock.next <= id ) idBlock.next = idBlock.last = 0;
+    return id;
+  }
+  if ( idBlock.next == idBlock.last ) {
+    idBlock.next =
+      objectCounter.fetch_add(IdBlockSize, std::memory_order_relaxed) + 1;
+    idBlock.last = idBlock.next + IdBlockSize;
+  }
+  return idBlock.next++;
+}
+
+void ReferenceCounted::setNextId(unsigned long id) {
+  idBlock.forced = id;
+}
+
+unsigned long ReferenceCounted::peekId() {
+  if ( idBlock.next != idBlock.last ) return idBlock.next;
+  return objectCounter.load(std::memory_order_relaxed) + 1;
+}
+
+#else
+
+unsigned long ReferenceCounted::objectCounter = 0;
+
+namespace {
+
+/**
+ * An ID requested with setNextId().
+ */
+unsigned long forcedId = 0;
+
+}
+
+unsigned long ReferenceCounted::newId() {
+  if ( forcedId ) {
+    unsigned long id = forcedId;
+    forcedId = 0;
+    if ( objectCounter < id ) objectCounter = id;
+    return id;
+  }
+  return ++objectCounter;
+}
+
+void ReferenceCounted::setNextId(unsigned long id) {
+  forcedId = id;
+}
+
+unsigned long ReferenceCounted::peekId() {
+  return objectCounter + 1;
+}
+
+#endif
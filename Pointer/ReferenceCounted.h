@@ -13,6 +13,10 @@
 
 #include "RCPtr.fh"
 #include "ThePEG/Persistency/PersistentIStream.fh"
+#include "ThePEG/Config/Features.h"
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+#include <atomic>
+#endif
 
 namespace ThePEG {
 namespace Pointer {
@@ -24,6 +28,15 @@ namespace Pointer {
  * ConstRCPtr pointers which are currently pointing to an
  * object.
  *
+ * If ThePEG is configured with <code>--enable-thread-safe-pointers</code>
+ * (which defines the macro <code>ThePEG_THREAD_SAFE_POINTERS</code> in
+ * the installed header ThePEG/Config/Features.h, so that code using
+ * ThePEG sees the same definition) the reference count is atomic, so
+ * that objects may be shared between threads. The unique IDs are
+ * then handed out to each thread in blocks of <code>IdBlockSize</code>,
+ * so that they are still increasing for the objects created in one
+ * thread.
+ *
  * @see RCPtr
  * @see ConstRCPtr
  */
@@ -40,6 +53,13 @@ public:
    */
   typedef unsigned int CounterType;
 
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+  /**
+   * The number of unique IDs reserved by a thread at a time.
+   */
+  static const unsigned long IdBlockSize = 1024;
+#endif
+
 protected:
 
   /** @name Standard constructors and assignment. */
@@ -48,14 +68,14 @@ protected:
    * Default constructor.
    */
   ReferenceCounted() 
-    : uniqueId(++objectCounter), 
+    : uniqueId(newId()), 
       theReferenceCounter(CounterType(1)) {}
 
   /**
    * Copy-constructor.
    */
   ReferenceCounted(const ReferenceCounted &)
-    : uniqueId(++objectCounter), 
+    : uniqueId(newId()), 
       theReferenceCounter(CounterType(1)) {}
 
   /**
@@ -75,27 +95,61 @@ public:
    */
   CounterType referenceCount() const 
   { 
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+    return theReferenceCounter.load(std::memory_order_relaxed);
+#else
     return theReferenceCounter; 
+#endif
   }
 
 private:
 
   /**
-   * Increment the reference count.
+   * Increment the reference count. A new reference can only be made
+   * from an existing one, so no ordering is needed.
    */
   void incrementReferenceCount() const 
   { 
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+    theReferenceCounter.fetch_add(1, std::memory_order_relaxed);
+#else
     ++theReferenceCounter; 
+#endif
   }
 
   /**
-   * Decrement with the reference count.
+   * Decrement with the reference count. The thread releasing the last
+   * reference must see all changes made through the other ones before
+   * deleting the object.
    */
   bool decrementReferenceCount() const 
   {
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+    return theReferenceCounter.fetch_sub(1, std::memory_order_acq_rel) == 1;
+#else
     return !--theReferenceCounter;
+#endif
   }
 
+  /**
+   * Return a new unique ID.
+   */
+  static unsigned long newId();
+
+  /**
+   * Let the next object created in this thread get the unique ID
+   * \a id, and make sure that objects created after it get larger
+   * IDs. If \a id is zero, a previous request is cancelled. Used by
+   * PersistentIStream to restore the IDs of objects read in.
+   */
+  static void setNextId(unsigned long id);
+
+  /**
+   * Return the unique ID the next object created in this thread will
+   * get, unless another thread creates objects in between.
+   */
+  static unsigned long peekId();
+
 public:
 
   /**
@@ -109,12 +163,20 @@ private:
    * A counter for issuing unique IDs. It will overflow back to 0 eventually,
    * but it is very unlikely that two identical IDs show up in the same event.
    */
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+  static std::atomic<unsigned long> objectCounter;
+#else
   static unsigned long objectCounter;
+#endif
 
   /**
    * The reference count.
    */
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+  mutable std::atomic<CounterType> theReferenceCounter;
+#else
   mutable CounterType theReferenceCounter;
+#endif
 
 };
 
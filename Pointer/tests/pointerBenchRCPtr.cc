@@ -0,0 +1,115 @@
+// -*- C++ -*-
+//
+// pointerBenchRCPtr.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Measures the time needed to create and destroy reference counted
+// objects and to copy RCPtr pointers, to compare the default build
+// with one configured with --enable-thread-safe-pointers. In the
+// thread-safe build it also copies a shared pointer and creates
+// objects concurrently in several threads, and checks the final
+// reference count and the uniqueness of the IDs.
+// Usage: pointer_bench_rcptr [ncreate [ncopy [nthreads]]]
+//
+
+#include "ThePEG/Config/ThePEG.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <vector>
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+#include <thread>
+#endif
+
+using namespace ThePEG::Pointer;
+
+namespace {
+
+struct Counted: public ReferenceCounted {
+  int value = 0;
+};
+
+typedef RCPtr<Counted> CountedPtr;
+
+typedef std::chrono::steady_clock Clock;
+
+double seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  long ncreate = argc > 1 ? std::atol(argv[1]) : 10000000;
+  long ncopy = argc > 2 ? std::atol(argv[2]) : 100000000;
+  int nthreads = argc > 3 ? std::atoi(argv[3]) : 4;
+
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+  std::cout << "Thread-safe pointers" << std::endl;
+#else
+  std::cout << "Default pointers" << std::endl;
+#endif
+
+  long sum = 0;
+  Clock::time_point start = Clock::now();
+  for ( long i = 0; i < ncreate; ++i ) {
+    CountedPtr p = CountedPtr::Create();
+    sum += p->uniqueId & 1;
+  }
+  std::cout << ncreate << " create/destroy: " << seconds(start) << " s"
+	    << std::endl;
+
+  CountedPtr shared = CountedPtr::Create();
+  start = Clock::now();
+  for ( long i = 0; i < ncopy; ++i ) {
+    CountedPtr copy = shared;
+    sum += copy->value;
+  }
+  std::cout << ncopy << " pointer copies: " << seconds(start) << " s"
+	    << std::endl;
+
+  int status = 0;
+
+#ifdef ThePEG_THREAD_SAFE_POINTERS
+  // Copy the same pointer from all threads.
+  std::vector<std::thread> threads;
+  start = Clock::now();
+  for ( int t = 0; t < nthreads; ++t )
+    threads.push_back(std::thread([&shared, ncopy, nthreads]() {
+	  for ( long i = 0, N = ncopy/nthreads; i < N; ++i ) {
+	    CountedPtr copy = shared;
+	  }
+	}));
+  for ( std::thread & t : threads ) t.join();
+  threads.clear();
+  std::cout << ncopy << " pointer copies in " << nthreads << " threads: "
+	    << seconds(start) << " s, final count "
+	    << shared->referenceCount() << std::endl;
+  if ( shared->referenceCount() != 1 ) status = 1;
+
+  // Create objects in all threads and check that the IDs are unique.
+  long nids = 100000;
+  std::vector< std::vector<unsigned long> > ids(nthreads);
+  for ( int t = 0; t < nthreads; ++t )
+    threads.push_back(std::thread([&ids, t, nids]() {
+	  for ( long i = 0; i < nids; ++i )
+	    ids[t].push_back(CountedPtr::Create()->uniqueId);
+	}));
+  for ( std::thread & t : threads ) t.join();
+  std::set<unsigned long> unique;
+  for ( int t = 0; t < nthreads; ++t )
+    unique.insert(ids[t].begin(), ids[t].end());
+  std::cout << nthreads*nids << " IDs created in " << nthreads
+	    << " threads, " << unique.size() << " unique" << std::endl;
+  if ( long(unique.size()) != nthreads*nids ) status = 1;
+#else
+  (void)nthreads;
+#endif
+
+  std::cerr << "(checksum " << sum << ")" << std::endl;
+  return status;
+}
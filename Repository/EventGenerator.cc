@@ -47,6 +47,8 @@
 #include <cstdlib>
 #include "ThePEG/Repository/Main.h"
 #include <csignal>
+#include <unistd.h>
+#include <sys/wait.h>
 
 #ifdef ThePEG_TEMPLATES_IN_CC_FILE
 #include "EventGenerator.tcc"
@@ -82,7 +84,9 @@ EventGenerator::EventGenerator()
     theDebugLevel(0), logNonDefault(-1), printEvent(0), dumpPeriod(0),
     keepAllDumps(false),
     debugEvent(0), maxWarnings(10), maxErrors(10), theCurrentRandom(0),
-    theCurrentGenerator(0), useStdout(false), theIntermediateOutput(false) {}
+    theCurrentGenerator(0), useStdout(false), theIntermediateOutput(false),
+    theNumberOfWorkers(1), thePruneDecayModes(false),
+    theFastDecaySelection(false), theBinaryFiles(false) {}
 
 EventGenerator::EventGenerator(const EventGenerator & eg)
   : Interfaced(eg), theDefaultObjects(eg.theDefaultObjects),
@@ -109,7 +113,11 @@ EventGenerator::EventGenerator(const EventGenerator & eg)
     theCurrentEventHandler(eg.theCurrentEventHandler),
     theCurrentStepHandler(eg.theCurrentStepHandler),
     useStdout(eg.useStdout),
-    theIntermediateOutput(eg.theIntermediateOutput) {}
+    theIntermediateOutput(eg.theIntermediateOutput),
+    theNumberOfWorkers(eg.theNumberOfWorkers),
+    thePruneDecayModes(eg.thePruneDecayModes),
+    theFastDecaySelection(eg.theFastDecaySelection),
+    theBinaryFiles(eg.theBinaryFiles) {}
 
 EventGenerator::~EventGenerator() {
   if ( theCurrentRandom ) delete theCurrentRandom;
@@ -438,6 +446,7 @@ EventPtr EventGenerator::shoot() {
 EventPtr EventGenerator::doShoot() {
   EventPtr event;
   if ( N() >= 0 && ++ieve > N() ) return event;
+  random().setEvent(ieve);
   HoldFlag<int> debug(Debug::level, Debug::isset? Debug::level: theDebugLevel);
   do { 
     int state = 0;
@@ -498,6 +507,7 @@ EventPtr EventGenerator::doShoot() {
 
 EventPtr EventGenerator::doGenerateEvent(tEventPtr e) {
   if ( N() >= 0 && ++ieve > N() ) return EventPtr();
+  random().setEvent(ieve);
   EventPtr event = e;
   try {
     event = eventHandler()->generateEvent(e);
@@ -517,6 +527,7 @@ EventPtr EventGenerator::doGenerateEvent(tEventPtr e) {
 
 EventPtr EventGenerator::doGenerateEvent(tStepPtr s) {
   if ( N() >= 0 && ++ieve > N() ) return EventPtr();
+  random().setEvent(ieve);
   EventPtr event;
   try {
     event = eventHandler()->generateEvent(s);
@@ -572,6 +583,11 @@ void EventGenerator::doGo(long next, long maxevent, bool tics) {
 
   if ( maxevent >= 0 ) N(maxevent);
 
+  if ( next >= 0 && theNumberOfWorkers > 1 && N() >= next ) {
+    doGoWorkers(next, tics);
+    return;
+  }
+
   if ( next >= 0 ) {
     if ( tics ) 
       cerr << "event> " << setw(9) << "init\r" << flush;
@@ -598,6 +614,200 @@ void EventGenerator::doGo(long next, long maxevent, bool tics) {
 
 }
 
+void EventGenerator::doGoWorkers(long next, bool tics) {
+
+  // The expensive initialization, including the presampling in the
+  // event handler, is done once before the workers are forked. The
+  // workers then share the memory of all set-up objects until they
+  // are modified.
+  if ( tics )
+    cerr << "event> " << setw(9) << "init\r" << flush;
+  openOutputFiles();
+  init();
+  if ( !ThePEG_DEBUG_LEVEL ) Exception::noabort = true;
+
+  long nevents = N() - next + 1;
+  long nworkers = min(long(theNumberOfWorkers), nevents);
+  long chunk = (nevents + nworkers - 1)/nworkers;
+
+  // The analysis handlers would each only see the events of one
+  // worker and their results cannot be combined. Without the
+  // possibility to jump to the random sequence of a given event, all
+  // workers would generate identical events.
+  bool single = false;
+  if ( !analysisHandlers().empty() || histogramFactory() ) {
+    log() << "The EventGenerator " << name() << " has analysis handlers, "
+	  << "the results of which cannot be combined from several worker "
+	  << "processes. Will generate all events in one process instead."
+	  << endl;
+    single = true;
+  }
+  else if ( !random().setEvent(next) ) {
+    log() << "The random generator " << random().name() << " cannot provide "
+	  << "independent sequences for different events, which is needed to "
+	  << "run with " << nworkers << " workers. Will generate all events in "
+	  << "one process instead." << endl;
+    single = true;
+  }
+  if ( single ) {
+    initrun();
+    ieve = next - 1;
+    if ( tics ) tic();
+    try {
+      while ( shoot() ) {
+	if ( tics ) tic();
+      }
+    }
+    catch ( ... ) {
+      finish();
+      throw;
+    }
+    finish();
+    finally();
+    return;
+  }
+
+  out().flush();
+  log().flush();
+  BaseRepository::cout().flush();
+  cerr.flush();
+
+  vector<pid_t> pids;
+  vector<int> pipes;
+  for ( long w = 0; w < nworkers; ++w ) {
+    long first = next - 1 + w*chunk;
+    long last = min(first + chunk, N());
+    if ( first >= last ) break;
+    int fd[2];
+    if ( pipe(fd) != 0 )
+      throw Exception() << "Could not create a pipe for worker " << w
+			<< " in EventGenerator " << name() << "."
+			<< Exception::runerror;
+    pid_t pid = fork();
+    if ( pid < 0 )
+      throw Exception() << "Could not fork worker " << w
+			<< " in EventGenerator " << name() << "."
+			<< Exception::runerror;
+    if ( pid == 0 ) {
+      close(fd[0]);
+      for ( int i = 0, M = pipes.size(); i < M; ++i ) close(pipes[i]);
+      _exit(runWorker(w, first, last, fd[1], tics && w == 0));
+    }
+    close(fd[1]);
+    pids.push_back(pid);
+    pipes.push_back(fd[0]);
+  }
+
+  // Collect the raw sums of the statistics from the workers and
+  // merge them in the event handler.
+  long nsum = 0;
+  double sumwgt = 0.0;
+  int failed = 0;
+  for ( int i = 0, M = pids.size(); i < M; ++i ) {
+    string result;
+    char buff[256];
+    ssize_t n;
+    while ( ( n = read(pipes[i], buff, sizeof(buff)) ) > 0 )
+      result.append(buff, n);
+    close(pipes[i]);
+    int status = 0;
+    waitpid(pids[i], &status, 0);
+    if ( !( WIFEXITED(status) && WEXITSTATUS(status) == 0 ) ||
+	 result.empty() ) {
+      ++failed;
+      continue;
+    }
+    try {
+      istringstream is(result);
+      PersistentIStream pis(is);
+      long nev = 0;
+      double wsum = 0.0;
+      pis >> nev >> wsum;
+      eventHandler()->mergeStatistics(pis);
+      if ( !pis ) {
+	++failed;
+	continue;
+      }
+      nsum += nev;
+      sumwgt += wsum;
+    }
+    catch ( Exception & e ) {
+      e.handle();
+      log() << "Could not merge the statistics of worker " << i << ": "
+	    << e.what() << endl;
+      ++failed;
+    }
+  }
+
+  if ( failed ) {
+    finally();
+    throw Exception() << failed << " of the " << pids.size()
+		      << " worker processes in EventGenerator " << name()
+		      << " did not finish successfully, so the statistics "
+		      << "of the run cannot be combined. The output of the "
+		      << "individual workers can be found in " << filename()
+		      << "-<worker>.log." << Exception::runerror;
+  }
+
+  ieve = next - 1 + nsum;
+  weightSum = sumwgt;
+  out() << string(78, '=') << endl
+	<< "Combined statistics from " << pids.size() << " worker processes"
+	<< endl << string(78, '-') << endl
+	<< "Number of events:         " << nsum << endl
+	<< "Sum of weights:           " << sumwgt << endl
+	<< "Cross section (nb):       " << integratedXSec()/nanobarn
+	<< " +- " << integratedXSecErr()/nanobarn << endl;
+  eventHandler()->statistics(out());
+  finally();
+
+}
+
+int EventGenerator::runWorker(long w, long first, long last,
+			      int fd, bool tics) {
+  // Leave the output files of the main run to the parent process.
+  if ( !useStdout ) logfile().close();
+  ostringstream tag;
+  tag << "-" << w;
+  runName(runName() + tag.str());
+  openOutputFiles();
+  int status = 0;
+  try {
+    initrun();
+    ieve = first;
+    N(last);
+    if ( tics ) tic();
+    while ( shoot() ) {
+      if ( tics ) tic();
+    }
+    finish();
+    ostringstream result;
+    {
+      PersistentOStream pos(result, vector<string>(), false);
+      pos << ieve - first - 1 << weightSum;
+      eventHandler()->outputStatistics(pos);
+    }
+    const string & res = result.str();
+    if ( write(fd, res.c_str(), res.size()) != ssize_t(res.size()) )
+      status = 1;
+  }
+  catch ( std::exception & e ) {
+    log() << "Worker " << w << " terminated with an exception: "
+	  << e.what() << endl;
+    status = 1;
+  }
+  catch ( ... ) {
+    log() << "Worker " << w << " terminated with an unknown exception."
+	  << endl;
+    status = 1;
+  }
+  close(fd);
+  finally();
+  BaseRepository::cout().flush();
+  cerr.flush();
+  return status;
+}
+
 void EventGenerator::tic(long currev, long totev) const {
   if ( !currev ) currev = ieve;
   if ( !totev ) totev = N();
@@ -632,7 +842,7 @@ void EventGenerator::dump() const {
     }
     else
       dumpfile = filename() + ".dump";
-    PersistentOStream file(dumpfile, globalLibraries());
+    PersistentOStream file(dumpfile, globalLibraries(), theBinaryFiles);
     file << tcEGPtr(this);
   }
 }
@@ -831,7 +1041,10 @@ void EventGenerator::persistentOutput(PersistentOStream & os) const {
      << ieve << weightSum << theDebugLevel << logNonDefault << printEvent
      << dumpPeriod << keepAllDumps << debugEvent
      << maxWarnings << maxErrors << theCurrentEventHandler
-     << theCurrentStepHandler << useStdout << theIntermediateOutput << theMiscStream.str()
+     << theCurrentStepHandler << useStdout << theIntermediateOutput
+     << theNumberOfWorkers << thePruneDecayModes << theFastDecaySelection
+     << theBinaryFiles
+     << theMiscStream.str()
      << Repository::listReadDirs();
 }
 
@@ -847,7 +1060,10 @@ void EventGenerator::persistentInput(PersistentIStream & is, int) {
      >> ieve >> weightSum >> theDebugLevel >> logNonDefault >> printEvent
      >> dumpPeriod >> keepAllDumps >> debugEvent
      >> maxWarnings >> maxErrors >> theCurrentEventHandler
-     >> theCurrentStepHandler >> useStdout >> theIntermediateOutput >> dummy
+     >> theCurrentStepHandler >> useStdout >> theIntermediateOutput
+     >> theNumberOfWorkers >> thePruneDecayModes >> theFastDecaySelection
+     >> theBinaryFiles
+     >> dummy
      >> readdirs;
   theMiscStream.str(dummy);
   theMiscStream.seekp(0, std::ios::end);
@@ -911,7 +1127,7 @@ string EventGenerator::doSaveRun(string runname) {
   if ( runname.empty() ) runname = name();
   EGPtr eg = Repository::makeRun(this, runname);
   string file =  eg->filename() + ".run";
-  PersistentOStream os(file);
+  PersistentOStream os(file, vector<string>(), eg->binaryFiles());
   os << eg;
   if ( !os ) return "Error: Save failed! (I/O error)";
   return "";
@@ -1389,6 +1605,84 @@ void EventGenerator::Init() {
      "but no further information on the intermediate cross section estimate.",
      false);
 
+  static Parameter<EventGenerator,int> interfaceNumberOfWorkers
+    ("NumberOfWorkers",
+     "The number of worker processes used to generate the events. If larger "
+     "than one, the generator is initialized once and is then forked into "
+     "the given number of workers, each generating a contiguous slice of "
+     "the events with its own log and out files tagged with the "
+     "worker number. The workers share the memory of the initialized "
+     "objects as long as they are not modified. The cross section "
+     "statistics of the workers are merged and written to the out file "
+     "of the main run. "
+     "This requires a random generator which can jump to the random "
+     "sequence of a given event, such as ThePEG::PhiloxRandom. Since "
+     "the state of the samplers is carried over between the events in "
+     "each worker, the events generated depend on the number of workers. "
+     "If there are analysis handlers, the results of which cannot be "
+     "combined, all events are generated in one process.",
+     &EventGenerator::theNumberOfWorkers, 1, 1, 1024, true, false,
+     Interface::limited);
+
+  static Switch<EventGenerator,bool> interfacePruneDecayModes
+    ("PruneDecayModes",
+     "Whether decay modes which are switched off should be left out when "
+     "a run is made from this generator with the <code>saverun</code> or "
+     "<code>makerun</code> commands. Objects which are only used by such "
+     "decay modes, such as their decayers, are then left out as well, "
+     "which makes the run file smaller and faster to read in. Note that "
+     "the pruned decay modes can then not be switched on in the run, eg. "
+     "with a setup file, and that width generators which rely on the "
+     "switched off modes may give different results.",
+     &EventGenerator::thePruneDecayModes, false, true, false);
+  static SwitchOption interfacePruneDecayModesYes
+    (interfacePruneDecayModes,
+     "Yes",
+     "Leave out decay modes which are switched off.",
+     true);
+  static SwitchOption interfacePruneDecayModesNo
+    (interfacePruneDecayModes,
+     "No",
+     "Include all decay modes in the run.",
+     false);
+
+  static Switch<EventGenerator,bool> interfaceFastDecaySelection
+    ("FastDecaySelection",
+     "Whether decay modes should be selected in constant time using "
+     "alias tables, which are set up for all particles when the run is "
+     "initialized. The decay modes are selected with the same "
+     "probabilities, but for a given random seed the generated events "
+     "will differ from those obtained without this option.",
+     &EventGenerator::theFastDecaySelection, false, true, false);
+  static SwitchOption interfaceFastDecaySelectionYes
+    (interfaceFastDecaySelection,
+     "Yes",
+     "Select decay modes using alias tables.",
+     true);
+  static SwitchOption interfaceFastDecaySelectionNo
+    (interfaceFastDecaySelection,
+     "No",
+     "Select decay modes with a binary search among the accumulated "
+     "branching ratios.",
+     false);
+
+  static Switch<EventGenerator,bool> interfaceBinaryFiles
+    ("BinaryFiles",
+     "Whether run files and dump files of this generator should be "
+     "written in the compact binary format rather than as text. Both "
+     "formats are recognized automatically when the files are read.",
+     &EventGenerator::theBinaryFiles, false, true, false);
+  static SwitchOption interfaceBinaryFilesYes
+    (interfaceBinaryFiles,
+     "Yes",
+     "Write run and dump files in the compact binary format.",
+     true);
+  static SwitchOption interfaceBinaryFilesNo
+    (interfaceBinaryFiles,
+     "No",
+     "Write run and dump files as text.",
+     false);
+
 }
 
 EGNoPath::EGNoPath(string path) {
@@ -313,6 +313,30 @@ public:
    */
   bool useStdOut() const { return useStdout; }
 
+  /**
+   * Should decay modes which are switched off be left out when a run
+   * is made from this generator?
+   */
+  bool pruneDecayModes() const { return thePruneDecayModes; }
+
+  /**
+   * Should decay modes be selected in constant time using alias
+   * tables?
+   */
+  bool fastDecaySelection() const { return theFastDecaySelection; }
+
+  /**
+   * Should run files and dump files of this generator be written in
+   * the compact binary format?
+   */
+  bool binaryFiles() const { return theBinaryFiles; }
+
+  /**
+   * Choose whether run files and dump files of this generator should
+   * be written in the compact binary format.
+   */
+  void binaryFiles(bool binary) { theBinaryFiles = binary; }
+
   /**
    * Open all ouput files.
    */
@@ -484,6 +508,24 @@ protected:
    */
   virtual void doGo(long next, long maxevent, bool tics);
 
+  /**
+   * Run this EventGenerator session with several worker
+   * processes. Is called from doGo(long,long,bool) if
+   * NumberOfWorkers is larger than one. The raw sums of the cross
+   * section statistics of the workers are merged in the event
+   * handler. If there are analysis handlers, the results of which
+   * cannot be combined, all events are generated in one process.
+   */
+  void doGoWorkers(long next, bool tics);
+
+  /**
+   * Generate the events \a first + 1 to \a last in worker number \a
+   * w, and write the number of events, the sum of weights and the
+   * raw sums of the statistics of the event handler to the file
+   * descriptor \a fd. Returns the exit status of the worker.
+   */
+  int runWorker(long w, long first, long last, int fd, bool tics);
+
   /**
    * Initialize this generator. Is called from initialize().
    */
@@ -1136,6 +1178,30 @@ private:
    */
   bool theIntermediateOutput;
 
+  /**
+   * The number of worker processes used in doGo().
+   */
+  int theNumberOfWorkers;
+
+  /**
+   * If true, decay modes which are switched off are left out when a
+   * run is made from this generator.
+   */
+  bool thePruneDecayModes;
+
+  /**
+   * If true, the decay selectors of all particles are frozen in the
+   * run initialization, so that decay modes are selected in constant
+   * time using alias tables.
+   */
+  bool theFastDecaySelection;
+
+  /**
+   * If true, run files and dump files are written in the compact
+   * binary format.
+   */
+  bool theBinaryFiles;
+
   /**
    * The global libraries needed for objects used in this EventGenerator.
    */
@@ -0,0 +1,167 @@
+// -*- C++ -*-
+//
+// PhiloxRandom.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+//
+// This is the implementation of the non-inlined, non-templated member
+// functions of the PhiloxRandom class.
+//
+
+#include "PhiloxRandom.h"
+#include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Interface/Parameter.h"
+#include "ThePEG/Utilities/DescribeClass.h"
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
+
+using namespace ThePEG;
+
+namespace {
+
+typedef PhiloxRandom::Word Word;
+
+/** The Philox4x32 multipliers. */
+const Word philoxM0 = 0xD2511F53;
+const Word philoxM1 = 0xCD9E8D57;
+
+/** The Weyl sequence constants used to bump the key. */
+const Word philoxW0 = 0x9E3779B9;
+const Word philoxW1 = 0xBB67AE85;
+
+/** One Philox4x32 round. */
+inline void philoxRound(Word & x0, Word & x1, Word & x2, Word & x3,
+			Word k0, Word k1) {
+  std::uint64_t p0 = std::uint64_t(philoxM0)*x0;
+  std::uint64_t p1 = std::uint64_t(philoxM1)*x2;
+  Word y0 = Word(p1 >> 32)^x1^k0;
+  Word y2 = Word(p0 >> 32)^x3^k1;
+  x0 = y0;
+  x1 = Word(p1);
+  x2 = y2;
+  x3 = Word(p0);
+}
+
+/** The number of blocks processed in parallel by fill(). */
+const unsigned int philoxLanes = 8;
+
+}
+
+IBPtr PhiloxRandom::clone() const {
+  return new_ptr(*this);
+}
+
+IBPtr PhiloxRandom::fullclone() const {
+  return new_ptr(*this);
+}
+
+void PhiloxRandom::philox(Word ctr[4], Word k0, Word k1) {
+  for ( int r = 0; r < 10; ++r ) {
+    if ( r ) {
+      k0 += philoxW0;
+      k1 += philoxW1;
+    }
+    philoxRound(ctr[0], ctr[1], ctr[2], ctr[3], k0, k1);
+  }
+}
+
+void PhiloxRandom::setSeed(long seed) {
+  if ( seed == -1 ) seed = 19940801;
+  theKey = seed;
+  theBlock = 0;
+  flush();
+}
+
+bool PhiloxRandom::setStream(long event, long stream) {
+  theEvent = event;
+  theStream = stream;
+  theBlock = 0;
+  flush();
+  return true;
+}
+
+void PhiloxRandom::setStreamNumber(long stream) {
+  setStream(theEvent, stream);
+}
+
+void PhiloxRandom::fill() {
+  // The counter is (block, event low, event high, stream) and the key
+  // is given by the seed. The blocks are processed philoxLanes at the
+  // time with the lanes in the innermost loops, which allows the
+  // compiler to vectorize the rounds.
+  const std::uint64_t key = theKey;
+  const std::uint64_t evt = theEvent;
+  const Word e0 = Word(evt);
+  const Word e1 = Word(evt >> 32);
+  const Word s = Word(theStream);
+  const double norm = 1.0/4294967296.0;
+
+  RndVector::iterator it = theNumbers.begin();
+  while ( it != theNumbers.end() ) {
+    Word x0[philoxLanes], x1[philoxLanes], x2[philoxLanes], x3[philoxLanes];
+    for ( unsigned int l = 0; l < philoxLanes; ++l ) {
+      x0[l] = Word(theBlock + l);
+      x1[l] = e0;
+      x2[l] = e1;
+      x3[l] = s;
+    }
+    Word k0 = Word(key);
+    Word k1 = Word(key >> 32);
+    for ( int r = 0; r < 10; ++r ) {
+      if ( r ) {
+	k0 += philoxW0;
+	k1 += philoxW1;
+      }
+      for ( unsigned int l = 0; l < philoxLanes; ++l )
+	philoxRound(x0[l], x1[l], x2[l], x3[l], k0, k1);
+    }
+    // Shift by half a unit to stay strictly inside ]0,1[. Numbers
+    // left over in a partially used block are skipped.
+    for ( unsigned int l = 0; l < philoxLanes && it != theNumbers.end(); ++l ) {
+      ++theBlock;
+      *it++ = (double(x0[l]) + 0.5)*norm;
+      if ( it == theNumbers.end() ) break;
+      *it++ = (double(x1[l]) + 0.5)*norm;
+      if ( it == theNumbers.end() ) break;
+      *it++ = (double(x2[l]) + 0.5)*norm;
+      if ( it == theNumbers.end() ) break;
+      *it++ = (double(x3[l]) + 0.5)*norm;
+    }
+  }
+  nextNumber = theNumbers.begin();
+}
+
+void PhiloxRandom::persistentOutput(PersistentOStream & os) const {
+  os << theKey << theStream << theEvent << theBlock;
+}
+
+void PhiloxRandom::persistentInput(PersistentIStream & is, int) {
+  is >> theKey >> theStream >> theEvent >> theBlock;
+}
+
+// The following static variable is needed for the type
+// description system in ThePEG.
+DescribeClass<PhiloxRandom,RandomGenerator>
+  describeThePEGPhiloxRandom("ThePEG::PhiloxRandom", "");
+
+void PhiloxRandom::Init() {
+
+  static ClassDocumentation<PhiloxRandom> documentation
+    ("The counter-based Philox4x32-10 random number generator. Each "
+     "event and stream number has its own independent sequence.",
+     "Random numbers were generated with the Philox4x32-10 algorithm "
+     "\\cite{Salmon:2011phi}.",
+     "\\bibitem{Salmon:2011phi} J.K. Salmon, M.A. Moraes, R.O. Dror "
+     "and D.E. Shaw, SC11 Proceedings (2011) 16.");
+
+  static Parameter<PhiloxRandom,long> interfaceStream
+    ("Stream",
+     "The stream number used to select an independent sequence of "
+     "random numbers, eg. for different worker processes.",
+     &PhiloxRandom::theStream, 0, 0, 0, true, false, Interface::lowerlim,
+     &PhiloxRandom::setStreamNumber);
+
+}
@@ -0,0 +1,183 @@
+// -*- C++ -*-
+//
+// PhiloxRandom.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_PhiloxRandom_H
+#define ThePEG_PhiloxRandom_H
+// This is the declaration of the PhiloxRandom class.
+
+#include "RandomGenerator.h"
+#include <cstdint>
+
+namespace ThePEG {
+
+/**
+ * PhiloxRandom inherits from the RandomGenerator class and implements
+ * the counter-based Philox4x32-10 algorithm of Salmon et al. (SC11).
+ *
+ * Contrary to StandardRandom, the state of the generator is not a
+ * serial sequence but a 128-bit counter which is encrypted with a
+ * key given by the seed. The counter is split into a block number,
+ * an event number and a stream number, so that setStream() can jump
+ * directly to the sequence reserved for a given event and stream. An
+ * event generated with a given seed, event number and stream number
+ * is therefore reproducible independently of how many events were
+ * generated before it and of which process or thread generated it.
+ *
+ * Each block yields four random numbers with 32 bits of precision,
+ * and fill() generates the whole cache in one go, processing a
+ * number of blocks in parallel in a form which is suitable for
+ * automatic vectorization.
+ *
+ * @see \ref PhiloxRandomInterfaces "The interfaces"
+ * defined for PhiloxRandom.
+ */
+class PhiloxRandom: public RandomGenerator {
+
+public:
+
+  /** A 32-bit unsigned integer as used in the Philox rounds. */
+  typedef std::uint32_t Word;
+
+public:
+
+  /** @name Standard constructors and destructors. */
+  //@{
+  /**
+   * Default constructor.
+   */
+  PhiloxRandom() : theKey(0), theStream(0), theEvent(0), theBlock(0) {
+    if ( theSeed != 0 ) setSeed(theSeed);
+  }
+  //@}
+
+public:
+
+  /**
+   * Reset the underlying random algorithm with the given seed. If the
+   * \a seed is set to -1 a standard seed will be used. The counter
+   * is reset to the beginning of the current event and stream.
+   */
+  virtual void setSeed(long seed);
+
+  /**
+   * Position the counter at the start of the sequence reserved for
+   * the given \a event and \a stream. The cache is flushed.
+   */
+  virtual bool setStream(long event, long stream = 0);
+
+  /**
+   * Position the counter at the start of the sequence reserved for
+   * the given \a event in the current stream. The cache is flushed.
+   */
+  virtual bool setEvent(long event) { return setStream(event, theStream); }
+
+  /**
+   * The current event number.
+   */
+  long event() const { return theEvent; }
+
+  /**
+   * The current stream number.
+   */
+  long stream() const { return theStream; }
+
+  /**
+   * Apply the ten Philox4x32 rounds to the counter \a ctr using the
+   * key (\a k0, \a k1). The result is written back to \a ctr.
+   */
+  static void philox(Word ctr[4], Word k0, Word k1);
+
+protected:
+
+  /**
+   * Fill the cache with random numbers.
+   */
+  virtual void fill();
+
+public:
+
+
+  /** @name Functions used by the persistent I/O system. */
+  //@{
+  /**
+   * Function used to write out object persistently.
+   * @param os the persistent output stream written to.
+   */
+  void persistentOutput(PersistentOStream & os) const;
+
+  /**
+   * Function used to read in object persistently.
+   * @param is the persistent input stream read from.
+   * @param version the version number of the object when written.
+   */
+  void persistentInput(PersistentIStream & is, int version);
+  //@}
+
+  /**
+   * Standard Init function used to initialize the interface.
+   */
+  static void Init();
+
+protected:
+
+  /** @name Clone Methods. */
+  //@{
+  /**
+   * Make a simple clone of this object.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr clone() const;
+
+  /** Make a clone of this object, possibly modifying the cloned object
+   * to make it sane.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr fullclone() const;
+  //@}
+
+private:
+
+  /**
+   * Utility function for the interface.
+   */
+  void setStreamNumber(long stream);
+
+private:
+
+  /**
+   * The seed used as key in the encryption.
+   */
+  long theKey;
+
+  /**
+   * The stream number.
+   */
+  long theStream;
+
+  /**
+   * The event number.
+   */
+  long theEvent;
+
+  /**
+   * The next block to be generated in the current event and stream.
+   */
+  unsigned long theBlock;
+
+private:
+
+  /**
+   *  Private and non-existent assignment operator.
+   */
+  PhiloxRandom & operator=(const PhiloxRandom &);
+
+};
+
+}
+
+#endif /* ThePEG_PhiloxRandom_H */
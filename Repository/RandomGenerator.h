@@ -70,6 +70,23 @@ public:
    */
   virtual void setSeed(long seed) = 0;
 
+  /**
+   * Position the underlying random engine at the start of the
+   * sequence reserved for the given \a event and \a stream number,
+   * independently of what has been generated before. Engines which
+   * are not able to do this return false, which is the default.
+   */
+  virtual bool setStream(long, long = 0) { return false; }
+
+  /**
+   * Position the underlying random engine at the start of the
+   * sequence reserved for the given \a event, keeping the current
+   * stream number. Called by the EventGenerator before each
+   * event. Engines which are not able to do this return false, which
+   * is the default.
+   */
+  virtual bool setEvent(long) { return false; }
+
   /** @name Functions to return random numbers. */
   //@{
   /**
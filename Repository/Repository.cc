@@ -159,7 +159,7 @@ tPMPtr Repository::findMatcher(string name) {
 void Repository::saveRun(string EGname, string name, string filename) {
   EGPtr eg = BaseRepository::GetObject<EGPtr>(EGname);
   EGPtr run = makeRun(eg, name);
-  PersistentOStream os(filename, globalLibraries());
+  PersistentOStream os(filename, globalLibraries(), run->binaryFiles());
   if ( ThePEG_DEBUG_ITEM(3) )
     clog() << "Saving event generator '" << name << "'... " << flush;
   os << run;
@@ -167,6 +167,31 @@ void Repository::saveRun(string EGname, string name, string filename) {
     clog() << "done" << endl;
 }
 
+namespace {
+
+/**
+ * As BaseRepository::addReferences(), but do not follow the
+ * references from a particle to those of its decay modes which are
+ * switched off. Such modes are still included if they are referred to
+ * by any other object.
+ */
+void addRunReferences(tIBPtr obj, ObjectSet & refs) {
+  if ( !obj ) return;
+  refs.insert(obj);
+  tcPDPtr pd = dynamic_ptr_cast<tcPDPtr>(obj);
+  IVector ov = BaseRepository::DirectReferences(obj);
+  for ( IVector::const_iterator it = ov.begin(); it != ov.end(); ++it ) {
+    if ( !*it || member(refs, *it) ) continue;
+    if ( pd ) {
+      tcDMPtr dm = dynamic_ptr_cast<tcDMPtr>(*it);
+      if ( dm && dm->parent() == pd && !dm->on() ) continue;
+    }
+    addRunReferences(*it, refs);
+  }
+}
+
+}
+
 EGPtr Repository::makeRun(tEGPtr eg, string name) {
 
   // Clone all objects relevant for the EventGenerator. This is
@@ -184,6 +209,11 @@ EGPtr Repository::makeRun(tEGPtr eg, string name) {
   if ( ThePEG_DEBUG_ITEM(3) )
     clog() << "done\nCloning matchers and particles... " << flush;
 
+  // If requested, decay modes which are switched off are left out
+  // together with anything only they refer to.
+  void (*addReferences)(tIBPtr, ObjectSet &) =
+    eg->pruneDecayModes()? &addRunReferences: &BaseRepository::addReferences;
+
   MatcherSet localMatchers;
   ObjectSet localObjects;
   ObjectSet clonedObjects;
@@ -346,10 +376,10 @@ struct InterfaceOrdering {
   }
 };
 
-void Repository::save(string filename) {
+void Repository::save(string filename, bool binary) {
   if ( ThePEG_DEBUG_ITEM(3) )
     clog() << "saving '" << filename << "'... " << flush;
-  PersistentOStream os(filename, globalLibraries());
+  PersistentOStream os(filename, globalLibraries(), binary);
   set<tcPDPtr,ParticleOrdering>
     part(particles().begin(), particles().end());
   set<tcPMPtr,MatcherOrdering>  match(matchers().begin(), matchers().end());
@@ -787,12 +817,12 @@ string Repository::exec(string command, ostream & os) {
 	eg->go();
       else if ( verb == "saverunfile" ) {
 	string file = generator;
-	PersistentOStream os(file, globalLibraries());
+	PersistentOStream os(file, globalLibraries(), eg->binaryFiles());
 	os << eg;
 	if ( !os ) return "Save failed! (I/O error)";
       } else {
 	string file = eg->filename() + ".run";
-	PersistentOStream os(file, globalLibraries());
+	PersistentOStream os(file, globalLibraries(), eg->binaryFiles());
 	os << eg;
 	if ( !os ) return "Save failed! (I/O error)";
       }
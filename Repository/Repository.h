@@ -141,7 +141,9 @@ public:
 
   /**
    * Isolate an event generatorn, named \a EGname, set its run \a name
-   * and save it to a file named \a filename.
+   * and save it to a file named \a filename. The file is written in
+   * the compact binary format if EventGenerator::binaryFiles() is
+   * true for the generator.
    */
   static void saveRun(string EGname, string name, string filename);
   //@}
@@ -156,9 +158,10 @@ public:
   static string load(string filename);
 
   /**
-   * Save the repository to the given file.
+   * Save the repository to the given file. If \a binary is true the
+   * compact binary format is used.
    */
-  static void save(string filename);
+  static void save(string filename, bool binary = false);
 
   /**
    * Save the repository to the default file.
@@ -0,0 +1,194 @@
+// -*- C++ -*-
+//
+// repositoryTestCFileLineReader.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_Repository_Test_CFileLineReader_H
+#define ThePEG_Repository_Test_CFileLineReader_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/Utilities/CFileLineReader.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+
+namespace {
+
+/*
+ * Write the given tokens, one per line followed by a marker, to a
+ * file and return a reader which has opened it.
+ */
+struct LineReaderFile {
+
+  LineReaderFile(const char * const * tokens, int n)
+    : filename("repositoryTestCFileLineReader.txt") {
+    FILE * f = std::fopen(filename.c_str(), "w");
+    for ( int i = 0; i < n; ++i ) {
+      lines.push_back(std::string(tokens[i]) + " |");
+      std::fprintf(f, "%s\n", lines.back().c_str());
+    }
+    std::fclose(f);
+    reader.open(filename);
+  }
+
+  /*
+   * The part of the current line which has not been read, without
+   * the trailing newline.
+   */
+  std::string rest() const {
+    std::string r = reader.getline();
+    if ( !r.empty() && r[r.size() - 1] == '\n' ) r.erase(r.size() - 1);
+    return r;
+  }
+
+  ~LineReaderFile() {
+    reader.close();
+    std::remove(filename.c_str());
+  }
+
+  std::string filename;
+  std::vector<std::string> lines;
+  ThePEG::CFileLineReader reader;
+
+};
+
+/*
+ * What strtod() gives for \a s, where Fortran style exponents are
+ * first rewritten with an 'e'. The rest of the string is returned in
+ * \a rest and \a bad is set if nothing could be read.
+ */
+double lineReaderStrtod(std::string s, std::string & rest, bool & bad) {
+  std::string e = s;
+  for ( int i = 0, N = e.size(); i < N; ++i )
+    if ( e[i] == 'd' || e[i] == 'D' ) e[i] = 'e';
+  char * end;
+  double d = std::strtod(e.c_str(), &end);
+  bad = ( end == e.c_str() );
+  rest = s.substr(end - e.c_str());
+  return d;
+}
+
+bool lineReaderSame(double a, double b) {
+  if ( std::isnan(a) || std::isnan(b) ) return std::isnan(a) && std::isnan(b);
+  return a == b && std::signbit(a) == std::signbit(b);
+}
+
+const char * const lineReaderDoubleTokens[] = {
+  "0", "-0", "+0.0", "-0.0e5", "0.", "-.5", ".5", "  42.25",
+  "000123.25", "-0000.000125", "00000000000000000000000012345",
+  "0.000000000000000000000001234", "0.0000000000000000000001234",
+  "1234567890123456789", "12345678901234567890",
+  "-1234567890123456789", "99999999999999999999",
+  "1234567890.123456789", "1.234567890123456789e5",
+  "12345678901234567.89", "9007199254740992", "9007199254740993",
+  "0.1", "0.3", "-123456.789e-3", "6.02214076e23", "91.1876",
+  "1e22", "1e23", "1e-22", "1e-23", "-4.5e22", "7e-22", "3.3e+22",
+  "123e-22", "123e-23", "1.5e-23", "1E22", "1E-23", "9.99e22",
+  "1e", "1e+", "1e-", "1e-x", "1ee5", "5.e",
+  "1d5", "2.5D-1", "-3d0", "1d22", "1d23", "1D-22", "7d",
+  "0x1p3", "0X1A", "-0x10", "0x.8", "0xg",
+  "inf", "-inf", "INF", "+Infinity", "nan", "-nan", "NaN", "nan(1)",
+  "1.797693134862315708e308", "2.2250738585072014e-308", "4.9e-324",
+  "1e400", "-1e400", "1e-400",
+  "-", "+", ".", "e5", "abc", "-.e1"
+};
+
+const char * const lineReaderIntegerTokens[] = {
+  "0", "-0", "+7", "42", "  -42", "007", "010", "08", "00", "0x1F",
+  "-0x1f", "0X", "123456789012345678", "-123456789012345678",
+  "1234567890123456789", "-1234567890123456789",
+  "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+  "-9223372036854775809", "99999999999999999999", "4294967295",
+  "4294967296", "2147483648", "-2147483649", "18446744073709551615",
+  "18446744073709551616", "12abc", "3.5", "1e3", "abc", "-", "+", "+-1"
+};
+
+}
+
+/*
+ * Start of boost unit tests for CFileLineReader.h
+ *
+ */
+BOOST_AUTO_TEST_SUITE(repositoryCFileLineReader)
+
+BOOST_AUTO_TEST_CASE(lineReaderDoubles)
+{
+  const int N = sizeof(lineReaderDoubleTokens)/sizeof(const char *);
+  LineReaderFile file(lineReaderDoubleTokens, N);
+  for ( int i = 0; i < N; ++i ) {
+    BOOST_REQUIRE(file.reader.readline());
+    std::string rest;
+    bool bad;
+    double ref = lineReaderStrtod(file.lines[i], rest, bad);
+    double d = 0.0;
+    file.reader >> d;
+    BOOST_TEST_CONTEXT("reading the double '" << lineReaderDoubleTokens[i] << "'") {
+      BOOST_CHECK_EQUAL(!file.reader, bad);
+      if ( !bad ) {
+	BOOST_CHECK(lineReaderSame(d, ref));
+	BOOST_CHECK_EQUAL(file.rest(), rest);
+      }
+    }
+    file.reader.resetline();
+    float f = 0.0f;
+    file.reader >> f;
+    BOOST_TEST_CONTEXT("reading the float '" << lineReaderDoubleTokens[i] << "'") {
+      BOOST_CHECK_EQUAL(!file.reader, bad);
+      if ( !bad ) {
+	BOOST_CHECK(lineReaderSame(f, float(ref)));
+	BOOST_CHECK_EQUAL(file.rest(), rest);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(lineReaderIntegers)
+{
+  const int N = sizeof(lineReaderIntegerTokens)/sizeof(const char *);
+  LineReaderFile file(lineReaderIntegerTokens, N);
+  for ( int i = 0; i < N; ++i ) {
+    BOOST_REQUIRE(file.reader.readline());
+    const char * s = file.lines[i].c_str();
+    char * end;
+    BOOST_TEST_CONTEXT("reading '" << lineReaderIntegerTokens[i] << "'") {
+      long l = 0;
+      long refl = std::strtol(s, &end, 0);
+      file.reader >> l;
+      BOOST_CHECK_EQUAL(!file.reader, end == s);
+      if ( end != s ) {
+	BOOST_CHECK_EQUAL(l, refl);
+	BOOST_CHECK_EQUAL(file.rest(), std::string(end));
+      }
+
+      file.reader.resetline();
+      int n = 0;
+      file.reader >> n;
+      BOOST_CHECK_EQUAL(!file.reader, end == s);
+      if ( end != s ) BOOST_CHECK_EQUAL(n, int(refl));
+
+      file.reader.resetline();
+      unsigned long u = 0;
+      unsigned long refu = std::strtoul(s, &end, 0);
+      file.reader >> u;
+      BOOST_CHECK_EQUAL(!file.reader, end == s);
+      if ( end != s ) {
+	BOOST_CHECK_EQUAL(u, refu);
+	BOOST_CHECK_EQUAL(file.rest(), std::string(end));
+      }
+
+      file.reader.resetline();
+      unsigned int ui = 0;
+      file.reader >> ui;
+      BOOST_CHECK_EQUAL(!file.reader, end == s);
+      if ( end != s ) BOOST_CHECK_EQUAL(ui, (unsigned int)(refu));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,171 @@
+// -*- C++ -*-
+//
+// repositoryTestFlatSet.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_Repository_Test_FlatSet_H
+#define ThePEG_Repository_Test_FlatSet_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/Utilities/FlatSet.h"
+#include "ThePEG/Repository/UseRandom.h"
+#include <set>
+#include <vector>
+
+namespace {
+
+/*
+ * Check that a FlatSet and a std::set have the same objects in the
+ * same order, both forwards and backwards.
+ */
+template <typename T, typename Cmp>
+void flatSetSame(const ThePEG::FlatSet<T,Cmp> & f, const std::set<T,Cmp> & s) {
+  BOOST_REQUIRE_EQUAL(f.size(), s.size());
+  BOOST_CHECK_EQUAL(f.empty(), s.empty());
+  BOOST_CHECK(std::equal(f.begin(), f.end(), s.begin()));
+  BOOST_CHECK(std::equal(f.rbegin(), f.rend(), s.rbegin()));
+}
+
+/*
+ * Apply the same random operations to a FlatSet and a std::set with
+ * keys in [0, \a range) and check that they give the same results.
+ */
+template <typename Cmp>
+void flatSetRandom(int range, int nops) {
+  using ThePEG::UseRandom;
+  typedef ThePEG::FlatSet<int,Cmp> FSet;
+  typedef std::set<int,Cmp> SSet;
+  FSet f;
+  SSet s;
+  for ( int iop = 0; iop < nops; ++iop ) {
+    int k = UseRandom::irnd(range);
+    switch ( UseRandom::irnd(8) ) {
+    case 0:
+    case 1: {
+      std::pair<typename FSet::iterator,bool> rf = f.insert(k);
+      std::pair<typename SSet::iterator,bool> rs = s.insert(k);
+      BOOST_CHECK_EQUAL(rf.second, rs.second);
+      BOOST_CHECK_EQUAL(*rf.first, *rs.first);
+      break;
+    }
+    case 2: {
+      // Insert with a hint and insert in increasing order, which is
+      // the fast path.
+      BOOST_CHECK_EQUAL(*f.insert(f.end(), k), *s.insert(s.end(), k));
+      if ( !s.empty() ) {
+	int last = *s.rbegin();
+	int next = f.key_comp()(last, last + 1)? last + 1: last - 1;
+	f.insert(next);
+	s.insert(next);
+      }
+      break;
+    }
+    case 3:
+      BOOST_CHECK_EQUAL(f.erase(k), s.erase(k));
+      break;
+    case 4: {
+      // Erase the object found by lower_bound(), if any.
+      typename FSet::iterator itf = f.lower_bound(k);
+      typename SSet::iterator its = s.lower_bound(k);
+      BOOST_REQUIRE_EQUAL(itf == f.end(), its == s.end());
+      if ( itf == f.end() ) break;
+      BOOST_CHECK_EQUAL(*itf, *its);
+      itf = f.erase(itf);
+      s.erase(its++);
+      BOOST_REQUIRE_EQUAL(itf == f.end(), its == s.end());
+      if ( itf != f.end() ) BOOST_CHECK_EQUAL(*itf, *its);
+      break;
+    }
+    case 5: {
+      // Erase a range given by two bounds.
+      int k2 = UseRandom::irnd(range);
+      if ( f.key_comp()(k2, k) ) std::swap(k, k2);
+      typename FSet::iterator itf =
+	f.erase(f.lower_bound(k), f.upper_bound(k2));
+      typename SSet::iterator its =
+	s.lower_bound(k);
+      s.erase(its, s.upper_bound(k2));
+      its = s.upper_bound(k2);
+      BOOST_REQUIRE_EQUAL(itf == f.end(), its == s.end());
+      if ( itf != f.end() ) BOOST_CHECK_EQUAL(*itf, *its);
+      break;
+    }
+    case 6: {
+      // Insert a range, with duplicates.
+      std::vector<int> v;
+      for ( int i = 0, N = UseRandom::irnd(10); i < N; ++i )
+	v.push_back(UseRandom::irnd(range));
+      f.insert(v.begin(), v.end());
+      s.insert(v.begin(), v.end());
+      break;
+    }
+    default:
+      if ( UseRandom::irnd(50) == 0 ) {
+	f.clear();
+	s.clear();
+      }
+    }
+    flatSetSame(f, s);
+
+    // Lookups.
+    BOOST_CHECK_EQUAL(f.count(k), s.count(k));
+    BOOST_CHECK_EQUAL(f.find(k) == f.end(), s.find(k) == s.end());
+    BOOST_CHECK_EQUAL(std::distance(f.begin(), f.lower_bound(k)),
+		      std::distance(s.begin(), s.lower_bound(k)));
+    BOOST_CHECK_EQUAL(std::distance(f.begin(), f.upper_bound(k)),
+		      std::distance(s.begin(), s.upper_bound(k)));
+    BOOST_CHECK_EQUAL(std::distance(f.equal_range(k).first,
+				    f.equal_range(k).second),
+		      std::distance(s.equal_range(k).first,
+				    s.equal_range(k).second));
+  }
+
+  // Construction from a range, copying, swapping and comparison.
+  FSet f2(s.begin(), s.end());
+  BOOST_CHECK(f2 == f);
+  FSet f3(s.rbegin(), s.rend());
+  BOOST_CHECK(f3 == f);
+  FSet f4;
+  f4.swap(f3);
+  BOOST_CHECK(f3.empty());
+  BOOST_CHECK(f4 == f);
+  f4.insert(range);
+  BOOST_CHECK(f4 != f);
+}
+
+}
+
+/*
+ * Start of boost unit tests for FlatSet.h
+ *
+ */
+BOOST_AUTO_TEST_SUITE(repositoryFlatSet)
+
+BOOST_AUTO_TEST_CASE(flatSetLikeStdSet)
+{
+  // Few keys give many duplicates, many keys give large sets.
+  flatSetRandom< std::less<int> >(20, 5000);
+  flatSetRandom< std::less<int> >(2000, 20000);
+  flatSetRandom< std::greater<int> >(20, 5000);
+  flatSetRandom< std::greater<int> >(2000, 20000);
+}
+
+BOOST_AUTO_TEST_CASE(flatSetInvalidation)
+{
+  // Erasing while iterating, using the returned iterator, is safe.
+  ThePEG::FlatSet<int> f;
+  for ( int i = 0; i < 100; ++i ) f.insert(i);
+  for ( ThePEG::FlatSet<int>::iterator it = f.begin(); it != f.end(); )
+    it = *it%3? f.erase(it): ++it;
+  BOOST_REQUIRE_EQUAL(f.size(), 34u);
+  for ( ThePEG::FlatSet<int>::iterator it = f.begin(); it != f.end(); ++it )
+    BOOST_CHECK_EQUAL(*it%3, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,195 @@
+// -*- C++ -*-
+//
+// repositoryTestMemoryPool.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_Repository_Test_MemoryPool_H
+#define ThePEG_Repository_Test_MemoryPool_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/Utilities/MemoryPool.h"
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <set>
+#include <vector>
+
+namespace {
+
+/*
+ * A small class allocated from a pool.
+ */
+struct PoolTestSmall {
+  PoolTestSmall(int i = 0) : a(i), b(0.5*i) {}
+  int a;
+  double b;
+  ThePEG_DECLARE_POOL_ALLOCATION(PoolTestSmall)
+};
+
+/*
+ * A class with a larger alignment than the global operator new
+ * guarantees, allocated from a pool.
+ */
+struct alignas(64) PoolTestAligned {
+  PoolTestAligned(int i = 0) : a(i) {}
+  virtual ~PoolTestAligned() {}
+  int a;
+  ThePEG_DECLARE_POOL_ALLOCATION(PoolTestAligned)
+};
+
+/*
+ * A derived class with another size, which is allocated with the
+ * global operator new by the base class allocation functions.
+ */
+struct PoolTestDerived: public PoolTestAligned {
+  PoolTestDerived(int i = 0) : PoolTestAligned(i) {
+    for ( int j = 0; j < 100; ++j ) extra[j] = char(i + j);
+  }
+  char extra[100];
+};
+
+/*
+ * An over-aligned key for node-based containers.
+ */
+struct alignas(32) PoolTestKey {
+  PoolTestKey(int i = 0) : a(i) {}
+  bool operator<(const PoolTestKey & k) const { return a < k.a; }
+  int a;
+};
+
+bool poolAligned(const void * p, std::size_t a) {
+  return reinterpret_cast<std::uintptr_t>(p)%a == 0;
+}
+
+/*
+ * Allocate \a n objects of type T with new, check their alignment
+ * and that they do not overlap, and delete them again. The addresses
+ * are returned.
+ */
+template <typename T>
+std::set<const void *> poolNewDelete(int n) {
+  std::vector<T *> v;
+  std::set<const void *> addresses;
+  for ( int i = 0; i < n; ++i ) {
+    v.push_back(new T(i));
+    addresses.insert(v.back());
+    BOOST_CHECK(poolAligned(v.back(), alignof(T)));
+    BOOST_CHECK(poolAligned(v.back(), alignof(std::max_align_t)));
+  }
+  BOOST_CHECK_EQUAL(addresses.size(), std::size_t(n));
+  for ( int i = 0; i < n; ++i ) BOOST_CHECK_EQUAL(v[i]->a, i);
+  for ( int i = 0; i < n; ++i ) delete v[i];
+  return addresses;
+}
+
+}
+
+/*
+ * Start of boost unit tests for MemoryPool.h
+ *
+ */
+BOOST_AUTO_TEST_SUITE(repositoryMemoryPool)
+
+BOOST_AUTO_TEST_CASE(memoryPoolReuse)
+{
+  // Blocks are distinct, aligned and reused after they are released.
+  typedef ThePEG::MemoryPool<1000> Pool;
+  const int n = 200;
+  std::vector<void *> v;
+  std::set<void *> first;
+  for ( int i = 0; i < n; ++i ) {
+    v.push_back(Pool::allocate(1000));
+    first.insert(v.back());
+    BOOST_CHECK(poolAligned(v.back(), alignof(std::max_align_t)));
+    std::fill_n(static_cast<char *>(v.back()), 1000, char(i));
+  }
+  BOOST_CHECK_EQUAL(first.size(), std::size_t(n));
+  for ( int i = 0; i < n; ++i )
+    BOOST_CHECK_EQUAL(static_cast<char *>(v[i])[999], char(i));
+  for ( int i = 0; i < n; ++i ) Pool::deallocate(v[i], 1000);
+  std::set<void *> second;
+  for ( int i = 0; i < n; ++i ) second.insert(Pool::allocate(1000));
+  BOOST_CHECK(first == second);
+  for ( void * p : second ) Pool::deallocate(p, 1000);
+
+  // Other sizes are passed on to the global operators.
+  void * p = Pool::allocate(10);
+  BOOST_CHECK(!first.count(p));
+  Pool::deallocate(p, 10);
+  Pool::deallocate(0, 1000);
+}
+
+BOOST_AUTO_TEST_CASE(memoryPoolObjects)
+{
+  // Allocate more than one chunk of objects, twice.
+  std::set<const void *> a1 = poolNewDelete<PoolTestSmall>(10000);
+  std::set<const void *> a2 = poolNewDelete<PoolTestSmall>(10000);
+#ifndef ThePEG_NO_MEMORY_POOL
+  BOOST_CHECK(a1 == a2);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(memoryPoolOverAligned)
+{
+  BOOST_REQUIRE_GT(alignof(PoolTestAligned), alignof(std::max_align_t));
+  std::set<const void *> a1 = poolNewDelete<PoolTestAligned>(3000);
+  std::set<const void *> a2 = poolNewDelete<PoolTestAligned>(3000);
+#ifndef ThePEG_NO_MEMORY_POOL
+  BOOST_CHECK(a1 == a2);
+#endif
+
+  // Derived objects of another size, deleted through the base class.
+  std::vector<PoolTestAligned *> v;
+  for ( int i = 0; i < 100; ++i ) {
+    v.push_back(new PoolTestDerived(i));
+    BOOST_CHECK(poolAligned(v.back(), alignof(PoolTestDerived)));
+  }
+  for ( int i = 0; i < 100; ++i ) {
+    BOOST_CHECK_EQUAL(v[i]->a, i);
+    BOOST_CHECK_EQUAL(static_cast<PoolTestDerived *>(v[i])->extra[99],
+		      char(i + 99));
+    delete v[i];
+  }
+}
+
+BOOST_AUTO_TEST_CASE(memoryPoolAllocator)
+{
+  // Node-based containers of normal and over-aligned types.
+  std::set<int, std::less<int>, ThePEG::PoolAllocator<int> > s;
+  std::set<int> ref;
+  for ( int i = 0; i < 5000; ++i ) {
+    int k = (i*7919)%3001;
+    s.insert(k);
+    ref.insert(k);
+    if ( i%3 == 0 ) {
+      s.erase((k*13)%3001);
+      ref.erase((k*13)%3001);
+    }
+  }
+  BOOST_CHECK(std::equal(s.begin(), s.end(), ref.begin()));
+  BOOST_CHECK_EQUAL(s.size(), ref.size());
+
+  std::list<PoolTestKey, ThePEG::PoolAllocator<PoolTestKey> > l;
+  for ( int i = 0; i < 3000; ++i ) {
+    l.push_back(PoolTestKey(i));
+    BOOST_CHECK(poolAligned(&l.back(), alignof(PoolTestKey)));
+  }
+  int i = 0;
+  for ( const PoolTestKey & k : l ) BOOST_CHECK_EQUAL(k.a, i++);
+
+  // Several objects at once are allocated with the global operators,
+  // with the same alignment.
+  ThePEG::PoolAllocator<PoolTestAligned> alloc;
+  PoolTestAligned * p = alloc.allocate(5);
+  BOOST_CHECK(poolAligned(p, alignof(PoolTestAligned)));
+  alloc.deallocate(p, 5);
+  BOOST_CHECK(alloc == ThePEG::PoolAllocator<int>());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,342 @@
+// -*- C++ -*-
+//
+// repositoryTestPersistent.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_Repository_Test_Persistent_H
+#define ThePEG_Repository_Test_Persistent_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
+#include "ThePEG/Utilities/DescribeClass.h"
+#include <sstream>
+#include <limits>
+#include <climits>
+#include <cmath>
+
+namespace {
+
+/*
+ * A small persistent class used to build object graphs. If extras is
+ * set, persistentOutput() writes some additional fields of all basic
+ * types, which persistentInput() only reads if readExtras is set. If
+ * they are not read, PersistentIStream has to skip them.
+ */
+class PersistentTestNode: public ThePEG::Base {
+
+public:
+
+  typedef ThePEG::Ptr<PersistentTestNode>::pointer NodePtr;
+
+  PersistentTestNode(): number(0), value(0.0), extras(false) {}
+
+  void persistentOutput(ThePEG::PersistentOStream & os) const {
+    os << number << value << label << children << extras;
+    if ( extras )
+      os << -4711 << 300u << -1.0e-300 << 2.5f << std::string("a|b\n{c}\\d")
+	 << '|' << true << std::vector<double>(3, 0.5) << std::string("end");
+  }
+
+  void persistentInput(ThePEG::PersistentIStream & is, int) {
+    is >> number >> value >> label >> children >> extras;
+    if ( extras && readExtras() ) {
+      int i;
+      unsigned int u;
+      double d;
+      float f;
+      std::string s;
+      char c;
+      bool b;
+      std::vector<double> v;
+      is >> i >> u >> d >> f >> s >> c >> b >> v >> s;
+      BOOST_CHECK_EQUAL(i, -4711);
+      BOOST_CHECK_EQUAL(u, 300u);
+      BOOST_CHECK_EQUAL(d, -1.0e-300);
+      BOOST_CHECK_EQUAL(f, 2.5f);
+      BOOST_CHECK_EQUAL(c, '|');
+      BOOST_CHECK(b);
+      BOOST_CHECK_EQUAL(v.size(), 3u);
+      BOOST_CHECK_EQUAL(s, "end");
+    }
+  }
+
+  static void Init() {}
+
+  static bool & readExtras() {
+    static bool read = true;
+    return read;
+  }
+
+  long number;
+  double value;
+  std::string label;
+  std::vector<NodePtr> children;
+  bool extras;
+
+};
+
+ThePEG::DescribeClass<PersistentTestNode,ThePEG::Base>
+describePersistentTestNode("ThePEG::PersistentTestNode", "");
+
+/*
+ * Write something to a string in the given format.
+ */
+template <typename F>
+std::string persistentWrite(bool binary, F f) {
+  std::ostringstream os;
+  {
+    ThePEG::PersistentOStream pos(os, std::vector<std::string>(), binary);
+    f(pos);
+    BOOST_CHECK(pos.good());
+  }
+  return os.str();
+}
+
+/*
+ * Integers of all sizes around the varint byte boundaries.
+ */
+const long persistentLongs[] = {
+  0L, 1L, -1L, 63L, -64L, 64L, -65L, 127L, 128L, -128L, -129L,
+  8191L, 8192L, 16383L, 16384L, -16384L, 2097151L, 2097152L,
+  INT_MAX, INT_MIN, long(INT_MAX) + 1L, long(INT_MIN) - 1L,
+  LONG_MAX, LONG_MIN, LONG_MIN + 1L
+};
+
+const unsigned long persistentULongs[] = {
+  0UL, 1UL, 127UL, 128UL, 16383UL, 16384UL, UINT_MAX, ULONG_MAX,
+  ULONG_MAX - 1UL
+};
+
+const double persistentDoubles[] = {
+  0.0, -0.0, 1.0, -1.0, 1.0/3.0, -2.0/3.0, 1.0e-300, -1.0e300,
+  std::numeric_limits<double>::min(), std::numeric_limits<double>::max(),
+  std::numeric_limits<double>::lowest(), std::numeric_limits<double>::epsilon(),
+  91.1876, 4.0e12
+};
+
+/*
+ * The double \a d converted to a float, or zero if it is out of
+ * range.
+ */
+float persistentFloat(double d) {
+  return std::abs(d) < std::numeric_limits<float>::max()? float(d): 0.0f;
+}
+
+/*
+ * Strings with all the characters used as markers in the text
+ * format, with NUL characters and with more than 127 characters.
+ */
+std::vector<std::string> persistentStrings() {
+  std::vector<std::string> ret;
+  ret.push_back("");
+  ret.push_back("plain");
+  ret.push_back("a|b");
+  ret.push_back("line\nbreak\n");
+  ret.push_back("{nested}");
+  ret.push_back("back\\slash\\n");
+  ret.push_back("\n");
+  ret.push_back(std::string("nul\0inside", 10));
+  ret.push_back(std::string(3, '\0'));
+  ret.push_back("yn|}{\\\nYNISDFCU");
+  ret.push_back(std::string(300, 'x') + "|\n");
+  return ret;
+}
+
+}
+
+/*
+ * Start of boost unit tests for the PersistentOStream and
+ * PersistentIStream classes.
+ *
+ */
+BOOST_AUTO_TEST_SUITE(repositoryPersistent)
+
+BOOST_AUTO_TEST_CASE(persistentScalars)
+{
+  using namespace ThePEG;
+  const int nl = sizeof(persistentLongs)/sizeof(long);
+  const int nu = sizeof(persistentULongs)/sizeof(unsigned long);
+  const int nd = sizeof(persistentDoubles)/sizeof(double);
+  const std::vector<std::string> strings = persistentStrings();
+  const char chars[] = { 'a', '|', '\n', '{', '}', '\\', '\0', 'n', 'I' };
+  const int nc = sizeof(chars);
+
+  std::string data[2];
+  for ( int ib = 0; ib < 2; ++ib )
+    data[ib] = persistentWrite(ib, [&](PersistentOStream & os) {
+	for ( int i = 0; i < nl; ++i )
+	  os << persistentLongs[i] << int(persistentLongs[i])
+	     << short(persistentLongs[i]);
+	for ( int i = 0; i < nu; ++i )
+	  os << persistentULongs[i] << (unsigned int)(persistentULongs[i])
+	     << (unsigned short)(persistentULongs[i]);
+	for ( int i = 0; i < nd; ++i )
+	  os << persistentDoubles[i] << persistentFloat(persistentDoubles[i]);
+	for ( int i = 0, N = strings.size(); i < N; ++i ) os << strings[i];
+	for ( int i = 0; i < nc; ++i ) os << chars[i];
+	os << true << false << strings << std::vector<long>(persistentLongs,
+							     persistentLongs + nl);
+      });
+
+  // The binary format should be considerably more compact.
+  BOOST_CHECK_LT(data[1].size(), data[0].size());
+
+  for ( int ib = 0; ib < 2; ++ib ) {
+    std::istringstream is(data[ib]);
+    PersistentIStream pis(is);
+    BOOST_CHECK_EQUAL(pis.binary(), bool(ib));
+    for ( int i = 0; i < nl; ++i ) {
+      long l;
+      int n;
+      short s;
+      pis >> l >> n >> s;
+      BOOST_CHECK_EQUAL(l, persistentLongs[i]);
+      BOOST_CHECK_EQUAL(n, int(persistentLongs[i]));
+      BOOST_CHECK_EQUAL(s, short(persistentLongs[i]));
+    }
+    for ( int i = 0; i < nu; ++i ) {
+      unsigned long l;
+      unsigned int n;
+      unsigned short s;
+      pis >> l >> n >> s;
+      BOOST_CHECK_EQUAL(l, persistentULongs[i]);
+      BOOST_CHECK_EQUAL(n, (unsigned int)(persistentULongs[i]));
+      BOOST_CHECK_EQUAL(s, (unsigned short)(persistentULongs[i]));
+    }
+    for ( int i = 0; i < nd; ++i ) {
+      double d;
+      float f;
+      pis >> d >> f;
+      BOOST_CHECK_EQUAL(d, persistentDoubles[i]);
+      BOOST_CHECK_EQUAL(std::signbit(d), std::signbit(persistentDoubles[i]));
+      BOOST_CHECK_EQUAL(f, persistentFloat(persistentDoubles[i]));
+    }
+    for ( int i = 0, N = strings.size(); i < N; ++i ) {
+      std::string s;
+      pis >> s;
+      BOOST_CHECK_EQUAL(s.size(), strings[i].size());
+      BOOST_CHECK(s == strings[i]);
+    }
+    for ( int i = 0; i < nc; ++i ) {
+      char c;
+      pis >> c;
+      BOOST_CHECK_EQUAL(int(c), int(chars[i]));
+    }
+    bool yes = false;
+    bool no = true;
+    std::vector<std::string> sv;
+    std::vector<long> lv;
+    pis >> yes >> no >> sv >> lv;
+    BOOST_CHECK(yes);
+    BOOST_CHECK(!no);
+    BOOST_CHECK(sv == strings);
+    BOOST_CHECK(lv == std::vector<long>(persistentLongs, persistentLongs + nl));
+    BOOST_CHECK(pis.good());
+  }
+}
+
+/*
+ * Neither format can represent NaN or infinity.
+ */
+BOOST_AUTO_TEST_CASE(persistentNonFinite)
+{
+  using namespace ThePEG;
+  const double bad[] = { std::numeric_limits<double>::quiet_NaN(),
+			 std::numeric_limits<double>::infinity(),
+			 -std::numeric_limits<double>::infinity() };
+  for ( int ib = 0; ib < 2; ++ib )
+    for ( int i = 0; i < 3; ++i ) {
+      std::ostringstream os;
+      PersistentOStream pos(os, std::vector<std::string>(), ib);
+      int nthrown = 0;
+      try { pos << bad[i]; }
+      catch ( Exception & e ) { e.handle(); ++nthrown; }
+      try { pos << float(bad[i]); }
+      catch ( Exception & e ) { e.handle(); ++nthrown; }
+      BOOST_CHECK_EQUAL(nthrown, 2);
+    }
+}
+
+/*
+ * A small graph where two nodes share a child, and where the fields
+ * written by the nodes are read or skipped.
+ */
+BOOST_AUTO_TEST_CASE(persistentObjectGraph)
+{
+  using namespace ThePEG;
+  typedef PersistentTestNode::NodePtr NodePtr;
+
+  NodePtr root = new_ptr(PersistentTestNode());
+  NodePtr left = new_ptr(PersistentTestNode());
+  NodePtr right = new_ptr(PersistentTestNode());
+  NodePtr leaf = new_ptr(PersistentTestNode());
+  root->number = -1;
+  root->value = 1.0/7.0;
+  root->label = "root|\n";
+  root->children.push_back(left);
+  root->children.push_back(right);
+  root->children.push_back(NodePtr());
+  left->number = 1L << 40;
+  left->label = std::string("le\0ft", 5);
+  left->children.push_back(leaf);
+  left->extras = true;
+  right->number = -300;
+  right->value = -2.5e-12;
+  right->label = "{right}";
+  right->children.push_back(leaf);
+  leaf->number = 42;
+  leaf->label = "leaf";
+  leaf->extras = true;
+
+  std::string data[2];
+  for ( int ib = 0; ib < 2; ++ib )
+    data[ib] = persistentWrite(ib, [&](PersistentOStream & os) {
+	os << root << 17 << std::string("after");
+      });
+
+  for ( int skip = 0; skip < 2; ++skip ) {
+    PersistentTestNode::readExtras() = !skip;
+    for ( int ib = 0; ib < 2; ++ib ) {
+      std::istringstream is(data[ib]);
+      PersistentIStream pis(is);
+      NodePtr r;
+      int i = 0;
+      std::string s;
+      pis >> r >> i >> s;
+      BOOST_CHECK(pis.good());
+      BOOST_CHECK_EQUAL(i, 17);
+      BOOST_CHECK_EQUAL(s, "after");
+      BOOST_REQUIRE(r);
+      BOOST_CHECK_EQUAL(r->number, root->number);
+      BOOST_CHECK_EQUAL(r->value, root->value);
+      BOOST_CHECK_EQUAL(r->label, root->label);
+      BOOST_REQUIRE_EQUAL(r->children.size(), 3u);
+      BOOST_CHECK(!r->children[2]);
+      NodePtr l = r->children[0];
+      NodePtr rr = r->children[1];
+      BOOST_REQUIRE(l && rr);
+      BOOST_CHECK_EQUAL(l->number, left->number);
+      BOOST_CHECK(l->label == left->label);
+      BOOST_CHECK(l->extras);
+      BOOST_CHECK_EQUAL(rr->number, right->number);
+      BOOST_CHECK_EQUAL(rr->value, right->value);
+      BOOST_CHECK_EQUAL(rr->label, right->label);
+      BOOST_REQUIRE_EQUAL(l->children.size(), 1u);
+      BOOST_REQUIRE_EQUAL(rr->children.size(), 1u);
+      // The shared child is only read once.
+      BOOST_CHECK(l->children[0] == rr->children[0]);
+      BOOST_CHECK_EQUAL(l->children[0]->number, 42);
+      BOOST_CHECK_EQUAL(l->children[0]->label, "leaf");
+    }
+  }
+  PersistentTestNode::readExtras() = true;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
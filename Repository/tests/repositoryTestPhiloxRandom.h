@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//
+// repositoryTestPhiloxRandom.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_Repository_Test_PhiloxRandom_H
+#define ThePEG_Repository_Test_PhiloxRandom_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "ThePEG/Repository/PhiloxRandom.h"
+
+/*
+ * Start of boost unit tests for PhiloxRandom.h
+ *
+ */
+BOOST_AUTO_TEST_SUITE(repositoryPhiloxRandom)
+
+/*
+ * Known answer tests from the Random123 distribution
+ */
+BOOST_AUTO_TEST_CASE(philoxKnownAnswers)
+{
+  ThePEG::PhiloxRandom::Word zero[4] = { 0, 0, 0, 0 };
+  ThePEG::PhiloxRandom::philox(zero, 0, 0);
+  BOOST_CHECK_EQUAL(zero[0], 0x6627e8d5u);
+  BOOST_CHECK_EQUAL(zero[1], 0xe169c58du);
+  BOOST_CHECK_EQUAL(zero[2], 0xbc57ac4cu);
+  BOOST_CHECK_EQUAL(zero[3], 0x9b00dbd8u);
+
+  ThePEG::PhiloxRandom::Word pi[4] =
+    { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 };
+  ThePEG::PhiloxRandom::philox(pi, 0xa4093822, 0x299f31d0);
+  BOOST_CHECK_EQUAL(pi[0], 0xd16cfe09u);
+  BOOST_CHECK_EQUAL(pi[1], 0x94fdccebu);
+  BOOST_CHECK_EQUAL(pi[2], 0x5001e420u);
+  BOOST_CHECK_EQUAL(pi[3], 0x24126ea1u);
+}
+
+BOOST_AUTO_TEST_CASE(philoxZeroToOne)
+{
+  int N = 1000;
+  ThePEG::PhiloxRandom rng;
+  DoubleBinCheck posRange(0, 1);
+  DoubleBinCheck quarter1(0, 0.25);
+  for(int i = 0; i < N; ++i) {
+    double r = rng.rnd();
+    BOOST_CHECK(r > 0.0 && r < 1.0);
+    posRange.add(r);
+    quarter1.add(r);
+  }
+  BOOST_CHECK_EQUAL(posRange.in(), N);
+  BOOST_CHECK_CLOSE(quarter1.in(), 0.25 * N, 10);
+}
+
+/*
+ * The sequence for a given event and stream must not depend on what
+ * was generated before.
+ */
+BOOST_AUTO_TEST_CASE(philoxEventStreams)
+{
+  int N = 2500;
+  ThePEG::PhiloxRandom a;
+  ThePEG::PhiloxRandom b;
+  a.setSeed(4711);
+  b.setSeed(4711);
+
+  for(int i = 0; i < N; ++i) a.rnd();
+  BOOST_CHECK(a.setStream(42, 3));
+  BOOST_CHECK(b.setStream(42, 3));
+  BOOST_CHECK_EQUAL(a.event(), 42);
+  BOOST_CHECK_EQUAL(a.stream(), 3);
+  for(int i = 0; i < N; ++i) BOOST_CHECK_EQUAL(a.rnd(), b.rnd());
+
+  // Different events, streams or seeds give different sequences.
+  a.setStream(42, 3);
+  b.setStream(43, 3);
+  BOOST_CHECK(a.rnd() != b.rnd());
+  a.setStream(42, 3);
+  b.setStream(42, 4);
+  BOOST_CHECK(a.rnd() != b.rnd());
+  a.setStream(42, 3);
+  b.setSeed(4712);
+  b.setStream(42, 3);
+  BOOST_CHECK(a.rnd() != b.rnd());
+}
+
+/*
+ * End of boost unit tests for PhiloxRandom.h
+ *
+ */
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
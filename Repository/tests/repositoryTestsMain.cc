@@ -26,6 +26,11 @@
  * Include here the sub tests
  */
 #include "ThePEG/Repository/tests/repositoryTestRandomGenerator.h"
+#include "ThePEG/Repository/tests/repositoryTestPhiloxRandom.h"
+#include "ThePEG/Repository/tests/repositoryTestPersistent.h"
+#include "ThePEG/Repository/tests/repositoryTestCFileLineReader.h"
+#include "ThePEG/Repository/tests/repositoryTestFlatSet.h"
+#include "ThePEG/Repository/tests/repositoryTestMemoryPool.h"
 
 
 /**
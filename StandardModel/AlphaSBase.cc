@@ -25,6 +25,13 @@ void AlphaSBase::doinit() {
   RunningCoupling::doinit();
 }
 
+vector<Energy2> AlphaSBase::tableBoundaries() const {
+  vector<Energy2> ret;
+  if ( scaleFactor() <= 0.0 ) return ret;
+  for ( Energy2 t : theFlavourThresholds ) ret.push_back(t/scaleFactor());
+  return ret;
+}
+
 void AlphaSBase::persistentOutput(PersistentOStream & os) const {
   os << ounit(theQuarkMasses,GeV) 
      << ounit(theFlavourThresholds, GeV2) << ounit(theLambdaQCDs, GeV);
@@ -99,6 +99,14 @@ public:
    */
   static void Init();
 
+protected:
+
+  /**
+   * Return the scales where the coupling may not be smooth, which are
+   * the flavour thresholds divided by the scale factor.
+   */
+  virtual vector<Energy2> tableBoundaries() const;
+
 protected:
 
   /** @name Standard Interfaced functions. */
@@ -34,6 +34,13 @@ double O1AlphaS::value(Energy2 scale, const StandardModelBase &) const {
 		  log(max(theScale, sqr(Q0))/sqr(LambdaQCD(Nf(theScale)))));
 }
 
+vector<Energy2> O1AlphaS::tableBoundaries() const {
+  vector<Energy2> ret = AlphaSBase::tableBoundaries();
+  if ( scaleFactor() > 0.0 && Q0 > ZERO )
+    ret.push_back(sqr(Q0)/scaleFactor());
+  return ret;
+}
+
 vector<Energy2> O1AlphaS::flavourThresholds() const {
   if ( !quarkMasses().empty() ) {
     int nMasses = quarkMasses().size();
@@ -96,6 +96,15 @@ public:
    */
   static void Init();
 
+protected:
+
+  /**
+   * Return the scales where the coupling may not be smooth, which are
+   * the flavour thresholds and the freeze scale divided by the scale
+   * factor.
+   */
+  virtual vector<Energy2> tableBoundaries() const;
+
 protected:
 
   /** @name Clone Methods. */
@@ -12,6 +12,7 @@
 //
 
 #include "RunningCoupling.h"
+#include "StandardModelBase.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
 #include "ThePEG/Interface/Parameter.h"
 
@@ -22,12 +23,94 @@ using namespace ThePEG;
 
 AbstractClassDescription<RunningCoupling> RunningCoupling::initRunningCoupling;
 
+void RunningCoupling::values(const Energy2 * scales, double * result,
+			     std::size_t n) const {
+  const StandardModelBase & sm = *(generator()->standardModel());
+  for ( std::size_t i = 0; i < n; ++i ) result[i] = tableValue(scales[i], sm);
+}
+
+void RunningCoupling::doinitrun() {
+  Interfaced::doinitrun();
+  theTable.clear();
+  theTableSM = 0;
+  theTableWanted = theTableSize > 0 && theTableMaxScale > theTableMinScale;
+}
+
+bool RunningCoupling::setupTable(const StandardModelBase & sm) const {
+  // The table is built the first time the coupling is used in a run,
+  // so that sub-classes and the standard model object have finished
+  // their own run initialization.
+  theTableWanted = false;
+  int n = theTableSize;
+  double dev = buildTable(n, sm);
+  for ( int i = 0; i < 4 && dev > theTableTolerance; ++i )
+    dev = buildTable(n *= 2, sm);
+  if ( dev <= theTableTolerance ) return true;
+  theTable.clear();
+  theTableSM = 0;
+  generator()->logWarning(
+    TableWarning()
+    << "The running coupling '" << name() << "' could not be tabulated "
+    << "with a relative precision of " << theTableTolerance << " using "
+    << n << " points (the largest deviation was " << dev << "). The exact "
+    << "values will be used instead." << Exception::warning);
+  return false;
+}
+
+double RunningCoupling::buildTable(int n, const StandardModelBase & sm) const {
+  theTable.clear();
+  Energy2 lo = sqr(theTableMinScale);
+  Energy2 hi = sqr(theTableMaxScale);
+  vector<Energy2> limits = tableBoundaries();
+  limits.push_back(lo);
+  limits.push_back(hi);
+  std::sort(limits.begin(), limits.end());
+  limits.erase(std::unique(limits.begin(), limits.end()), limits.end());
+  double ltot = log(hi/lo);
+  double maxdev = 0.0;
+  for ( int k = 0, N = limits.size(); k + 1 < N; ++k ) {
+    if ( limits[k] < lo || limits[k + 1] > hi ) continue;
+    TableSegment s;
+    s.lo = limits[k];
+    s.hi = limits[k + 1];
+    double len = log(s.hi/s.lo);
+    int m = std::max(4, int(std::ceil(n*len/ltot)));
+    double dl = len/m;
+    s.lmin = log(s.lo/GeV2);
+    s.rdl = 1.0/dl;
+    s.y.resize(m);
+    for ( int i = 0; i < m; ++i )
+      s.y[i] = value(exp(s.lmin + (i + 0.5)*dl)*GeV2, sm);
+    // Check at each quarter of an interval and just inside the limits,
+    // where the values are extrapolated.
+    vector<double> check;
+    check.push_back(1.0e-6*dl);
+    for ( int i = 1; i < 4*m; ++i ) check.push_back(0.25*i*dl);
+    check.push_back((m - 1.0e-6)*dl);
+    for ( double l : check ) {
+      Energy2 scale = exp(s.lmin + l)*GeV2;
+      double exact = value(scale, sm);
+      double dev = abs(interpolate(s, scale) - exact);
+      if ( exact != 0.0 ) dev /= abs(exact);
+      maxdev = std::max(maxdev, dev);
+    }
+    theTable.push_back(s);
+  }
+  theTableSM = &sm;
+  return maxdev;
+}
+
 void RunningCoupling::persistentOutput(PersistentOStream & os) const {
-  os << theScaleFactor;
+  os << theScaleFactor << theTableSize << ounit(theTableMinScale, GeV)
+     << ounit(theTableMaxScale, GeV) << theTableTolerance;
 }
 
 void RunningCoupling::persistentInput(PersistentIStream & is, int) {
-  is >> theScaleFactor;
+  is >> theScaleFactor >> theTableSize >> iunit(theTableMinScale, GeV)
+     >> iunit(theTableMaxScale, GeV) >> theTableTolerance;
+  theTable.clear();
+  theTableSM = 0;
+  theTableWanted = false;
 }
 
 void RunningCoupling::Init() {
@@ -43,5 +126,41 @@ void RunningCoupling::Init() {
 
   interfaceScaleFactor.rank(-1);
 
+  static Parameter<RunningCoupling,int> interfaceTableSize
+    ("TableSize",
+     "The number of points used to tabulate the coupling in log(Q^2) "
+     "between TableMinScale and TableMaxScale the first time it is used "
+     "in a run. "
+     "Values at scales inside the table are then obtained by cubic "
+     "interpolation. The number of points is doubled until the "
+     "interpolated values agree with the exact ones within TableTolerance. "
+     "If zero, the coupling is not tabulated.",
+     &RunningCoupling::theTableSize, 0, 0, 0,
+     true, false, Interface::lowerlim);
+
+  static Parameter<RunningCoupling,Energy> interfaceTableMinScale
+    ("TableMinScale",
+     "The square root of the lowest scale in the table (in GeV).",
+     &RunningCoupling::theTableMinScale, GeV, 1.0*GeV, ZERO, ZERO,
+     true, false, Interface::lowerlim);
+
+  static Parameter<RunningCoupling,Energy> interfaceTableMaxScale
+    ("TableMaxScale",
+     "The square root of the highest scale in the table (in GeV).",
+     &RunningCoupling::theTableMaxScale, GeV, 100000.0*GeV, ZERO, ZERO,
+     true, false, Interface::lowerlim);
+
+  static Parameter<RunningCoupling,double> interfaceTableTolerance
+    ("TableTolerance",
+     "The largest relative deviation of the interpolated values from the "
+     "exact ones allowed in the table.",
+     &RunningCoupling::theTableTolerance, 1.0e-6, 0.0, 0.0,
+     true, false, Interface::lowerlim);
+
+  interfaceTableSize.rank(-2);
+  interfaceTableMinScale.rank(-3);
+  interfaceTableMaxScale.rank(-4);
+  interfaceTableTolerance.rank(-5);
+
 }
 
@@ -20,6 +20,16 @@ namespace ThePEG {
  * RunningCoupling an abstract base class unifying the treatment
  * of running couplings in ThePEG.
  *
+ * Optionally, the coupling may be tabulated in \f$\log(Q^2)\f$ the
+ * first time it is used in a run, after the run initialization of
+ * this and all other objects, with separate segments between the scales
+ * returned by tableBoundaries(), where the coupling need not be
+ * smooth. The value(Energy2) and values() functions, and the running
+ * couplings in StandardModelBase, then use cubic interpolation in the
+ * table for scales inside its range. The table is refined until the
+ * interpolated values agree with the exact ones within a given
+ * tolerance.
+ *
  * @see \ref RunningCouplingInterfaces "The interfaces"
  * defined for RunningCoupling.
  * @see StandardModelBase
@@ -31,7 +41,10 @@ public:
   /**
    * The default constructor.
    */
-  RunningCoupling () : theScaleFactor(1.) {}
+  RunningCoupling ()
+    : theScaleFactor(1.), theTableSize(0), theTableMinScale(1.0*GeV),
+      theTableMaxScale(100000.0*GeV), theTableTolerance(1.0e-6),
+      theTableWanted(false), theTableSM(0) {}
 
   /**@name Methods to be implemented by a derived class */
   //@{
@@ -56,9 +69,40 @@ public:
    * StandardModelBase object used by the EventGenerator.
    */
   double value(Energy2 scale) const {
-    return value(scale,*(generator()->standardModel()));
+    return tableValue(scale,*(generator()->standardModel()));
+  }
+
+  /**
+   * Return the value of the coupling at a given \a scale using the
+   * given standard model object, \a sm. If the coupling has been
+   * tabulated for \a sm and the \a scale is inside the table, the
+   * interpolated value is returned. If a table was requested but
+   * not yet built, it is built here for \a sm.
+   */
+  double tableValue(Energy2 scale, const StandardModelBase & sm) const {
+    if ( theTableSM == &sm || ( theTableWanted && setupTable(sm) ) ) {
+      useMe();
+      for ( const TableSegment & s : theTable )
+	if ( scale <= s.hi ) {
+	  if ( scale < s.lo ) break;
+	  return interpolate(s, scale);
+	}
+    }
+    return value(scale,sm);
   }
 
+  /**
+   * Set \a result[i] to the value of the coupling at the scale
+   * \a scales[i] for \a i from zero to \a n - 1, using the
+   * StandardModelBase object used by the EventGenerator.
+   */
+  void values(const Energy2 * scales, double * result, std::size_t n) const;
+
+  /**
+   * Return true if the coupling is currently tabulated.
+   */
+  bool tabulated() const { return theTableSM != 0; }
+
   /**
    * Return an overestimate to the running coupling at the
    * given scale. This is defined to aid veto algorithms
@@ -85,6 +129,17 @@ public:
    */
   double scaleFactor () const { return theScaleFactor; }
 
+protected:
+
+  /**
+   * Return the scales where the coupling may not be smooth, such as
+   * flavour thresholds. Segments of the table will not extend across
+   * these scales. The default version returns an empty vector.
+   */
+  virtual vector<Energy2> tableBoundaries() const {
+    return vector<Energy2>();
+  }
+
 public:
 
   /** @name Functions used by the persistent I/O system. */
@@ -108,6 +163,64 @@ public:
    */
   static void Init();
 
+protected:
+
+  /** @name Standard Interfaced functions. */
+  //@{
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins. Discards any old table, and marks that a new one
+   * should be built when the coupling is first used.
+   */
+  virtual void doinitrun();
+  //@}
+
+private:
+
+  /**
+   * A segment of the table with values at equidistant points in
+   * \f$\log(Q^2)\f$, placed in the middle of equally sized
+   * intervals between the limits.
+   */
+  struct TableSegment {
+    /** The lower limit of the segment. */
+    Energy2 lo;
+    /** The upper limit of the segment. */
+    Energy2 hi;
+    /** The logarithm of the lower limit in units of GeV2. */
+    double lmin;
+    /** The inverse of the size of an interval in the logarithm. */
+    double rdl;
+    /** The values of the coupling. */
+    vector<double> y;
+  };
+
+  /**
+   * Build the table for the standard model object \a sm, refining it
+   * until the required tolerance is reached. Return false, and leave
+   * the coupling untabulated, if this was not possible.
+   */
+  bool setupTable(const StandardModelBase & sm) const;
+
+  /**
+   * Build the table with \a n points in total, using the standard
+   * model object \a sm, and return the largest relative deviation
+   * from the exact values found between the points.
+   */
+  double buildTable(int n, const StandardModelBase & sm) const;
+
+  /**
+   * Return the value interpolated in the segment \a s at \a scale.
+   */
+  static double interpolate(const TableSegment & s, Energy2 scale) {
+    double x = (log(scale/GeV2) - s.lmin)*s.rdl - 0.5;
+    int i = std::max(1, std::min(int(s.y.size()) - 3, int(std::floor(x))));
+    double t = x - i;
+    const double * y = &s.y[i - 1];
+    return ( -y[0]*t*(t - 1.0)*(t - 2.0) + y[3]*(t + 1.0)*t*(t - 1.0) )/6.0 +
+      ( y[1]*(t + 1.0)*(t - 1.0)*(t - 2.0) - y[2]*(t + 1.0)*t*(t - 2.0) )/2.0;
+  }
+
 private:
 
   /**
@@ -126,6 +239,53 @@ private:
    */
   double theScaleFactor;
 
+  /**
+   * The number of points in the table, or zero if the coupling
+   * should not be tabulated.
+   */
+  int theTableSize;
+
+  /**
+   * The square root of the lower limit of the table.
+   */
+  Energy theTableMinScale;
+
+  /**
+   * The square root of the upper limit of the table.
+   */
+  Energy theTableMaxScale;
+
+  /**
+   * The largest relative deviation of the interpolated values from
+   * the exact ones.
+   */
+  double theTableTolerance;
+
+  /**
+   * True if a table has been requested for this run but has not
+   * yet been built.
+   */
+  mutable bool theTableWanted;
+
+  /**
+   * The segments of the table.
+   */
+  mutable vector<TableSegment> theTable;
+
+  /**
+   * The standard model object used to build the table, or null if
+   * there is no table.
+   */
+  mutable const StandardModelBase * theTableSM;
+
+protected:
+
+  /** @cond EXCEPTIONCLASSES */
+  /** Exception class used by RunningCoupling if the table could not
+      be built within the required tolerance. */
+  struct TableWarning: public Exception {};
+  /** @endcond */
+
 };
 
 /** @cond TRAITSPECIALIZATIONS */
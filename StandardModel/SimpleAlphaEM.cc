@@ -44,6 +44,16 @@ double SimpleAlphaEM::value(Energy2 scale, const StandardModelBase & sm) const {
   return alem/(1.0-rpigg);
 }
 
+vector<Energy2> SimpleAlphaEM::tableBoundaries() const {
+  vector<Energy2> ret;
+  if ( scaleFactor() <= 0.0 ) return ret;
+  ret.push_back(2e-6*GeV2/scaleFactor());
+  ret.push_back(0.09*GeV2/scaleFactor());
+  ret.push_back(9.0*GeV2/scaleFactor());
+  ret.push_back(10000.0*GeV2/scaleFactor());
+  return ret;
+}
+
 NoPIOClassDescription<SimpleAlphaEM> SimpleAlphaEM::initSimpleAlphaEM;
 
 void SimpleAlphaEM::Init() {
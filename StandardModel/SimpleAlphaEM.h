@@ -45,6 +45,14 @@ public:
    */
   static void Init();
 
+protected:
+
+  /**
+   * Return the scales where the parameterization changes, divided by
+   * the scale factor.
+   */
+  virtual vector<Energy2> tableBoundaries() const;
+
 protected:
 
   /** @name Clone Methods. */
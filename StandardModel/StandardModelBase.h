@@ -114,7 +114,7 @@ public:
    * Running \f$\alpha_{EM}\f$.
    */
   double alphaEM(Energy2 scale) const {
-    return theRunningAlphaEM->value(scale, *this);
+    return theRunningAlphaEM->tableValue(scale, *this);
   }
 
   /**
@@ -237,7 +237,7 @@ public:
    * Return the running strong coupling for a given \a scale
    */
   double alphaS(Energy2 scale) const {
-    return theRunningAlphaS->value(scale, *this);
+    return theRunningAlphaS->tableValue(scale, *this);
   }
 
   /**
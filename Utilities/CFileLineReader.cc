@@ -14,9 +14,115 @@
 #include "CFileLineReader.h"
 #include "config.h"
 #include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <stdint.h>
 
 using namespace ThePEG;
 
+namespace {
+
+/**
+ * Read a decimal integer starting at \a p, skipping leading white
+ * space as strtol() does. Only the common cases are handled here: if
+ * the number has too many digits or is octal or hexadecimal, false
+ * is returned and strtol() should be used instead.
+ */
+bool fastInteger(const char * p, long & l, const char *& end,
+		 bool allowSign) {
+  while ( std::isspace(*p) ) ++p;
+  bool neg = false;
+  if ( *p == '-' || *p == '+' ) {
+    if ( !allowSign ) return false;
+    neg = ( *p++ == '-' );
+  }
+  if ( *p < '0' || *p > '9' ) return false;
+  if ( *p == '0' && ( ( p[1] >= '0' && p[1] <= '9' ) ||
+		      p[1] == 'x' || p[1] == 'X' ) ) return false;
+  long v = 0;
+  int n = 0;
+  while ( *p >= '0' && *p <= '9' ) {
+    if ( ++n > 18 ) return false;
+    v = 10*v + (*p++ - '0');
+  }
+  l = neg? -v: v;
+  end = p;
+  return true;
+}
+
+/**
+ * Read a decimal floating point number starting at \a p, skipping
+ * leading white space as strtod() does. Fortran style exponents
+ * (using 'd' or 'D') are accepted. The result is only returned if
+ * the mantissa has at most 19 digits and can be scaled exactly with
+ * a power of ten, in which case it is correctly rounded. Otherwise
+ * (and for hexadecimal numbers, infinities and NaNs) false is
+ * returned and strtod() should be used instead.
+ */
+bool fastDouble(const char * p, double & d, const char *& end) {
+  static const double pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+  while ( std::isspace(*p) ) ++p;
+  bool neg = false;
+  if ( *p == '-' || *p == '+' ) neg = ( *p++ == '-' );
+  uint64_t m = 0;
+  int ndig = 0;
+  int nsig = 0;
+  int exp10 = 0;
+  while ( *p == '0' ) {
+    ++p;
+    ++ndig;
+  }
+  while ( *p >= '0' && *p <= '9' ) {
+    if ( ++nsig > 19 ) return false;
+    m = 10*m + (*p++ - '0');
+    ++ndig;
+  }
+  if ( *p == '.' ) {
+    ++p;
+    if ( nsig == 0 )
+      while ( *p == '0' ) {
+	++p;
+	++ndig;
+	--exp10;
+      }
+    while ( *p >= '0' && *p <= '9' ) {
+      if ( ++nsig > 19 ) return false;
+      m = 10*m + (*p++ - '0');
+      ++ndig;
+      --exp10;
+    }
+  }
+  if ( ndig == 0 ) return false;
+  if ( *p == 'x' || *p == 'X' ) return false;
+  if ( *p == 'e' || *p == 'E' || *p == 'd' || *p == 'D' ) {
+    const char * q = p + 1;
+    bool eneg = false;
+    if ( *q == '-' || *q == '+' ) eneg = ( *q++ == '-' );
+    if ( *q >= '0' && *q <= '9' ) {
+      int e = 0;
+      while ( *q >= '0' && *q <= '9' ) {
+	if ( e > 1000 ) return false;
+	e = 10*e + (*q++ - '0');
+      }
+      exp10 += eneg? -e: e;
+      p = q;
+    }
+  }
+  if ( m > (uint64_t(1) << 53) ) return false;
+  if ( m == 0 ) exp10 = 0;
+  if ( exp10 < -22 || exp10 > 22 ) return false;
+  d = double(m);
+  if ( exp10 < 0 ) d /= pow10[-exp10];
+  else d *= pow10[exp10];
+  if ( neg ) d = -d;
+  end = p;
+  return true;
+}
+
+}
+
 CFileLineReader::CFileLineReader()
   : bufflen(defsize), buff(new char[defsize]), pos(buff), bad(false) {}
 
@@ -71,7 +177,11 @@ bool CFileLineReader::skip(char c) {
 }
 
 bool CFileLineReader::find(string str) const {
-  return ( string(pos).find(str) != string::npos );
+  return find(str.c_str());
+}
+
+bool CFileLineReader::find(const char * str) const {
+  return ( std::strstr(pos, str) != 0 );
 }
 
 std::string CFileLineReader::getline() const {
@@ -79,6 +189,12 @@ std::string CFileLineReader::getline() const {
 }
 
 CFileLineReader & CFileLineReader::operator>>(long & l) {
+  const char * fast;
+  if ( fastInteger(pos, l, fast, true) ) {
+    bad = false;
+    pos = const_cast<char *>(fast);
+    return *this;
+  }
   char * next;
   l = std::strtol(pos, &next, 0);
   bad = ( next == pos );
@@ -86,7 +202,15 @@ CFileLineReader & CFileLineReader::operator>>(long & l) {
   return *this;
 }
 
- CFileLineReader & CFileLineReader::operator>>(int & i) {
+CFileLineReader & CFileLineReader::operator>>(int & i) {
+  long l;
+  const char * fast;
+  if ( fastInteger(pos, l, fast, true) ) {
+    i = int(l);
+    bad = false;
+    pos = const_cast<char *>(fast);
+    return *this;
+  }
   char * next;
   i = int(std::strtol(pos, &next, 0));
   bad = ( next == pos );
@@ -95,6 +219,14 @@ CFileLineReader & CFileLineReader::operator>>(long & l) {
 }
 
 CFileLineReader & CFileLineReader::operator>>(unsigned long & l) {
+  long fl;
+  const char * fast;
+  if ( fastInteger(pos, fl, fast, false) ) {
+    l = static_cast<unsigned long>(fl);
+    bad = false;
+    pos = const_cast<char *>(fast);
+    return *this;
+  }
   char * next;
   l = std::strtoul(pos, &next, 0);
   bad = ( next == pos );
@@ -103,6 +235,14 @@ CFileLineReader & CFileLineReader::operator>>(unsigned long & l) {
 }
 
 CFileLineReader & CFileLineReader::operator>>(unsigned int & i) {
+  long l;
+  const char * fast;
+  if ( fastInteger(pos, l, fast, false) ) {
+    i = static_cast<unsigned int>(l);
+    bad = false;
+    pos = const_cast<char *>(fast);
+    return *this;
+  }
   char * next;
   i = static_cast<unsigned int>(std::strtoul(pos, &next, 0));
   bad = ( next == pos );
@@ -111,32 +251,33 @@ CFileLineReader & CFileLineReader::operator>>(unsigned int & i) {
 }
 
 CFileLineReader & CFileLineReader::operator>>(double & d) {
+  const char * fast;
+  if ( fastDouble(pos, d, fast) ) {
+    bad = false;
+    pos = const_cast<char *>(fast);
+    return *this;
+  }
   char * next;
   d = std::strtod(pos, &next);
   bad = ( next == pos );
-  pos = next;
-  // fortran formatted doubles
-  if(!bad && ( *pos == 'd' || *pos == 'D')) {
-    ++pos;
-    int exp;
-    *this >> exp;
-    d *= pow(10.,exp);
+  // fortran formatted doubles are read again with an 'e' exponent, so
+  // that they are rounded in the same way as in fastDouble().
+  if ( !bad && ( *next == 'd' || *next == 'D' ) ) {
+    char c = *next;
+    *next = 'e';
+    char * fnext;
+    d = std::strtod(pos, &fnext);
+    *next = c;
+    next = fnext;
   }
+  pos = next;
   return *this;
 }
 
 CFileLineReader & CFileLineReader::operator>>(float & f) {
-  char * next;
-  f = float(std::strtod(pos, &next));
-  bad = ( next == pos );
-  pos = next;
-  // fortran formatted doubles
-  if(!bad && ( *pos == 'd' || *pos == 'D')) {
-    ++pos;
-    int exp;
-    *this >> exp;
-    f *= pow(10.,exp);
-  }
+  double d = 0.0;
+  *this >> d;
+  f = float(d);
   return *this;
 }
 
@@ -37,7 +37,9 @@ namespace ThePEG {
  *
  * Since CFileLineReader is very close to the standard C FILE stream
  * it is in many cases much faster than eg. reading from lines via
- * std::istringstream.
+ * std::istringstream. Numbers are read directly from the line buffer
+ * without allocation, and ordinary decimal numbers are converted
+ * without calling the locale-aware strtod() and strtol().
  */
 class CFileLineReader {
 
@@ -127,6 +129,17 @@ public:
    */
   bool find(string str) const;
 
+  /**
+   * Check if a given string is present in the current line buffer.
+   */
+  bool find(const char * str) const;
+
+  /**
+   * Return a pointer to the current position in the line buffer. The
+   * pointer is valid until the next call to readline().
+   */
+  const char * current() const { return pos; }
+
   /** @name Operators to read from the line buffer. */
   //@{
   /**
@@ -0,0 +1,46 @@
+// -*- C++ -*-
+//
+// CacheStatistics.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_CacheStatistics_H
+#define ThePEG_CacheStatistics_H
+// This is the declaration of the CacheStatistics class.
+
+namespace ThePEG {
+
+/**
+ * CacheStatistics is an interface for objects which cache the results
+ * of expensive calculations. A class inheriting from it reports how
+ * many times a cached result could be reused and how many times it had
+ * to be calculated, so that eg. an AnalysisHandler such as EventProfiler
+ * can list the efficiency of the caches of all objects in a run
+ * without knowing their types.
+ */
+class CacheStatistics {
+
+public:
+
+  /**
+   * The destructor.
+   */
+  virtual ~CacheStatistics() {}
+
+  /**
+   * The number of times a cached result was reused.
+   */
+  virtual unsigned long cacheHits() const = 0;
+
+  /**
+   * The number of times a result had to be calculated.
+   */
+  virtual unsigned long cacheMisses() const = 0;
+
+};
+
+}
+
+#endif /* ThePEG_CacheStatistics_H */
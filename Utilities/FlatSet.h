@@ -0,0 +1,261 @@
+// -*- C++ -*-
+//
+// FlatSet.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_FlatSet_H
+#define ThePEG_FlatSet_H
+// This is the declaration of the FlatSet class.
+
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <utility>
+
+namespace ThePEG {
+
+/**
+ * FlatSet is a set of unique objects kept sorted according to
+ * <code>Cmp</code> in a contiguous vector. It has the same interface
+ * and ordering guarantee as std::set for the operations used in the
+ * event record, but iteration is done over contiguous memory and
+ * lookups are binary searches without following tree pointers.
+ *
+ * Inserting an object which compares larger than all objects already
+ * in the set is done in constant time. This is the normal case in the
+ * event record, where particles are ordered by their unique
+ * identifiers, which increase with the creation time. Other
+ * insertions, and erasures, are linear in the size of the set, but
+ * only move pointers in memory.
+ *
+ * Note that, unlike for std::set, iterators are invalidated by any
+ * insertion or erasure.
+ */
+template <typename T, typename Cmp = std::less<T> >
+class FlatSet {
+
+public:
+
+  /** @cond TRAITSTYPEDEFS */
+  typedef std::vector<T> Container;
+  typedef T key_type;
+  typedef T value_type;
+  typedef Cmp key_compare;
+  typedef Cmp value_compare;
+  typedef typename Container::size_type size_type;
+  typedef typename Container::difference_type difference_type;
+  typedef typename Container::const_reference reference;
+  typedef typename Container::const_reference const_reference;
+  typedef typename Container::const_iterator iterator;
+  typedef typename Container::const_iterator const_iterator;
+  typedef typename Container::const_reverse_iterator reverse_iterator;
+  typedef typename Container::const_reverse_iterator const_reverse_iterator;
+  /** @endcond */
+
+public:
+
+  /**
+   * Construct an empty set.
+   */
+  FlatSet() {}
+
+  /**
+   * Construct a set from the range [\a first, \a last).
+   */
+  template <typename Iterator>
+  FlatSet(Iterator first, Iterator last) {
+    insert(first, last);
+  }
+
+public:
+
+  /** @name Iterators. */
+  //@{
+  /** Iterator to the first object. */
+  const_iterator begin() const { return theElements.begin(); }
+  /** Iterator past the last object. */
+  const_iterator end() const { return theElements.end(); }
+  /** Iterator to the first object. */
+  const_iterator cbegin() const { return theElements.begin(); }
+  /** Iterator past the last object. */
+  const_iterator cend() const { return theElements.end(); }
+  /** Reverse iterator to the last object. */
+  const_reverse_iterator rbegin() const { return theElements.rbegin(); }
+  /** Reverse iterator before the first object. */
+  const_reverse_iterator rend() const { return theElements.rend(); }
+  //@}
+
+  /** @name Size. */
+  //@{
+  /** True if the set is empty. */
+  bool empty() const { return theElements.empty(); }
+  /** The number of objects in the set. */
+  size_type size() const { return theElements.size(); }
+  /** The maximum number of objects in the set. */
+  size_type max_size() const { return theElements.max_size(); }
+  /** Reserve space for \a n objects. */
+  void reserve(size_type n) { theElements.reserve(n); }
+  //@}
+
+  /** @name Lookup. */
+  //@{
+  /**
+   * Return the first object which does not compare less than \a k.
+   */
+  const_iterator lower_bound(const key_type & k) const {
+    return std::lower_bound(begin(), end(), k, theCmp);
+  }
+
+  /**
+   * Return the first object which compares greater than \a k.
+   */
+  const_iterator upper_bound(const key_type & k) const {
+    return std::upper_bound(begin(), end(), k, theCmp);
+  }
+
+  /**
+   * Return the range of objects equivalent to \a k.
+   */
+  std::pair<const_iterator,const_iterator>
+  equal_range(const key_type & k) const {
+    return std::equal_range(begin(), end(), k, theCmp);
+  }
+
+  /**
+   * Return an iterator to the object equivalent to \a k, or end().
+   */
+  const_iterator find(const key_type & k) const {
+    const_iterator it = lower_bound(k);
+    return it == end() || theCmp(k, *it)? end(): it;
+  }
+
+  /**
+   * Return the number of objects equivalent to \a k.
+   */
+  size_type count(const key_type & k) const {
+    return find(k) == end()? 0: 1;
+  }
+  //@}
+
+  /** @name Modifiers. */
+  //@{
+  /**
+   * Insert \a v if no equivalent object is present.
+   * @return an iterator to the inserted or already present object
+   * and true if \a v was inserted.
+   */
+  std::pair<iterator,bool> insert(const value_type & v) {
+    if ( empty() || theCmp(theElements.back(), v) ) {
+      theElements.push_back(v);
+      return std::make_pair(end() - 1, true);
+    }
+    const_iterator it = lower_bound(v);
+    if ( !theCmp(v, *it) ) return std::make_pair(it, false);
+    difference_type i = it - begin();
+    theElements.insert(theElements.begin() + i, v);
+    return std::make_pair(begin() + i, true);
+  }
+
+  /**
+   * Insert \a v if no equivalent object is present. The \a hint is
+   * ignored.
+   */
+  iterator insert(const_iterator, const value_type & v) {
+    return insert(v).first;
+  }
+
+  /**
+   * Insert the objects in the range [\a first, \a last).
+   */
+  template <typename Iterator>
+  void insert(Iterator first, Iterator last) {
+    for ( ; first != last; ++first ) insert(*first);
+  }
+
+  /**
+   * Erase the object pointed to by \a it.
+   * @return an iterator to the object following the erased one.
+   */
+  iterator erase(const_iterator it) {
+    difference_type i = it - begin();
+    theElements.erase(theElements.begin() + i);
+    return begin() + i;
+  }
+
+  /**
+   * Erase the objects in the range [\a first, \a last).
+   * @return an iterator to the object following the erased ones.
+   */
+  iterator erase(const_iterator first, const_iterator last) {
+    difference_type i = first - begin();
+    theElements.erase(theElements.begin() + i,
+		      theElements.begin() + (last - begin()));
+    return begin() + i;
+  }
+
+  /**
+   * Erase the object equivalent to \a k.
+   * @return the number of erased objects.
+   */
+  size_type erase(const key_type & k) {
+    const_iterator it = find(k);
+    if ( it == end() ) return 0;
+    erase(it);
+    return 1;
+  }
+
+  /**
+   * Remove all objects.
+   */
+  void clear() { theElements.clear(); }
+
+  /**
+   * Exchange the contents with another set.
+   */
+  void swap(FlatSet & s) { theElements.swap(s.theElements); }
+  //@}
+
+  /**
+   * The comparison object.
+   */
+  key_compare key_comp() const { return theCmp; }
+
+  /**
+   * The comparison object.
+   */
+  value_compare value_comp() const { return theCmp; }
+
+  /**
+   * Two sets are equal if they contain the same objects.
+   */
+  bool operator==(const FlatSet & s) const {
+    return theElements == s.theElements;
+  }
+
+  /**
+   * Two sets are equal if they contain the same objects.
+   */
+  bool operator!=(const FlatSet & s) const {
+    return theElements != s.theElements;
+  }
+
+private:
+
+  /**
+   * The objects in the set.
+   */
+  Container theElements;
+
+  /**
+   * The comparison object.
+   */
+  Cmp theCmp;
+
+};
+
+}
+
+#endif /* ThePEG_FlatSet_H */
@@ -0,0 +1,270 @@
+// -*- C++ -*-
+//
+// MemoryPool.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_MemoryPool_H
+#define ThePEG_MemoryPool_H
+// This is the declaration of the MemoryPool and PoolAllocator classes.
+
+#include <cstddef>
+#include <new>
+#include <limits>
+#include <utility>
+
+namespace ThePEG {
+
+/**
+ * MemoryPool keeps a free list of memory blocks of a given \a Size
+ * bytes. Blocks are taken from large chunks allocated with the global
+ * operator new, and blocks which are deallocated are put back on the
+ * free list rather than being returned to the system. This is
+ * intended for small objects which are created and destroyed in large
+ * numbers for each event, such as Particle objects, so that after the
+ * first few events no calls to malloc and free are needed.
+ *
+ * The blocks are aligned to \a Alignment bytes, or to
+ * <code>alignof(std::max_align_t)</code> if that is larger. Requests
+ * for any other size than \a Size (eg. from derived classes) are
+ * passed on to the global operator new and delete, with the memory
+ * aligned in the same way. The chunks are never released, so the
+ * memory used is given by the maximum number of blocks in use at any
+ * time. Each thread has its own free list. If the macro
+ * <code>ThePEG_NO_MEMORY_POOL</code> is defined, all requests are
+ * passed on to the global operators, which may be useful when
+ * debugging memory problems.
+ *
+ * @see PoolAllocator
+ * @see ThePEG_DECLARE_POOL_ALLOCATION
+ */
+template <std::size_t Size,
+	  std::size_t Alignment = alignof(std::max_align_t)>
+class MemoryPool {
+
+public:
+
+  /**
+   * Allocate \a n bytes.
+   */
+  static void * allocate(std::size_t n) {
+#ifndef ThePEG_NO_MEMORY_POOL
+    if ( n == Size ) {
+      Block *& head = freeList();
+      if ( !head ) grow();
+      Block * b = head;
+      head = b->next;
+      return b;
+    }
+#endif
+    return allocateAligned(n);
+  }
+
+  /**
+   * Deallocate the \a n bytes pointed to by \a p, which must have been
+   * allocated with allocate().
+   */
+  static void deallocate(void * p, std::size_t n) {
+    if ( !p ) return;
+#ifndef ThePEG_NO_MEMORY_POOL
+    if ( n == Size ) {
+      Block * b = static_cast<Block *>(p);
+      b->next = freeList();
+      freeList() = b;
+      return;
+    }
+#endif
+    deallocateAligned(p);
+  }
+
+private:
+
+  /**
+   * The alignment of the blocks.
+   */
+  static const std::size_t Align =
+    Alignment > alignof(std::max_align_t)?
+    Alignment: alignof(std::max_align_t);
+
+  /**
+   * True if the global operator new does not give the required
+   * alignment.
+   */
+  static const bool OverAligned = Align > alignof(std::max_align_t);
+
+  /**
+   * A block of memory which, when not in use, points to the next free
+   * block.
+   */
+  union Block {
+    /** The next free block. */
+    Block * next;
+    /** The storage. */
+    alignas(Align) char data[(Size + Align - 1)/Align*Align];
+  };
+
+  /**
+   * The number of blocks allocated in each chunk.
+   */
+  static const std::size_t ChunkSize =
+    sizeof(Block) < 4096? 65536/sizeof(Block): 16;
+
+  /**
+   * The head of the free list of the current thread.
+   */
+  static Block *& freeList() {
+    static thread_local Block * head = 0;
+    return head;
+  }
+
+  /**
+   * Allocate \a n bytes aligned to Align with the global operator
+   * new. If the alignment is larger than what operator new
+   * guarantees, more memory is allocated and the pointer actually
+   * returned by operator new is stored just before the aligned block.
+   */
+  static void * allocateAligned(std::size_t n) {
+    if ( !OverAligned ) return ::operator new(n);
+    char * p = static_cast<char *>(::operator new(n + Align + sizeof(void *)));
+    std::size_t a = reinterpret_cast<std::size_t>(p + sizeof(void *));
+    char * q = p + sizeof(void *) + (Align - a%Align)%Align;
+    reinterpret_cast<void **>(q)[-1] = p;
+    return q;
+  }
+
+  /**
+   * Deallocate memory allocated with allocateAligned().
+   */
+  static void deallocateAligned(void * p) {
+    if ( OverAligned ) p = static_cast<void **>(p)[-1];
+    ::operator delete(p);
+  }
+
+  /**
+   * Allocate a new chunk and add its blocks to the free list.
+   */
+  static void grow() {
+    Block * chunk =
+      static_cast<Block *>(allocateAligned(ChunkSize*sizeof(Block)));
+    for ( std::size_t i = 0; i + 1 < ChunkSize; ++i )
+      chunk[i].next = chunk + i + 1;
+    chunk[ChunkSize - 1].next = freeList();
+    freeList() = chunk;
+  }
+
+};
+
+/**
+ * PoolAllocator is a standard allocator which takes single objects
+ * from a MemoryPool. It is intended for node-based containers such as
+ * std::set, where each element is allocated separately. Requests for
+ * several objects at once are passed on to the global operator new.
+ *
+ * @see MemoryPool
+ */
+template <typename T>
+class PoolAllocator {
+
+public:
+
+  /** @cond TRAITSTYPEDEFS */
+  typedef T value_type;
+  typedef T * pointer;
+  typedef const T * const_pointer;
+  typedef T & reference;
+  typedef const T & const_reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  template <typename U> struct rebind { typedef PoolAllocator<U> other; };
+  /** @endcond */
+
+public:
+
+  /**
+   * Default constructor.
+   */
+  PoolAllocator() {}
+
+  /**
+   * Copy from an allocator of another type.
+   */
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U> &) {}
+
+  /**
+   * Allocate space for \a n objects.
+   */
+  T * allocate(size_type n, const void * = 0) {
+    return static_cast<T *>(Pool::allocate(n*sizeof(T)));
+  }
+
+  /**
+   * Deallocate the space for \a n objects pointed to by \a p.
+   */
+  void deallocate(T * p, size_type n) {
+    Pool::deallocate(p, n*sizeof(T));
+  }
+
+  /**
+   * The maximum number of objects which can be allocated.
+   */
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max()/sizeof(T);
+  }
+
+  /**
+   * Construct an object in \a p.
+   */
+  template <typename U, typename... Args>
+  void construct(U * p, Args&&... args) {
+    ::new(static_cast<void *>(p)) U(std::forward<Args>(args)...);
+  }
+
+  /**
+   * Destroy the object in \a p.
+   */
+  template <typename U>
+  void destroy(U * p) { p->~U(); }
+
+private:
+
+  /**
+   * The pool used for single objects.
+   */
+  typedef MemoryPool<sizeof(T), alignof(T)> Pool;
+
+};
+
+/** All PoolAllocator objects are equivalent. */
+template <typename T, typename U>
+inline bool operator==(const PoolAllocator<T> &, const PoolAllocator<U> &) {
+  return true;
+}
+
+/** All PoolAllocator objects are equivalent. */
+template <typename T, typename U>
+inline bool operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &) {
+  return false;
+}
+
+}
+
+/**
+ * This macro declares class-specific operator new and delete for the
+ * class \a Class, which then takes its objects from a
+ * ThePEG::MemoryPool. Objects of derived classes with a different
+ * size are allocated with the global operators.
+ */
+#define ThePEG_DECLARE_POOL_ALLOCATION(Class)                         \
+static void * operator new(std::size_t n) {                           \
+  return ThePEG::MemoryPool<sizeof(Class),alignof(Class)>::allocate(n); \
+}                                                                     \
+static void operator delete(void * p, std::size_t n) {                \
+  ThePEG::MemoryPool<sizeof(Class),alignof(Class)>::deallocate(p, n); \
+}                                                                     \
+static void * operator new(std::size_t, void * p) { return p; }       \
+static void operator delete(void *, void *) {}
+
+#endif /* ThePEG_MemoryPool_H */
@@ -0,0 +1,96 @@
+// -*- C++ -*-
+//
+// ObjectCounter.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_ObjectCounter_H
+#define ThePEG_ObjectCounter_H
+// This is the declaration of the ObjectCounter class.
+
+namespace ThePEG {
+
+/**
+ * ObjectCounter is an empty base class which keeps track of the
+ * number of objects of the class \a T which have been created and
+ * destroyed. A class is instrumented by inheriting from
+ * <code>ObjectCounter&lt;T&gt;</code>, after which created() and
+ * destroyed() can be read, eg. by an AnalysisHandler, to find out how
+ * many objects of the class are used for each event. The counters are
+ * kept separately for each thread and are never reset.
+ *
+ * Objects of classes derived from \a T are counted as \a T, and
+ * sizeof(T) is therefore only a lower limit of the memory used by
+ * them. If the macro <code>ThePEG_NO_OBJECT_COUNTERS</code> is
+ * defined, nothing is counted and the counters are always zero.
+ */
+template <typename T>
+class ObjectCounter {
+
+public:
+
+  /**
+   * The number of objects created in the current thread.
+   */
+  static unsigned long created() { return counters()[0]; }
+
+  /**
+   * The number of objects destroyed in the current thread.
+   */
+  static unsigned long destroyed() { return counters()[1]; }
+
+  /**
+   * The number of objects created in the current thread which have
+   * not yet been destroyed.
+   */
+  static unsigned long alive() { return created() - destroyed(); }
+
+protected:
+
+  /**
+   * The default constructor.
+   */
+  ObjectCounter() { count(0); }
+
+  /**
+   * The copy constructor.
+   */
+  ObjectCounter(const ObjectCounter &) { count(0); }
+
+  /**
+   * The destructor.
+   */
+  ~ObjectCounter() { count(1); }
+
+  /**
+   * The assignment does not change the counters.
+   */
+  ObjectCounter & operator=(const ObjectCounter &) { return *this; }
+
+private:
+
+  /**
+   * Increment the creation (\a i = 0) or destruction (\a i = 1)
+   * counter.
+   */
+#ifndef ThePEG_NO_OBJECT_COUNTERS
+  static void count(int i) { ++counters()[i]; }
+#else
+  static void count(int) {}
+#endif
+
+  /**
+   * The creation and destruction counters of the current thread.
+   */
+  static unsigned long * counters() {
+    static thread_local unsigned long n[2] = { 0, 0 };
+    return n;
+  }
+
+};
+
+}
+
+#endif /* ThePEG_ObjectCounter_H */
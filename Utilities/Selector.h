@@ -40,6 +40,15 @@ namespace ThePEG {
  * <code>foo * f = bar.select(random())</code>  // randomly returns
  * a pointer to f1 or f2<BR>
  *
+ * When no more objects are to be inserted, the Selector can be
+ * frozen with freeze(), after which objects are selected in constant
+ * time with Walker's alias method, independently of the number of
+ * objects. The objects are then selected with the same probabilities
+ * but, for a given random number, not necessarily the same object as
+ * for a Selector which is not frozen. Objects can still be inserted
+ * or erased in a frozen Selector, but then the alias table is rebuilt
+ * each time, which takes a time proportional to the number of
+ * objects.
  * @see VSelector
  */
 template <typename T, typename WeightType = double>
@@ -64,7 +73,28 @@ public:
   /**
    * Default constructor.
    */
-  Selector() : theSum(WeightType()) {}
+  Selector() : theSum(WeightType()), isFrozen(false) {}
+
+  /**
+   * Copy constructor.
+   */
+  Selector(const Selector & s)
+    : theMap(s.theMap), theSum(s.theSum), isFrozen(s.isFrozen) {
+    if ( isFrozen ) buildAliasTable();
+  }
+
+  /**
+   * Assignment.
+   */
+  Selector & operator=(const Selector & s) {
+    if ( &s == this ) return *this;
+    theMap = s.theMap;
+    theSum = s.theSum;
+    isFrozen = s.isFrozen;
+    clearAliasTable();
+    if ( isFrozen ) buildAliasTable();
+    return *this;
+  }
 
   /**
    * Swap the underlying representation with the argument.
@@ -73,6 +103,10 @@ public:
   {
     theMap.swap(s.theMap);
     std::swap(theSum, s.theSum);
+    std::swap(isFrozen, s.isFrozen);
+    theEntries.swap(s.theEntries);
+    theAliasProb.swap(s.theAliasProb);
+    theAlias.swap(s.theAlias);
   }
 
   /**
@@ -86,6 +120,7 @@ public:
     WeightType newSum = theSum + d;
     if ( newSum <= theSum ) return d;
     theMap.insert(theMap.end(), value_type((theSum = newSum), t));
+    if ( isFrozen ) buildAliasTable();
     return theSum;
   }
 
@@ -236,7 +271,23 @@ public:
   /**
    * Erases all objects.
    */
-  void clear() { theMap.clear(); theSum = WeightType(); }
+  void clear() { theMap.clear(); theSum = WeightType(); clearAliasTable(); }
+
+  /**
+   * Freeze (or, if \a on is false, unfreeze) the Selector. If frozen,
+   * objects are selected in constant time using an alias table,
+   * which is rebuilt whenever objects are inserted or erased.
+   */
+  void freeze(bool on = true) {
+    isFrozen = on;
+    clearAliasTable();
+    if ( isFrozen ) buildAliasTable();
+  }
+
+  /**
+   * Return true if the Selector has been frozen.
+   */
+  bool frozen() const { return isFrozen; }
 
   /**
    * Output to a stream for dimensionful units.
@@ -262,6 +313,27 @@ public:
   template <typename IStream>
   void input(IStream &, StandardT);
 
+private:
+
+  /**
+   * Build the alias table from the underlying map.
+   */
+  void buildAliasTable();
+
+  /**
+   * Remove the alias table.
+   */
+  void clearAliasTable() {
+    theEntries.clear();
+    theAliasProb.clear();
+    theAlias.clear();
+  }
+
+  /**
+   * Select an object using the alias table.
+   */
+  iterator selectAlias(double rnd, double * remainder) const;
+
 private:
 
   /**
@@ -274,6 +346,28 @@ private:
    */
   WeightType theSum;
 
+  /**
+   * True if the Selector is frozen and the alias table is used.
+   */
+  bool isFrozen;
+
+  /**
+   * The entries in the underlying map, in order.
+   */
+  vector<iterator> theEntries;
+
+  /**
+   * The probabilities to keep the entry corresponding to each column
+   * in the alias table.
+   */
+  vector<double> theAliasProb;
+
+  /**
+   * The index of the entry to select instead for each column in the
+   * alias table.
+   */
+  vector<size_type> theAlias;
+
 };
 
 /**
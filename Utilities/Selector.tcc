@@ -20,12 +20,73 @@ WeightType Selector<T,WeightType>::erase(const T & t) {
     if ( it->second != t ) newSelector.insert(r, it->second);
   }
   theMap.swap(newSelector.theMap);
-  return theSum = newSelector.theSum;
+  theSum = newSelector.theSum;
+  if ( isFrozen ) buildAliasTable();
+  return theSum;
+}
+
+template <typename T, typename WeightType>
+void Selector<T,WeightType>::buildAliasTable() {
+  clearAliasTable();
+  size_type n = theMap.size();
+  if ( n == 0 ) return;
+  theEntries.reserve(n);
+  theAliasProb.resize(n);
+  theAlias.resize(n);
+
+  // Vose's construction: columns with a scaled probability below one
+  // are filled up with an entry with a scaled probability above one.
+  vector<size_type> small, large;
+  WeightType oldsum = WeightType();
+  for ( iterator it = theMap.begin(); it != theMap.end(); ++it ) {
+    size_type i = theEntries.size();
+    theEntries.push_back(it);
+    theAliasProb[i] = double(n)*((it->first - oldsum)/theSum);
+    theAlias[i] = i;
+    oldsum = it->first;
+    if ( theAliasProb[i] < 1.0 ) small.push_back(i);
+    else large.push_back(i);
+  }
+  while ( !small.empty() && !large.empty() ) {
+    size_type s = small.back();
+    small.pop_back();
+    size_type l = large.back();
+    theAlias[s] = l;
+    theAliasProb[l] -= 1.0 - theAliasProb[s];
+    if ( theAliasProb[l] < 1.0 ) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // Whatever is left over is only due to rounding errors.
+  for ( size_type i = 0; i < large.size(); ++i ) theAliasProb[large[i]] = 1.0;
+  for ( size_type i = 0; i < small.size(); ++i ) theAliasProb[small[i]] = 1.0;
+}
+
+template <typename T, typename WeightType>
+typename Selector<T,WeightType>::iterator Selector<T,WeightType>::
+selectAlias(double rnd, double * remainder) const {
+  if ( rnd <= 0 )
+    throw range_error("Random number out of range in Selector::select.");
+  if ( rnd >= 1.0 || theEntries.empty() )
+    throw range_error("Empty Selector, or random number out of range "
+		      "in Selector::select");
+  double u = rnd*double(theEntries.size());
+  size_type i = min(size_type(u), theEntries.size() - 1);
+  double f = u - double(i);
+  double p = theAliasProb[i];
+  if ( f < p ) {
+    if ( remainder ) *remainder = f/p;
+    return theEntries[i];
+  }
+  if ( remainder ) *remainder = (f - p)/(1.0 - p);
+  return theEntries[theAlias[i]];
 }
 
 template <typename T, typename WeightType>
 const T & Selector<T,WeightType>::
 select(double rnd, double * remainder) const {
+  if ( isFrozen ) return selectAlias(rnd, remainder)->second;
   if ( rnd <= 0 )
     throw range_error("Random number out of range in Selector::select.");
   const_iterator it = theMap.upper_bound(rnd*theSum);
@@ -47,6 +108,7 @@ select(double rnd, double * remainder) const {
 template <typename T, typename WeightType>
 T & Selector<T,WeightType>::
 select(double rnd, double * remainder) {
+  if ( isFrozen ) return selectAlias(rnd, remainder)->second;
   if ( rnd <= 0 )
     throw range_error("Random number out of range in Selector::select.");
   iterator it = theMap.upper_bound(rnd*theSum);
@@ -86,6 +148,7 @@ void Selector<T,WeightType>::input(IStream & is, DimensionT) {
     is >> iunit(weightsum,WeightType::baseunit()) >> t;
     theMap.insert(theMap.end(), value_type(weightsum, t));
   }
+  if ( isFrozen ) buildAliasTable();
 }
 
 template <typename T, typename WeightType>
@@ -109,6 +172,7 @@ void Selector<T,WeightType>::input(IStream & is, StandardT) {
     is >> weightsum >> t;
     theMap.insert(theMap.end(), value_type(weightsum, t));
   }
+  if ( isFrozen ) buildAliasTable();
 }
 
 }
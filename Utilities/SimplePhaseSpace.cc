@@ -90,3 +90,81 @@ CMSn(Energy m0, const vector<Energy> & m)
   }
 }
 
+double SimplePhaseSpace::
+RAMBO(Energy m0, const vector<Energy> & m, vector<LorentzMomentum> & p)
+{
+  using Constants::pi;
+
+  int Np = m.size();
+  if ( Np < 2 ) throw ImpossibleKinematics();
+  Energy summ = std::accumulate(m.begin(), m.end(), Energy());
+  if ( summ >= m0 ) throw ImpossibleKinematics();
+  p.resize(Np);
+
+  // Generate isotropic massless momenta with energies distributed as
+  // q0*exp(-q0).
+  LorentzMomentum Q;
+  for ( int i = 0; i < Np; ++i ) {
+    double cthe = 2.0*UseRandom::rnd() - 1.0;
+    double phi = 2.0*pi*UseRandom::rnd();
+    Energy q0 = -m0*log(UseRandom::rnd()*UseRandom::rnd());
+    p[i] = LorentzMomentum(polar3Vector(q0, cthe, phi), q0);
+    Q += p[i];
+  }
+
+  // Boost and scale them so that they sum up to (0,0,0,m0).
+  Energy M = Q.m();
+  Boost b = Q.vect()*(-1.0/M);
+  double gamma = Q.e()/M;
+  double a = 1.0/(1.0 + gamma);
+  double x = m0/M;
+  for ( int i = 0; i < Np; ++i ) {
+    Energy q0 = p[i].e();
+    Energy bq = b*p[i].vect();
+    p[i] = LorentzMomentum(x*(p[i].vect() + (q0 + a*bq)*b),
+			   x*(gamma*q0 + bq));
+  }
+  if ( summ <= ZERO ) return 1.0;
+
+  // Find the factor xi with which to scale the three-momenta so that
+  // the energies with the given masses sum up to m0.
+  double xi = sqrt(1.0 - sqr(summ/m0));
+  for ( int iter = 0; iter < 100; ++iter ) {
+    Energy f = -m0;
+    Energy df = ZERO;
+    for ( int i = 0; i < Np; ++i ) {
+      Energy e = sqrt(sqr(m[i]) + sqr(xi*p[i].e()));
+      f += e;
+      df += xi*sqr(p[i].e())/e;
+    }
+    double dxi = f/df;
+    xi -= dxi;
+    if ( abs(dxi) < 10.0*Constants::epsilon ) break;
+  }
+
+  // Rescale the momenta and calculate the weight.
+  Energy sumk = ZERO;
+  Energy sumk2e = ZERO;
+  double prod = 1.0;
+  for ( int i = 0; i < Np; ++i ) {
+    Energy k = xi*p[i].e();
+    Energy e = sqrt(sqr(m[i]) + sqr(k));
+    p[i] = LorentzMomentum(xi*p[i].vect(), e);
+    sumk += k;
+    sumk2e += sqr(k)/e;
+    prod *= k/e;
+  }
+  return pow(sumk/m0, 2*Np - 3)*prod*m0/sumk2e;
+}
+
+void SimplePhaseSpace::
+CMSnRAMBO(Energy m0, const vector<Energy> & m, vector<LorentzMomentum> & p)
+{
+  // Close to threshold the RAMBO weights become very small, in which
+  // case CMSn() is used instead. Both give momenta distributed
+  // exactly according to phase space.
+  for ( int itry = 0; itry < 100; ++itry )
+    if ( RAMBO(m0, m, p) >= UseRandom::rnd() ) return;
+  p = CMSn(m0, m);
+}
+
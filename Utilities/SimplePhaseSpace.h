@@ -221,6 +221,61 @@ struct SimplePhaseSpace {
   template <typename Container>
   static void CMSn(Container & particles, Energy m0);
 
+  /**
+   * Get a number of weighted momenta using the RAMBO algorithm. Given
+   * a number of specified invariant masses and a total invariant mass
+   * m0, generate massless momenta uniformly in phase space, and
+   * rescale them to get the given masses. The returned weight is the
+   * ratio of the massive and massless phase space densities, which is
+   * one if all masses are zero and never larger than one if there are
+   * more than two momenta. No memory is allocated if \a p has enough
+   * capacity.
+   * @param m0 the total invariant mass of the resulting momenta.
+   * @param m a vector of at least two invariant masses of the
+   * resulting momenta.
+   * @param p the vector where the resulting momenta are stored.
+   * @return the weight of the generated momenta.
+   * @throw ImpossibleKinematics if the sum of the masses was
+   * larger than the given invariant mass (\f$\sqrt{s}\f$).
+   */
+  static double RAMBO(Energy m0, const vector<Energy> & m,
+		      vector<LorentzMomentum> & p);
+
+  /**
+   * Get a number of randomly distributed momenta. As CMSn(Energy,
+   * const vector<Energy> &), but generated by repeatedly calling
+   * RAMBO() until a set of momenta is accepted according to its
+   * weight. This is efficient for momenta with masses small compared
+   * to m0, where the old method has a small acceptance. If no set of
+   * momenta has been accepted after 100 attempts, which may happen
+   * close to threshold, CMSn(Energy, const vector<Energy> &) is
+   * used instead.
+   * @param m0 the total invariant mass of the resulting momenta.
+   * @param m a vector of at least two invariant masses of the
+   * resulting momenta.
+   * @param p the vector where the resulting momenta are stored.
+   * @throw ImpossibleKinematics if the sum of the masses was
+   * larger than the given invariant mass (\f$\sqrt{s}\f$).
+   */
+  static void CMSnRAMBO(Energy m0, const vector<Energy> & m,
+			vector<LorentzMomentum> & p);
+
+  /**
+   * Set the momentum of a number of particles. As CMSn(Container &,
+   * Energy) but using CMSnRAMBO(Energy, const vector<Energy> &,
+   * vector<LorentzMomentum> &). The temporary vectors are reused
+   * between calls in each thread.
+   * @param particles a container of particles or pointers to
+   * particles. The invariant mass of these particles will not be
+   * chaned.
+   * @param m0 the
+   * total invariant mass of the resulting momenta.
+   * @throw ImpossibleKinematics if the sum of the masses was
+   * larger than the given invariant mass (\f$\sqrt{s}\f$).
+   */
+  template <typename Container>
+  static void CMSnRAMBO(Container & particles, Energy m0);
+
 };
 
 }
@@ -133,4 +133,21 @@ void SimplePhaseSpace::CMSn(Container & particles, Energy m0)
     Traits::set5Momentum(*i, p[j]);
 }
 
+template <typename Container>
+void SimplePhaseSpace::CMSnRAMBO(Container & particles, Energy m0)
+{
+  typedef typename Container::value_type PType;
+  typedef typename Container::iterator Iterator;
+  typedef ParticleTraits<PType> Traits;
+  static thread_local vector<Energy> masses;
+  static thread_local vector<LorentzMomentum> p;
+  masses.clear();
+  for ( Iterator i = particles.begin();i != particles.end(); ++i )
+    masses.push_back(Traits::mass(*i));
+  CMSnRAMBO(m0, masses, p);
+  int j = 0;
+  for ( Iterator i = particles.begin();i != particles.end(); ++i, ++j )
+    Traits::set5Momentum(*i, p[j]);
+}
+
 }
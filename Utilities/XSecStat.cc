@@ -41,3 +41,13 @@ void XSecStat::input(PersistentIStream & is) {
      >> theSumWeights >> theSumWeights2 >> theLastWeight;
 }
 
+
+void XSecStat::outputSums(PersistentOStream & os) const {
+  output(os);
+  os << theVetoed;
+}
+
+void XSecStat::inputSums(PersistentIStream & is) {
+  input(is);
+  is >> theVetoed;
+}
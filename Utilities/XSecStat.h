@@ -95,6 +95,23 @@ public:
     return *this;
   }
 
+  /**
+   * Add the contents of another XSecStat, \a x, where the weights of
+   * \a x are given in units of an overestimated cross section which
+   * is \a scale times the one of this object. Used to combine the
+   * raw sums of independent runs with different overestimates.
+   */
+  void merge(const XSecStat & x, double scale = 1.0) {
+    theAttempts    += x.theAttempts;
+    theAccepted    += x.theAccepted;
+    theVetoed      += x.theVetoed;
+    for( unsigned int ix = 0; ix < 4; ++ix ) {
+      theSumWeights [ix] += x.theSumWeights [ix]*scale;
+      theSumWeights2[ix] += x.theSumWeights2[ix]*sqr(scale);
+    }
+    theLastWeight = 0.0;
+  }
+
   /**
    * Reset the statistics.
    */
@@ -272,6 +289,18 @@ public:
    * Input from a persistent stream.
    */
   void input(PersistentIStream & is);
+
+  /**
+   * Output all sums, including the number of vetoed events which is
+   * not included in output(), to be read back with inputSums() and
+   * combined with merge().
+   */
+  void outputSums(PersistentOStream & os) const;
+
+  /**
+   * Input all sums written with outputSums().
+   */
+  void inputSums(PersistentIStream & is);
   //@}
 
 private:
@@ -0,0 +1,92 @@
+// -*- C++ -*-
+//
+// utilitiesBenchRAMBO.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2017 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Measures the number of accepted phase space points per second
+// generated by SimplePhaseSpace::CMSn() and SimplePhaseSpace::CMSnRAMBO()
+// for N pions, both far above threshold and close to it. The rate of
+// weighted points from SimplePhaseSpace::RAMBO() and its average
+// weight, which is the acceptance of CMSnRAMBO(), are also given.
+// Each measurement runs for at most the given number of seconds.
+// Usage: utilities_bench_rambo [seconds]
+//
+
+#include "ThePEG/Utilities/SimplePhaseSpace.h"
+#include "ThePEG/Repository/StandardRandom.h"
+#include "ThePEG/Repository/UseRandom.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace ThePEG;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/*
+ * Call f() repeatedly for at most tmax seconds and return the number
+ * of calls per second.
+ */
+template <typename F>
+double rate(F f, double tmax) {
+  long n = 0;
+  Clock::time_point start = Clock::now();
+  double t = 0.0;
+  do {
+    for ( int i = 0; i < 100; ++i ) f();
+    n += 100;
+    t = seconds(start);
+  } while ( t < tmax );
+  return n/t;
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  double tmax = argc > 1 ? std::atof(argv[1]) : 0.5;
+
+  StandardRandom srng;
+  UseRandom urng(&srng);
+
+  const Energy mpi = 0.13957*GeV;
+  const int Ns[] = { 3, 5, 8, 12, 20 };
+  const double factors[] = { 10.0, 1.2 };
+
+  std::printf("%4s %8s %12s %12s %12s %10s\n", "N", "m0/sum(m)",
+	      "CMSn /s", "CMSnRAMBO /s", "RAMBO /s", "<weight>");
+  for ( double factor : factors ) {
+    for ( int N : Ns ) {
+      vector<Energy> m(N, mpi);
+      Energy m0 = factor*N*mpi;
+      vector<LorentzMomentum> p;
+
+      double wsum = 0.0;
+      long nw = 0;
+      double rw = rate([&]() {
+	  wsum += SimplePhaseSpace::RAMBO(m0, m, p);
+	  ++nw;
+	}, tmax);
+      double acc = wsum/nw;
+
+      double rc = rate([&]() { SimplePhaseSpace::CMSn(m0, m); }, tmax);
+
+      // Near threshold CMSnRAMBO() falls back to CMSn() after a
+      // number of rejected attempts.
+      double rr = rate([&]() { SimplePhaseSpace::CMSnRAMBO(m0, m, p); }, tmax);
+
+      std::printf("%4d %8.1f %12.3g %12.3g %12.3g %10.3g\n",
+		  N, factor, rc, rr, rw, acc);
+    }
+  }
+
+  return 0;
+}
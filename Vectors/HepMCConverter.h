@@ -13,15 +13,22 @@
 #include "ThePEG/Config/ThePEG.h"
 #include "ThePEG/EventRecord/Event.h"
 #include "HepMCTraits.h"
+#include <unordered_map>
 
 namespace ThePEG {
 
 
 /**
- * The HepMCConverter defines only one public static function which
- * converts a ThePEG::Event object to a
- * <code>HepMC::GenEvent</code>. All mother-daughter relationships and
- * colour information is preserved.
+ * The HepMCConverter defines static functions which convert a
+ * ThePEG::Event object to a <code>HepMC::GenEvent</code>. All
+ * mother-daughter relationships and colour information is preserved.
+ *
+ * For repeated conversions, eg. in an AnalysisHandler writing every
+ * event to a file, a HepMCConverter object can be kept and its fill()
+ * function used to convert each event into the same GenEvent
+ * object. The internal tables, which are indexed by the
+ * Particle::number() of the particles in the event, are then reused
+ * between events.
  *
  * @see Event
  * @see Particle
@@ -47,6 +54,10 @@ public:
     tcParticleSet in;
     /** Particles going out of the vertex. */
     tcParticleSet out;
+    /** The GenVertex created from this vertex. */
+    typename Traits::VertexT * gen;
+    /** Constructor. */
+    Vertex() : gen(0) {}
   };
 
   /** Forward typedefs from Traits class. */
@@ -57,14 +68,12 @@ public:
   typedef typename Traits::VertexT GenVertex;
   /** Forward typedefs from Traits class. */
   typedef typename Traits::PdfInfoT PdfInfo;
-  /** Map ThePEG particles to HepMC particles. */
-  typedef map<tcPPtr,GenParticle*> ParticleMap;
+  /** Map ThePEG particles, by index, to HepMC particles. */
+  typedef vector<GenParticle*> ParticleMap;
   /** Map ThePEG colour lines to HepMC colour indices. */
-  typedef map<tcColinePtr,long> FlowMap;
-  /** Map ThePEG particles to vertices. */
-  typedef map<tcPPtr,Vertex*> VertexMap;
-  /** Map vertices to GenVertex */
-  typedef map<const Vertex *, GenVertex*> GenVertexMap;
+  typedef std::unordered_map<const ColourLine *,long> FlowMap;
+  /** Map ThePEG particles, by index, to vertices. */
+  typedef vector<Vertex*> VertexMap;
 
 public:
 
@@ -106,6 +115,24 @@ public:
   static void
   convert(const Event & ev, GenEvent & gev, bool nocopies = false);
 
+public:
+
+  /**
+   * Create a converter object to be used for repeated conversions
+   * with fill().
+   */
+  HepMCConverter();
+
+  /**
+   * Clear the GenEvent \a gev and fill it with the ThePEG::Event
+   * \a ev, reusing the internal tables of this converter. The
+   * arguments \a nocopies, \a eunit and \a lunit are used as in
+   * convert().
+   */
+  void fill(const Event & ev, GenEvent & gev, bool nocopies = false,
+	    Energy eunit = Traits::defaultEnergyUnit(),
+	    Length lunit = Traits::defaultLengthUnit());
+
 private:
 
   /**
@@ -126,11 +153,6 @@ private:
    */
   void init(const Event & ev, bool nocopies);
 
-  /**
-   * Default constructor is unimplemented and private and should never be used.
-   */
-  HepMCConverter();
-
   /**
    * Copy constructor is unimplemented and private and should never be used.
    */
@@ -143,6 +165,30 @@ private:
 
 private:
 
+  /**
+   * Clear the internal tables.
+   */
+  void clear();
+
+  /**
+   * Return the index of the given particle in the internal tables, or
+   * zero if it has not been added with addIndex().
+   */
+  long index(tcPPtr p) const {
+    if ( !p ) return 0;
+    long n = p->number();
+    if ( n > 0 && n < long(numbered.size()) && numbered[n] == p ) return n;
+    typename map<tcPPtr,long>::const_iterator it = unnumbered.find(p);
+    return it == unnumbered.end()? 0: it->second;
+  }
+
+  /**
+   * Add the given particle to the internal tables and return its
+   * index. Normally the index is the Particle::number() in the
+   * event.
+   */
+  long addIndex(tcPPtr p);
+
   /**
    * Create a GenParticle from a ThePEG Particle.
    */
@@ -154,6 +200,11 @@ private:
    */
   void join(tcPPtr parent, tcPPtr child);
 
+  /**
+   * Return the HepMC flow index of the given colour line.
+   */
+  long flowIndex(tcColinePtr l);
+
   /**
    * Create a GenVertex from a temporary Vertex.
    */
@@ -171,6 +222,17 @@ private:
    */
   GenEvent * geneve;
 
+  /**
+   * The particles in the event, by index.
+   */
+  tcPVector numbered;
+
+  /**
+   * The indices of particles in the event which were not given a
+   * unique number.
+   */
+  map<tcPPtr,long> unnumbered;
+
   /**
    * The translation table between the ThePEG particles and the
    * GenParticles.
@@ -198,11 +260,6 @@ private:
    */
   VertexMap decv;
 
-  /**
-   * The mapping between temporary vertices and the created GenVertex Objects.
-   */
-  GenVertexMap vmap;
-
   /**
    * The energy unit to be used in the GenEvent.
    */
@@ -51,6 +51,56 @@ convert(const Event & ev, GenEvent & gev, bool nocopies,
   HepMCConverter<HepMCEventT,Traits> converter(ev, gev, nocopies, eunit, lunit);
 }
 
+template <typename HepMCEventT, typename Traits>
+HepMCConverter<HepMCEventT,Traits>::HepMCConverter()
+  : geneve(0), energyUnit(Traits::defaultEnergyUnit()),
+    lengthUnit(Traits::defaultLengthUnit()) {}
+
+template <typename HepMCEventT, typename Traits>
+void HepMCConverter<HepMCEventT,Traits>::
+fill(const Event & ev, GenEvent & gev, bool nocopies,
+     Energy eunit, Length lunit) {
+  clear();
+  energyUnit = eunit;
+  lengthUnit = lunit;
+  geneve = &gev;
+  Traits::clearEvent(gev);
+  Traits::resetEvent(geneve, ev.number(), ev.weight(), ev.optionalWeights());
+  init(ev, nocopies);
+}
+
+template <typename HepMCEventT, typename Traits>
+void HepMCConverter<HepMCEventT,Traits>::clear() {
+  numbered.clear();
+  unnumbered.clear();
+  pmap.clear();
+  flowmap.clear();
+  vertices.clear();
+  prov.clear();
+  decv.clear();
+}
+
+template <typename HepMCEventT, typename Traits>
+long HepMCConverter<HepMCEventT,Traits>::addIndex(tcPPtr p) {
+  long n = p->number();
+  if ( n > 0 && n < long(numbered.size()) ) {
+    if ( numbered[n] == p ) return n;
+    if ( !numbered[n] ) {
+      numbered[n] = p;
+      return n;
+    }
+  }
+  typename map<tcPPtr,long>::iterator it = unnumbered.find(p);
+  if ( it != unnumbered.end() ) return it->second;
+  n = numbered.size();
+  numbered.push_back(p);
+  pmap.push_back(0);
+  prov.push_back(0);
+  decv.push_back(0);
+  unnumbered[p] = n;
+  return n;
+}
+
 template <typename HepMCEventT, typename Traits>
 HepMCConverter<HepMCEventT,Traits>::
 HepMCConverter(const Event & ev, bool nocopies, Energy eunit, Length lunit)
@@ -110,31 +160,36 @@ void HepMCConverter<HepMCEventT,Traits>::init(const Event & ev, bool nocopies) {
   stable_sort(all.begin(), all.end(), ParticleOrderNumberCmp());
   vertices.reserve(all.size()*2);
 
+  // Set up the tables indexed by the particle numbers. Index zero is
+  // used for particles which are not in the event.
+  long nmax = all.empty()? 0: all.back()->number();
+  numbered.assign(max(nmax, 0L) + 1, tcPPtr());
+  pmap.assign(numbered.size(), 0);
+  prov.assign(numbered.size(), 0);
+  decv.assign(numbered.size(), 0);
+
   // Create GenParticle's and map them to the ThePEG particles.
   for ( int i = 0, N = all.size(); i < N; ++i ) {
     tcPPtr p = all[i];
     if ( nocopies && p->next() ) continue;
-    if ( pmap.find(p) != pmap.end() ) continue;
-    GenParticle * gp = pmap[p] = createParticle(p);
+    long ip = addIndex(p);
+    if ( pmap[ip] ) continue;
+    GenParticle * gp = pmap[ip] = createParticle(p);
     if ( p->hasColourInfo() ) {
       // Check if the particle is connected to colour lines, in which
       // case the lines are mapped to an integer and set in the
       // GenParticle's Flow info.
       tcColinePtr l;
-      if ( (l = p->colourLine()) ) {
-	if ( !member(flowmap, l) ) flowmap[l] = flowmap.size() + 500;
-	Traits::setColourLine(*gp, 1, flowmap[l]);
-      }
-      if ( (l = p->antiColourLine()) ) {
-	if ( !member(flowmap, l) ) flowmap[l] = flowmap.size() + 500;
-	Traits::setColourLine(*gp, 2, flowmap[l]);
-      }
+      if ( (l = p->colourLine()) )
+	Traits::setColourLine(*gp, 1, flowIndex(l));
+      if ( (l = p->antiColourLine()) )
+	Traits::setColourLine(*gp, 2, flowIndex(l));
     }
 
     if ( !p->children().empty() || p->next() ) {
       // If the particle has children it should have a decay vertex:
       vertices.push_back(Vertex());
-      decv[p] = &vertices.back();
+      decv[ip] = &vertices.back();
       vertices.back().in.insert(p);
     }
 
@@ -144,7 +199,7 @@ void HepMCConverter<HepMCEventT,Traits>::init(const Event & ev, bool nocopies) {
       // vertex. If neither parents or children it should still have a
       // dummy production vertex.
       vertices.push_back(Vertex());
-      prov[p] = &vertices.back();
+      prov[ip] = &vertices.back();
       vertices.back().out.insert(p);
     }
   }
@@ -170,32 +225,30 @@ void HepMCConverter<HepMCEventT,Traits>::init(const Event & ev, bool nocopies) {
     }
   }
 
-  // Time to create the GenVertex's
-  for ( typename VertexMap::iterator it = prov.begin(); it != prov.end(); ++it )
-    if ( !member(vmap, it->second) )
-      vmap[it->second] = createVertex(it->second);
-  for ( typename VertexMap::iterator it = decv.begin(); it != decv.end(); ++it )
-    if ( !member(vmap, it->second) )
-      vmap[it->second] = createVertex(it->second);
+  // Time to create the GenVertex's. All vertices which have not been
+  // emptied by join() are referred to by some particle.
+  for ( int i = 0, N = vertices.size(); i < N; ++i )
+    if ( !vertices[i].in.empty() || !vertices[i].out.empty() )
+      vertices[i].gen = createVertex(&vertices[i]);
 
   // Now find the primary signal process vertex defined to be the
   // decay vertex of the first parton coming into the primary hard
   // sub-collision.
+  const Vertex * prim = 0;
   tSubProPtr sub = ev.primarySubProcess();
   if ( sub && sub->incoming().first ) {
-    const Vertex * prim = decv[sub->incoming().first];
-    Traits::setSignalProcessVertex(*geneve, vmap[prim]);
-    vmap.erase(prim);
+    prim = decv[index(sub->incoming().first)];
+    Traits::setSignalProcessVertex(*geneve, prim? prim->gen: 0);
   }
   
   // Then add the rest of the vertices.
-  for ( typename GenVertexMap::iterator it = vmap.begin();
-	it != vmap.end(); ++it )
-    Traits::addVertex(*geneve, it->second);
+  for ( int i = 0, N = vertices.size(); i < N; ++i )
+    if ( vertices[i].gen && &vertices[i] != prim )
+      Traits::addVertex(*geneve, vertices[i].gen);
 
   // and the incoming beam particles
-  Traits::setBeamParticles(*geneve,pmap[ev.incoming().first],
-			   pmap[ev.incoming().second]);
+  Traits::setBeamParticles(*geneve,pmap[index(ev.incoming().first)],
+			   pmap[index(ev.incoming().second)]);
 
   // and the PDF info
   setPdfInfo(ev);
@@ -251,31 +304,40 @@ HepMCConverter<HepMCEventT,Traits>::createParticle(tcPPtr p) const {
 
 template <typename HepMCEventT, typename Traits>
 void HepMCConverter<HepMCEventT,Traits>::join(tcPPtr parent, tcPPtr child) {
-  Vertex * dec = decv[parent];
-  Vertex * pro = prov[child];
+  Vertex * dec = decv[index(parent)];
+  Vertex * pro = prov[index(child)];
   if ( !pro || !dec ) Throw<HepMCConverterException>()
     << "Found a reference to a ThePEG::Particle which was not in the Event."
     << Exception::eventerror;
   if ( pro == dec ) return;
   while ( !pro->in.empty() ) {
     dec->in.insert(*(pro->in.begin()));
-    decv[*(pro->in.begin())] = dec;
+    decv[index(*(pro->in.begin()))] = dec;
     pro->in.erase(pro->in.begin());
   }
   while ( !pro->out.empty() ) {
     dec->out.insert(*(pro->out.begin()));
-    prov[*(pro->out.begin())] = dec;
+    prov[index(*(pro->out.begin()))] = dec;
     pro->out.erase(pro->out.begin());
   }
 }
 
+template <typename HepMCEventT, typename Traits>
+long HepMCConverter<HepMCEventT,Traits>::flowIndex(tcColinePtr l) {
+  const ColourLine * line = PtrTraits<tcColinePtr>::barePointer(l);
+  typename FlowMap::iterator it = flowmap.find(line);
+  if ( it == flowmap.end() )
+    it = flowmap.insert(make_pair(line, long(flowmap.size()) + 500)).first;
+  return it->second;
+}
+
 template <typename HepMCEventT, typename Traits>
 typename HepMCConverter<HepMCEventT,Traits>::GenVertex *
 HepMCConverter<HepMCEventT,Traits>::createVertex(Vertex * v) {
   if ( !v ) Throw<HepMCConverterException>()
     << "Found internal null Vertex." << Exception::abortnow;
 
-  GenVertex * gv = new GenVertex();
+  GenVertex * gv = Traits::newVertex();
 
   // We assume that the vertex position is the average of the decay
   // vertices of all incoming and the creation vertices of all
@@ -285,12 +347,12 @@ HepMCConverter<HepMCEventT,Traits>::createVertex(Vertex * v) {
   for ( tcParticleSet::iterator it = v->in.begin();
 	it != v->in.end(); ++it ) {
     p += (**it).labDecayVertex();
-    Traits::addIncoming(*gv, pmap[*it]);
+    Traits::addIncoming(*gv, pmap[index(*it)]);
   }
   for ( tcParticleSet::iterator it = v->out.begin();
 	it != v->out.end(); ++it ) {
     p += (**it).labVertex();
-    Traits::addOutgoing(*gv, pmap[*it]);
+    Traits::addOutgoing(*gv, pmap[index(*it)]);
   }
 
   p /= double(v->in.size() + v->out.size());
@@ -81,6 +81,11 @@ struct HepMCTraitsBase {
     return e;
   }
 
+  /** Remove all particles and vertices from a re-used GenEvent. */
+  static void clearEvent(EventT & e) {
+    e.clear();
+  }
+
   /** Reset event weight and number of a re-used GenEvent. */
   static void resetEvent(EventT * e, long evno, double weight,
 			 const map<string,double>& optionalWeights) {
@@ -25,6 +25,7 @@ int main(int argc, char * argv[]) {
   string mainclass;
   bool tics = false;
   bool resume = false;
+  bool binary = false;
   string tag = "";
   string setupfile = "";
 
@@ -51,12 +52,14 @@ int main(int argc, char * argv[]) {
     else if ( arg == "--seed" || arg == "-seed" ) seed = atol(argv[++iarg]);
     else if ( arg == "--tics" || arg == "-tics" ) tics = true;
     else if ( arg == "--resume" ) resume = true;
+    else if ( arg == "--binary" ) binary = true;
     else if ( arg == "-t" ) tag = argv[++iarg];
     else if ( arg.substr(0,2) == "-t" ) tag = arg.substr(2);
     else if ( arg.substr(0,6) == "--tag=" ) tag = arg.substr(6);
     else if ( arg == "--help" || arg == "-h" ) {
     cerr << "Usage: " << argv[0] << " [-d {debuglevel|-debugitem}] "
-	 << "[-l load-path] [-L first-load-path] [-m setup-file] run-file" << endl;
+	 << "[-l load-path] [-L first-load-path] [-m setup-file] [--binary] "
+	 << "run-file" << endl;
       return 3;
     }
     else if ( arg == "-v" || arg == "--version" ) {
@@ -97,6 +100,7 @@ int main(int argc, char * argv[]) {
       if ( ! msg.empty() ) cerr << msg << '\n';
     }
 
+    if ( binary ) eg->binaryFiles(true);
     if ( seed > 0 ) eg->setSeed(seed);
     if ( !tag.empty() ) eg->addTag(tag);
     if ( !mainclass.empty() ) {
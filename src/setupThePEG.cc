@@ -29,6 +29,7 @@ int main(int argc, char * argv[]) {
   string repout;
   string file;
   bool init = false;
+  bool binary = false;
   vector<string> globlib;
   vector<string> preread;
   vector<string> appread;
@@ -47,6 +48,7 @@ int main(int argc, char * argv[]) {
       Debug::level = 0;
     }
     else if ( arg == "--exitonerror" ) repository.exitOnError() = 1;
+    else if ( arg == "--binary" ) binary = true;
     else if ( arg == "-s" ) {
       DynamicLoader::load(argv[++iarg]);
       repository.globalLibraries().push_back(argv[iarg]);
@@ -82,7 +84,7 @@ int main(int argc, char * argv[]) {
     else if ( arg == "-h" || arg == "--help" ) {
       cerr << "Usage: " << argv[0]
 	 << " {cmdfile} [-d {debuglevel|-debugitem}] [-r input-repository-file]"
-	 << " [-l load-path] [-L first-load-path]" << endl;
+	 << " [-l load-path] [-L first-load-path] [--binary]" << endl;
       return 3;
     }
     else if ( arg == "-v" || arg == "--version" ) {
@@ -117,7 +119,7 @@ int main(int argc, char * argv[]) {
 	if ( ! msg.empty() ) cerr << msg << '\n';
 	repository.update();
       }
-      repository.save(repout);
+      repository.save(repout, binary);
     } else {
       string msg = repository.load(repo);
       if ( ! msg.empty() ) cerr << msg << '\n';